@@ -0,0 +1,44 @@
+#ifndef CMAC_128_H
+#define CMAC_128_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../common/common.h"
+
+// CMAC-AES128 키/블록/최대 태그 길이
+#define CMAC128_KEY_LENGTH 16
+#define CMAC128_BLOCK_SIZE 16
+#define CMAC128_TAG_LENGTH 16
+
+// 테스트 유형 (등록 순서와 같음)
+typedef enum {
+    CMAC_TEST_GEN = 0,
+    CMAC_TEST_VER = 1
+} CmacTestType;
+
+// EVP CMAC (AlgorithmConfig.ops.mac 슬롯용, 기준 구현)
+int cmac128_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                unsigned char* tag, size_t tag_len);
+int cmac128_verify(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                   const unsigned char* tag, size_t tag_len);
+
+// 테스트에 사용할 MAC 백엔드 설정 (AlgorithmConfig.ops.mac 슬롯, NULL이면 EVP)
+void cmac128_set_backend(int (*mac_function)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                             unsigned char*, size_t),
+                         int (*mac_verify)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                           const unsigned char*, size_t));
+
+/**
+ * CMACGen/CMACVer 요청 파일 실행
+ * 레코드에 Mac이 있으면 검증해 Result를, 없으면 Tlen 바이트 Mac을 덧붙임
+ */
+int cmac128_test(const char* input_file, const char* output_file);
+
+// 자동/수동 테스트 함수
+int cmac128_run_auto_test(int test_type_id);
+int cmac128_run_manual_test(int input_type_id);
+
+// 알고리즘 등록 함수
+void register_cmac128_algorithm(void);
+
+#endif // CMAC_128_H
@@ -0,0 +1,70 @@
+#ifndef CMAC_128_NATIVE_H
+#define CMAC_128_NATIVE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "cmac_128.h"
+
+// AES-128 라운드 키 수 (초기 키 + 10라운드)
+#define AES128_ROUND_KEYS 11
+
+// 스레드별 키 캐시 슬롯 수 (같은 키가 여러 레코드에 반복되는 작업용)
+#define CMAC128_KEY_CACHE_SLOTS 8
+
+// 다중 레인 검증 최대 폭 (레코드 여러 개의 CBC 체인을 동시에 진행)
+#define CMAC128_MB_MAX_LANES 8
+
+// 네이티브 엔진 구현 종류
+typedef enum {
+    CMAC128_IMPL_EVP = 0,       // AES-NI가 없으면 EVP CMAC으로 위임
+    CMAC128_IMPL_AESNI = 1      // AES-NI 명령어 구현
+} Cmac128Impl;
+
+/**
+ * 키 하나에서 유도한 값 (라운드 키와 서브키 K1/K2)
+ * 한 번 만들면 같은 키의 모든 레코드가 재사용
+ */
+typedef struct {
+    uint8_t key[CMAC128_KEY_LENGTH];
+    uint8_t round_keys[AES128_ROUND_KEYS][CMAC128_BLOCK_SIZE];
+    uint8_t k1[CMAC128_BLOCK_SIZE];     // 마지막 블록이 꽉 찼을 때
+    uint8_t k2[CMAC128_BLOCK_SIZE];     // 마지막 블록을 패딩했을 때
+} Cmac128KeySchedule;
+
+// 런타임 디스패치 (환경 변수 CRYPTO_TEST_CMAC_IMPL=evp로 EVP 강제)
+Cmac128Impl cmac128_native_dispatch(void);
+const char* cmac128_native_impl_name(void);
+
+// 다중 레인 검증 폭 (CRYPTO_TEST_CMAC_LANES로 1/4/8 지정, 기본값 8)
+size_t cmac128_mb_lanes(void);
+
+/**
+ * 현재 스레드 키 캐시에서 키 일정 찾기 (없으면 가장 오래된 슬롯에 새로 만듦)
+ * 반환값은 같은 스레드에서 CMAC128_KEY_CACHE_SLOTS개의 다른 키를 더 찾기 전까지 유효
+ * AES-NI 구현에서만 사용 (그 외에는 NULL)
+ */
+const Cmac128KeySchedule* cmac128_key_schedule_get(const uint8_t key[CMAC128_KEY_LENGTH]);
+
+// 키 일정으로 전체 길이(16바이트) 태그 계산 (AES-NI 구현에서만 사용)
+void cmac128_native_compute(const Cmac128KeySchedule* schedule, const uint8_t* message, size_t message_len,
+                            uint8_t tag[CMAC128_TAG_LENGTH]);
+
+// AlgorithmConfig.ops.mac 슬롯용 함수
+int cmac128_native_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       unsigned char* tag, size_t tag_len);
+int cmac128_native_verify(const unsigned char* key, size_t key_len, const unsigned char* message,
+                          size_t message_len, const unsigned char* tag, size_t tag_len);
+
+/**
+ * 독립된 레코드 여러 개를 한 번에 검증 (키, 메시지 길이, 태그 길이는 레코드마다 다를 수 있음)
+ * AES-NI 구현은 cmac128_mb_lanes()개 레코드의 CBC 체인을 엇갈려 진행
+ * results[i]: 태그가 맞으면 SUCCESS, 다르면 ERR_MAC_VERIFY, 길이가 잘못되면 ERR_INVALID_INPUT
+ * @return SUCCESS 또는 ERR_INVALID_INPUT(배열이 NULL)
+ */
+int cmac128_native_verify_many(const unsigned char* const keys[], const size_t key_lens[],
+                               const unsigned char* const messages[], const size_t message_lens[],
+                               const unsigned char* const tags[], const size_t tag_lens[],
+                               int results[], size_t count);
+
+#endif // CMAC_128_NATIVE_H
@@ -0,0 +1,43 @@
+#ifndef HMAC_SHA256_H
+#define HMAC_SHA256_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../common/common.h"
+
+// HMAC-SHA256 블록/최대 태그 길이와 요청 파일의 해시 출력 길이 섹션 값 ([L=32])
+#define HMAC_SHA256_BLOCK_SIZE 64
+#define HMAC_SHA256_TAG_LENGTH 32
+#define HMAC_SHA256_L 32
+
+// 테스트 유형 (등록 순서와 같음)
+typedef enum {
+    HMAC_TEST_GEN = 0
+} HmacTestType;
+
+// EVP HMAC (AlgorithmConfig.ops.mac 슬롯용, 기준 구현)
+int hmac_sha256_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                    unsigned char* tag, size_t tag_len);
+int hmac_sha256_verify(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       const unsigned char* tag, size_t tag_len);
+
+// 테스트에 사용할 MAC 백엔드 설정 (AlgorithmConfig.ops.mac 슬롯, NULL이면 EVP)
+void hmac_sha256_set_backend(int (*mac_function)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                                 unsigned char*, size_t),
+                             int (*mac_verify)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                               const unsigned char*, size_t));
+
+/**
+ * HMAC 요청 파일 실행
+ * [L=32] 섹션의 레코드에 Tlen 바이트 Mac을 덧붙이고, 다른 L 섹션의 레코드는 그대로 에코
+ */
+int hmac_sha256_test(const char* input_file, const char* output_file);
+
+// 자동/수동 테스트 함수
+int hmac_sha256_run_auto_test(int test_type_id);
+int hmac_sha256_run_manual_test(int input_type_id);
+
+// 알고리즘 등록 함수
+void register_hmac_sha256_algorithm(void);
+
+#endif // HMAC_SHA256_H
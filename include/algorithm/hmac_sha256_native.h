@@ -0,0 +1,46 @@
+#ifndef HMAC_SHA256_NATIVE_H
+#define HMAC_SHA256_NATIVE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "hmac_sha256.h"
+
+// 스레드별 키 캐시 슬롯 수 (같은 키가 여러 레코드에 반복되는 작업용)
+#define HMAC_SHA256_KEY_CACHE_SLOTS 8
+
+// 캐시에 원문을 보관하는 최대 키 길이 (더 긴 키는 호출마다 중간 상태를 새로 만듦)
+#define HMAC_SHA256_CACHE_KEY_MAX 128
+
+/**
+ * 키 하나에서 유도한 값 (K0⊕ipad, K0⊕opad 블록을 한 번씩 압축한 중간 상태)
+ * 한 번 만들면 같은 키의 모든 레코드가 패드 블록 압축 없이 재사용
+ */
+typedef struct {
+    uint8_t key[HMAC_SHA256_CACHE_KEY_MAX];
+    size_t key_len;
+    uint32_t inner[8];      // 내부 해시의 첫 블록 (K0⊕ipad) 이후 상태
+    uint32_t outer[8];      // 외부 해시의 첫 블록 (K0⊕opad) 이후 상태
+} HmacSha256KeyState;
+
+// 키에서 중간 상태 계산 (64바이트보다 긴 키는 먼저 SHA-256으로 줄임)
+void hmac_sha256_key_state_init(HmacSha256KeyState* state, const uint8_t* key, size_t key_len);
+
+/**
+ * 현재 스레드 키 캐시에서 중간 상태 찾기 (없으면 가장 오래된 슬롯에 새로 만듦)
+ * HMAC_SHA256_CACHE_KEY_MAX보다 긴 키는 캐시하지 않고 scratch에 만들어 반환
+ * 반환값은 같은 스레드에서 HMAC_SHA256_KEY_CACHE_SLOTS개의 다른 키를 더 찾기 전까지 유효
+ */
+const HmacSha256KeyState* hmac_sha256_key_state_get(const uint8_t* key, size_t key_len,
+                                                    HmacSha256KeyState* scratch);
+
+// 중간 상태로 전체 길이(32바이트) 태그 계산 (메시지 블록 + 외부 블록 하나만 압축)
+void hmac_sha256_native_compute(const HmacSha256KeyState* state, const uint8_t* message, size_t message_len,
+                                uint8_t tag[HMAC_SHA256_TAG_LENGTH]);
+
+// AlgorithmConfig.ops.mac 슬롯용 함수
+int hmac_sha256_native_mac(const unsigned char* key, size_t key_len, const unsigned char* message,
+                           size_t message_len, unsigned char* tag, size_t tag_len);
+int hmac_sha256_native_verify(const unsigned char* key, size_t key_len, const unsigned char* message,
+                              size_t message_len, const unsigned char* tag, size_t tag_len);
+
+#endif // HMAC_SHA256_NATIVE_H
@@ -34,11 +34,20 @@ int sha256_init(void** ctx);
 int sha256_update(void* ctx, const unsigned char* data, size_t data_len);
 int sha256_final(void* ctx, unsigned char* digest);
 
+// 테스트에 사용할 해시 백엔드 설정 (AlgorithmConfig.ops.hash 슬롯, NULL이면 EVP)
+void sha256_set_backend(int (*hash_function)(const uint8_t*, size_t, uint8_t*),
+                        int (*hash_init)(void**),
+                        int (*hash_update)(void*, const unsigned char*, size_t),
+                        int (*hash_final)(void*, unsigned char*));
+
 // 자동 테스트 함수들
 int sha256_run_auto_test(int test_type_id);
 int sha256_test(const char* input_file, const char* output_file);
 int sha256_monte(const char* input_file, const char* output_file);
 
+// 여러 몬테 카를로 요청 파일(시드)을 SIMD 레인에서 동시에 실행
+int sha256_monte_multi(const char* const input_files[], const char* const output_files[], size_t count);
+
 // 수동 테스트 함수
 int sha256_run_manual_test(int input_type_id);
 
@@ -0,0 +1,34 @@
+#ifndef SHA256_MB_H
+#define SHA256_MB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+// 최대 레인 수 (AVX-512: 16, AVX2: 8, SSE2: 4)
+#define SHA256_MB_MAX_LANES 16
+
+// 레인 전치 상태: state[워드][레인]
+typedef uint32_t Sha256LaneState[8][SHA256_MB_MAX_LANES];
+
+// 현재 CPU에서 사용하는 레인 수 (SIMD 미지원 시 1)
+size_t sha256_mb_lanes(void);
+const char* sha256_mb_impl_name(void);
+
+// 레인 상태를 초기 해시 값으로 설정
+void sha256_mb_state_init(Sha256LaneState state, size_t lane);
+
+// 레인 상태에서 다이제스트 추출
+void sha256_mb_state_digest(Sha256LaneState state, size_t lane, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+// 다중 레인 압축: 레인 0..lanes-1에 각각 64바이트 블록 하나씩 누적
+void sha256_mb_compress(Sha256LaneState state, const uint8_t* const blocks[], size_t lanes);
+
+/**
+ * 독립된 메시지 여러 개를 SIMD 레인에 나눠 해시
+ * 길이가 서로 달라도 되며, 끝난 레인에는 다음 메시지를 바로 채움
+ */
+int sha256_hash_many(const uint8_t* const msgs[], const size_t lens[],
+                     uint8_t (*digests)[SHA256_DIGEST_LENGTH], size_t n);
+
+#endif // SHA256_MB_H
@@ -0,0 +1,41 @@
+#ifndef SHA256_MONTE_H
+#define SHA256_MONTE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sha256.h"
+
+// 몬테 카를로 테스트 파라미터 (체크포인트 100개, 체크포인트당 1000회)
+#define SHA256_MONTE_CHECKPOINTS 100
+#define SHA256_MONTE_ITERATIONS 1000
+
+// 체크포인트 콜백 (count: 0..99, md: 해당 체크포인트 MD)
+typedef int (*Sha256MonteCheckpointFn)(void* user, int count, const uint8_t md[SHA256_DIGEST_LENGTH]);
+
+// 실행 통계
+typedef struct {
+    uint64_t iterations;        // 전체 해시 반복 횟수
+    double elapsed_sec;         // 경과 시간 (초)
+    double iterations_per_sec;  // 초당 반복 횟수
+} Sha256MonteStats;
+
+/**
+ * 몬테 카를로 엔진 실행
+ * 최근 다이제스트 3개만 순환 버퍼에 두고 해시 상태 하나를 재사용 (반복 중 할당 없음)
+ * @param use_native true면 네이티브 엔진, false면 EVP 컨텍스트 재사용
+ */
+int sha256_monte_engine_run(const uint8_t seed[SHA256_DIGEST_LENGTH], bool use_native,
+                            Sha256MonteCheckpointFn on_checkpoint, void* user,
+                            Sha256MonteStats* stats);
+
+/**
+ * 독립된 시드 여러 개의 몬테 카를로 체인을 SIMD 레인에서 동시에 진행
+ * 체인 c의 체크포인트는 on_checkpoint(users[c], ...)로 전달되며 순서는 체인별로 보장
+ * stats에는 전체 체인의 합계가 기록됨
+ */
+int sha256_monte_engine_run_many(const uint8_t (*seeds)[SHA256_DIGEST_LENGTH], size_t count,
+                                 Sha256MonteCheckpointFn on_checkpoint, void* const users[],
+                                 Sha256MonteStats* stats);
+
+#endif // SHA256_MONTE_H
@@ -0,0 +1,51 @@
+#ifndef SHA256_NATIVE_H
+#define SHA256_NATIVE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+// SHA-256 블록 크기
+#define SHA256_BLOCK_SIZE 64
+
+// SHA-256 라운드 상수와 초기 해시 값 (다중 버퍼 엔진과 공유)
+extern const uint32_t sha256_k[64];
+extern const uint32_t sha256_h0[8];
+
+// 네이티브 압축 함수 구현 종류
+typedef enum {
+    SHA256_IMPL_PORTABLE = 0,   // 이식성 C 구현
+    SHA256_IMPL_AVX2 = 1,       // AVX2/BMI2 (rorx) 구현
+    SHA256_IMPL_SHANI = 2       // SHA-NI 명령어 구현
+} Sha256Impl;
+
+// 네이티브 해시 컨텍스트 (힙 할당 없이 스택에 둘 수 있음)
+typedef struct {
+    uint32_t state[8];                  // 중간 해시 상태 (H0..H7)
+    uint64_t total_len;                 // 누적 입력 길이 (바이트)
+    uint8_t buffer[SHA256_BLOCK_SIZE];  // 미처리 블록 버퍼
+    size_t buffer_len;                  // 버퍼에 쌓인 바이트 수
+} Sha256NativeCtx;
+
+// 압축 함수: state에 nblocks개의 64바이트 블록을 누적
+void sha256_native_compress(uint32_t state[8], const uint8_t* blocks, size_t nblocks);
+
+// 런타임 디스패치 (CPUID 검사 후 구현 선택, 여러 번 호출해도 안전)
+Sha256Impl sha256_native_dispatch(void);
+const char* sha256_native_impl_name(void);
+
+// 스택 컨텍스트용 함수 (할당 없음)
+void sha256_native_ctx_init(Sha256NativeCtx* ctx);
+void sha256_native_ctx_update(Sha256NativeCtx* ctx, const uint8_t* data, size_t len);
+void sha256_native_ctx_final(Sha256NativeCtx* ctx, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+// 미리 압축해 둔 중간 상태에서 이어서 시작 (total_len은 이미 압축한 바이트 수, 블록 크기의 배수)
+void sha256_native_ctx_resume(Sha256NativeCtx* ctx, const uint32_t state[8], uint64_t total_len);
+
+// AlgorithmConfig.ops.hash 슬롯용 함수
+int sha256_native_hash(const uint8_t* message, size_t message_len, uint8_t* digest);
+int sha256_native_init(void** ctx);
+int sha256_native_update(void* ctx, const unsigned char* data, size_t data_len);
+int sha256_native_final(void* ctx, unsigned char* digest);
+
+#endif // SHA256_NATIVE_H
@@ -17,7 +17,8 @@
 typedef enum {
     ALGO_TYPE_HASH,      // 해시 알고리즘
     ALGO_TYPE_CIPHER,    // 암호화 알고리즘
-    ALGO_TYPE_SIGNATURE  // 서명 알고리즘
+    ALGO_TYPE_SIGNATURE, // 서명 알고리즘
+    ALGO_TYPE_MAC        // 메시지 인증 코드
 } AlgorithmType;
 
 // 알고리즘 설정 구조체
@@ -42,6 +43,10 @@ typedef struct {
             int (*hash_init)(void** ctx);
             int (*hash_update)(void* ctx, const unsigned char* input, size_t input_len);
             int (*hash_final)(void* ctx, unsigned char* output);
+            // 독립된 메시지 여러 개를 한 번에 해시 (outputs에 digest_len씩 연속 기록, 없으면 NULL)
+            int (*hash_many)(const unsigned char* const inputs[], const size_t input_lens[],
+                             unsigned char* outputs, size_t count);
+            size_t digest_len;                       // 출력 길이 (바이트)
         } hash;
         
         // 암호화 알고리즘용
@@ -59,6 +64,24 @@ typedef struct {
             int (*verify)(const unsigned char* input, size_t input_len, 
                          const unsigned char* key, const unsigned char* signature);
         } signature;
+        
+        // MAC 알고리즘용 (레코드마다 키와 태그 길이를 받음)
+        struct {
+            int (*mac_function)(const unsigned char* key, size_t key_len,
+                                const unsigned char* input, size_t input_len,
+                                unsigned char* tag, size_t tag_len);
+            // 태그가 맞으면 SUCCESS, 다르면 ERR_MAC_VERIFY
+            int (*mac_verify)(const unsigned char* key, size_t key_len,
+                              const unsigned char* input, size_t input_len,
+                              const unsigned char* tag, size_t tag_len);
+            // 독립된 레코드 여러 개 검증 (NULL이면 레코드별 mac_verify), results[i]는 mac_verify 반환값
+            int (*mac_verify_many)(const unsigned char* const keys[], const size_t key_lens[],
+                                   const unsigned char* const inputs[], const size_t input_lens[],
+                                   const unsigned char* const tags[], const size_t tag_lens[],
+                                   int results[], size_t count);
+            size_t key_len;                          // 키 길이 (바이트, 0이면 가변)
+            size_t max_tag_len;                      // 최대 태그 길이 (바이트)
+        } mac;
     } ops;
     
     // 테스트 벡터 파일 경로
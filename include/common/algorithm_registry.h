@@ -19,8 +19,19 @@ void register_all_algorithms(void);
 // SHA-256 알고리즘 등록 함수 (외부 선언)
 void register_sha256_algorithm(void);
 
+// CMAC-AES128 알고리즘 등록 함수 (외부 선언)
+void register_cmac128_algorithm(void);
+
+// HMAC-SHA256 알고리즘 등록 함수 (외부 선언)
+void register_hmac_sha256_algorithm(void);
+
 // 알고리즘 등록용 편의 매크로
-#define REGISTER_HASH_ALGO(NAME, DESC, HASH_FUNC, HASH_INIT, HASH_UPDATE, HASH_FINAL, VECTOR_PATH, ...) do { \
+#define REGISTER_HASH_ALGO(NAME, DESC, HASH_FUNC, HASH_INIT, HASH_UPDATE, HASH_FINAL, VECTOR_PATH, ...) \
+    REGISTER_HASH_ALGO_EX(NAME, DESC, HASH_FUNC, HASH_INIT, HASH_UPDATE, HASH_FINAL, NULL, 0, VECTOR_PATH, __VA_ARGS__)
+
+// 배치 해시 함수와 출력 길이까지 등록
+#define REGISTER_HASH_ALGO_EX(NAME, DESC, HASH_FUNC, HASH_INIT, HASH_UPDATE, HASH_FINAL, HASH_MANY, DIGEST_LEN, \
+                              VECTOR_PATH, ...) do { \
     static const char* _test_types[] = {__VA_ARGS__}; \
     static const char* _input_types[] = {"텍스트", "16진수"}; \
     AlgorithmConfig config = { \
@@ -39,6 +50,32 @@ void register_sha256_algorithm(void);
     config.ops.hash.hash_init = HASH_INIT; \
     config.ops.hash.hash_update = HASH_UPDATE; \
     config.ops.hash.hash_final = HASH_FINAL; \
+    config.ops.hash.hash_many = HASH_MANY; \
+    config.ops.hash.digest_len = DIGEST_LEN; \
+    register_algorithm(&config); \
+} while(0)
+
+// MAC 알고리즘 등록 (키는 항상 16진수, 메시지는 텍스트/16진수 입력)
+#define REGISTER_MAC_ALGO(NAME, DESC, MAC_FUNC, MAC_VERIFY, MAC_VERIFY_MANY, KEY_LEN, MAX_TAG_LEN, VECTOR_PATH, ...) do { \
+    static const char* _test_types[] = {__VA_ARGS__}; \
+    static const char* _input_types[] = {"텍스트", "16진수"}; \
+    AlgorithmConfig config = { \
+        .type = ALGO_TYPE_MAC, \
+        .test_type_count = sizeof(_test_types)/sizeof(_test_types[0]), \
+        .input_type_count = 2 \
+    }; \
+    strncpy(config.name, NAME, MAX_ALGO_NAME - 1); \
+    strncpy(config.description, DESC, MAX_ALGO_DESC - 1); \
+    strncpy(config.test_vector_path, VECTOR_PATH, MAX_PATH_LENGTH - 1); \
+    for(int i = 0; i < config.test_type_count && i < MAX_TEST_TYPES; i++) \
+        strncpy(config.test_types[i], _test_types[i], MAX_TYPE_NAME - 1); \
+    for(int i = 0; i < config.input_type_count && i < MAX_INPUT_TYPES; i++) \
+        strncpy(config.input_types[i], _input_types[i], MAX_TYPE_NAME - 1); \
+    config.ops.mac.mac_function = MAC_FUNC; \
+    config.ops.mac.mac_verify = MAC_VERIFY; \
+    config.ops.mac.mac_verify_many = MAC_VERIFY_MANY; \
+    config.ops.mac.key_len = KEY_LEN; \
+    config.ops.mac.max_tag_len = MAX_TAG_LEN; \
     register_algorithm(&config); \
 } while(0)
 
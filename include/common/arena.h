@@ -0,0 +1,40 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 아레나 할당 정렬 단위 (SIMD 로드에 맞춤)
+#define ARENA_ALIGN 32
+
+// 아레나 블록 (부족하면 블록을 이어 붙임)
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;         // data 크기
+    size_t used;         // 사용한 바이트 수
+    uint8_t* data;       // ARENA_ALIGN 정렬된 시작 주소
+} ArenaBlock;
+
+// 범프 할당기 (개별 해제 없음, reset으로 한 번에 비움)
+typedef struct {
+    ArenaBlock* head;    // 현재 블록
+    size_t block_size;   // 새 블록 기본 크기
+    size_t total;        // 전체 블록 크기 합
+} Arena;
+
+void arena_init(Arena* arena, size_t block_size);
+void arena_free(Arena* arena);
+
+/**
+ * 정렬된 메모리 할당 (size가 0이어도 유효한 포인터 반환)
+ * @return 할당 실패 시 NULL
+ */
+void* arena_alloc(Arena* arena, size_t size);
+
+/**
+ * 모든 할당 해제
+ * 블록이 여러 개였으면 전체 크기의 블록 하나로 합쳐, 이후에는 같은 부하에서 malloc이 없음
+ */
+void arena_reset(Arena* arena);
+
+#endif // ARENA_H
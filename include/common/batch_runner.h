@@ -0,0 +1,35 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <stdbool.h>
+
+// 배치 실행 옵션
+typedef struct {
+    const char* request_root;   // 요청 파일 루트 (기본: test_vectors/request)
+    const char* response_root;  // 응답 파일 루트 (기본: test_vectors/response)
+    const char* expected_root;  // 정답 파일 루트 (기본: test_vectors/expected)
+    const char* algo_filter;    // 이 이름의 알고리즘만 실행 (NULL이면 전체)
+    int jobs;                   // 작업 스레드 수 (0이면 CPU 코어 수)
+    bool verify_only;           // 실행하지 않고 기존 응답 파일만 정답과 비교
+    const char* file_filter;    // 레이블("디렉토리/파일")에 이 문자열이 있는 파일만 실행 (NULL이면 전체)
+    const char* records;        // 레코드 선택자 (NULL이면 파일 전체, 형식은 record_index.h)
+    bool force;                 // 결과 캐시를 무시하고 모두 다시 실행
+} BatchOptions;
+
+// 기본 옵션으로 초기화
+void batch_options_init(BatchOptions* options);
+
+/**
+ * 비대화형 배치 실행
+ * request_root 아래 디렉토리마다 test_vector_path가 같은 등록 알고리즘을 찾아
+ * 모든 요청 파일을 작업 스레드 풀에서 실행하고, 결과는 (디렉토리, 알고리즘, 파일) 순서로 출력
+ * 같은 디렉토리를 쓰는 알고리즘이 여럿이면 첫 번째 알고리즘만 response_root/<디렉토리>에,
+ * 나머지는 response_root/<디렉토리>/<알고리즘 이름>에 기록
+ * 실패한 파일은 다른 레코드와 필드를 함께 출력
+ * 요청/정답 내용, 백엔드, 빌드가 그대로인 파일은 결과 캐시의 응답과 판정을 재사용
+ * records가 있으면 요청/정답 파일에서 선택한 레코드만 뽑은 .sel 파일로 실행하고 비교
+ * @return 모두 통과하면 SUCCESS, 실패나 오류가 있으면 ERR_TEST_FAILED
+ */
+int run_batch(const BatchOptions* options);
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,92 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// 메시지 크기 목록 최대 개수
+#define BENCH_MAX_SIZES 32
+
+// 스트리밍 경로에서 hash_update 한 번에 넘기는 크기
+#define BENCH_STREAM_CHUNK (16 * 1024)
+
+// 배치 경로 메시지 수 상한과 배치 하나의 최대 입력 크기
+#define BENCH_BATCH_MAX_MSGS 64
+#define BENCH_BATCH_BYTES (64u * 1024 * 1024)
+
+// MAC 경로의 키 (키 길이가 가변인 알고리즘은 BENCH_MAC_KEY_LEN 바이트 키 사용)
+#define BENCH_MAC_KEY_LEN 32
+
+// 키 교체 경로에서 돌려 쓰는 키 수 (백엔드 키 캐시 슬롯보다 많아 매 호출 키 설정 비용이 포함됨)
+#define BENCH_MAC_ROTATE_KEYS 16
+
+// 측정 경로 (해시 알고리즘은 앞의 세 경로, MAC 알고리즘은 뒤의 세 경로)
+typedef enum {
+    BENCH_PATH_ONESHOT = 0,  // hash_function
+    BENCH_PATH_STREAM,       // hash_init / hash_update / hash_final
+    BENCH_PATH_BATCH,        // hash_many (없으면 메시지별 hash_function)
+    BENCH_PATH_MAC,          // 고정 키 mac_function
+    BENCH_PATH_MAC_ROTATE,   // 호출마다 키를 바꾸는 mac_function
+    BENCH_PATH_VERIFY_MANY,  // 고정 키 mac_verify_many (없으면 메시지별 mac_verify)
+    BENCH_PATH_COUNT
+} BenchPath;
+
+// 벤치마크 옵션
+typedef struct {
+    const char* algo_filter;    // 이 이름의 알고리즘만 측정 (NULL이면 전체)
+    const char* sizes;          // 크기 목록 "64,1K,16M" (NULL이면 16B부터 16MB까지 4배씩)
+    const char* json_path;      // JSON 결과 파일 (NULL이면 기록 안 함)
+    int cpu;                    // 고정할 CPU 번호 (-1이면 시작 시 실행 중인 CPU, -2면 고정 안 함)
+    double min_time;            // 측정 한 번의 최소 시간 (초)
+    int trials;                 // 반복 측정 횟수 (중앙값 사용)
+} BenchOptions;
+
+// 측정 결과 한 건
+typedef struct {
+    int algo_id;
+    BenchPath path;
+    size_t size;                // 메시지 크기 (바이트)
+    size_t batch;               // 호출 한 번에 처리한 메시지 수 (배치 경로 외에는 1)
+    double ns_per_op;           // 메시지 하나당 시간 (중앙값)
+    double mb_per_sec;          // 처리량 (10^6 바이트/초)
+    double mb_per_sec_mad;      // 반복 측정 처리량의 중앙값 절대 편차
+    double cycles_per_byte;     // TSC 기준 바이트당 사이클 (측정할 수 없으면 0)
+} BenchResult;
+
+// 벤치마크 전체 결과
+typedef struct {
+    BenchResult* results;
+    size_t count;
+    size_t capacity;
+    char cpu_model[128];
+    int cpu;                    // 고정한 CPU (-1이면 고정 안 함)
+    double tsc_ghz;             // TSC 주파수 추정값 (0이면 없음)
+} BenchReport;
+
+void bench_options_init(BenchOptions* options);
+
+const char* bench_path_name(BenchPath path);
+
+/**
+ * 등록된 해시/MAC 알고리즘마다 크기별로 해당 종류의 세 경로를 측정
+ * 측정마다 워밍업으로 반복 수를 정한 뒤 trials번 재서 중앙값을 사용
+ * @return SUCCESS, ERR_INVALID_INPUT(잘못된 크기 목록), ERR_MEMORY_ALLOC
+ */
+int bench_run(const BenchOptions* options, BenchReport* report);
+
+// 표 형식 출력
+void bench_report_print(const BenchReport* report);
+
+// JSON 기록
+int bench_report_write_json(const BenchReport* report, const char* path);
+
+// 성능 기록 파일에 측정값 덧붙이기 (perf_history.h)
+int bench_report_record_history(const BenchReport* report, int trials);
+
+void bench_report_free(BenchReport* report);
+
+// 벤치마크 실행 후 표 출력과 JSON 기록 (명령행 --bench)
+int run_bench(const BenchOptions* options);
+
+#endif // BENCH_H
@@ -17,6 +17,13 @@
 #define MAX_LINE_LENGTH 1024
 #define MAX_HASH_LENGTH 128
 
+// 스레드 지역 저장소 지정자
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
 // 16진수 변환 함수
 int hex_to_bytes(const char* hex_string, uint8_t* bytes, size_t max_len);
 void bytes_to_hex(const unsigned char* bytes, size_t len, char* hex_string);
@@ -25,6 +32,16 @@ void bytes_to_hex(const unsigned char* bytes, size_t len, char* hex_string);
 bool file_exists(const char* path);
 int create_directory(const char* path);  // 반환형을 int로 통일
 const char* replace_extension(const char* filename, const char* old_ext, const char* new_ext);
+const char* get_filename_from_path(const char* path);
+
+// 시간 측정 함수 (단조 증가 시계, 초 단위)
+double get_time_seconds(void);
+
+// 사용 가능한 CPU 코어 수
+int get_cpu_count(void);
+
+// CPU 모델 이름 (알 수 없으면 "unknown")
+void get_cpu_model(char* buf, size_t size);
 
 // 테스트 결과 비교 함수
 int compare_test_results(const char* output_file, const char* expected_file);
@@ -0,0 +1,89 @@
+#ifndef COMPRESSED_IO_H
+#define COMPRESSED_IO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// 압축 형식 (파일 확장자로 판단)
+typedef enum {
+    COMPRESSION_NONE = 0,
+    COMPRESSION_GZIP,    // .gz (zlib)
+    COMPRESSION_ZSTD     // .zst (HAVE_ZSTD로 빌드했을 때만)
+} CompressionKind;
+
+// 스트리밍 압축 해제 출력 단위 (메모리 사용 준비/반환 단위)
+#define DECOMPRESS_CHUNK (1024 * 1024)
+
+// 읽는 쪽이 내용을 놓아주는 동안 해제 스레드가 앞서 나갈 수 있는 최대 크기
+#define DECOMPRESS_WINDOW (64 * 1024 * 1024)
+
+// 압축 출력 버퍼 크기
+#define COMPRESS_OUT_SIZE (256 * 1024)
+
+CompressionKind compression_kind_for_path(const char* path);
+
+// 형식의 확장자 ("", ".gz", ".zst")
+const char* compression_suffix(CompressionKind kind);
+
+// 이 빌드에서 지원하는 형식인지
+bool compression_supported(CompressionKind kind);
+
+/**
+ * 백그라운드 스레드 압축 해제 스트림
+ * 해제한 내용은 주소가 바뀌지 않는 하나의 버퍼에 이어 붙여지므로
+ * 읽는 쪽은 앞부분을 토큰화하는 동안 뒷부분이 계속 풀림
+ * 읽는 쪽이 다 쓴 앞부분을 놓아주면 그 메모리를 반환하고 해제도 창 크기만큼만 앞서 나가므로
+ * 파일 크기와 관계없이 메모리 사용량이 일정하게 유지됨
+ */
+typedef struct DecompressStream DecompressStream;
+
+/**
+ * 압축 파일 해제 시작
+ * @return SUCCESS, ERR_FILE_OPEN, ERR_MEMORY_ALLOC, ERR_NOT_IMPLEMENTED(지원하지 않는 형식)
+ */
+int decompress_stream_start(DecompressStream** stream, const char* path, CompressionKind kind);
+
+// 해제 버퍼 시작 주소 (스트림을 닫기 전까지 유효)
+const char* decompress_stream_data(const DecompressStream* stream);
+
+/**
+ * min_available 바이트가 풀리거나 해제가 끝날 때까지 대기
+ * @param done 해제가 끝났으면 true
+ * @return 지금까지 풀린 바이트 수
+ */
+size_t decompress_stream_wait(DecompressStream* stream, size_t min_available, bool* done);
+
+/**
+ * [0, offset) 내용을 더 이상 읽지 않음 (조각 단위로 메모리 반환, 다른 스레드에서 호출 가능)
+ * 이후 그 범위의 뷰는 사용하면 안 됨
+ */
+void decompress_stream_release(DecompressStream* stream, size_t offset);
+
+// 해제 오류 (SUCCESS, ERR_FILE_READ(손상/예약 크기 초과))
+int decompress_stream_error(DecompressStream* stream);
+
+void decompress_stream_close(DecompressStream* stream);
+
+// 압축 결과 조각을 받는 콜백
+typedef int (*CompressEmitFn)(void* ctx, const uint8_t* data, size_t len);
+
+// 스트리밍 압축기 (응답 파일 출력용)
+typedef struct {
+    CompressionKind kind;
+    void* state;
+    uint8_t* out;
+} CompressSink;
+
+int compress_sink_init(CompressSink* sink, CompressionKind kind);
+
+/**
+ * 입력을 압축해 나오는 조각마다 emit 호출
+ * @param finish true면 남은 내용을 모두 내보내고 스트림을 끝냄
+ */
+int compress_sink_write(CompressSink* sink, const void* data, size_t len, bool finish,
+                        CompressEmitFn emit, void* ctx);
+
+void compress_sink_free(CompressSink* sink);
+
+#endif // COMPRESSED_IO_H
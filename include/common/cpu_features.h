@@ -0,0 +1,21 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include <stdbool.h>
+
+// 런타임 디스패치에 사용하는 CPU 기능 플래그
+typedef struct {
+    bool ssse3;
+    bool sse41;
+    bool aesni;
+    bool pclmul;
+    bool sha;        // SHA-NI
+    bool avx2;       // AVX2 + OS YMM 상태 지원
+    bool bmi2;
+    bool avx512f;    // AVX-512F + OS ZMM 상태 지원
+} CpuFeatures;
+
+// CPUID 검사 결과 반환 (첫 호출 시 한 번만 검사)
+const CpuFeatures* get_cpu_features(void);
+
+#endif // CPU_FEATURES_H
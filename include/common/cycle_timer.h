@@ -0,0 +1,33 @@
+#ifndef CYCLE_TIMER_H
+#define CYCLE_TIMER_H
+
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLE_TIMER_TSC 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CYCLE_TIMER_TSC 1
+#else
+#include <time.h>
+#endif
+
+/**
+ * 짧은 구간 측정용 시각 (x86은 TSC, 그 외에는 단조 시계 나노초)
+ * TSC는 코어 클럭이 아닌 고정 주파수 기준이므로 ns 변환에는 cycle_timer_ticks_per_ns 사용
+ */
+static inline uint64_t cycle_timer_now(void) {
+#ifdef CYCLE_TIMER_TSC
+    return (uint64_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// 나노초당 틱 수 (첫 호출 시 약 20ms 동안 보정, TSC가 없으면 1)
+double cycle_timer_ticks_per_ns(void);
+
+#endif // CYCLE_TIMER_H
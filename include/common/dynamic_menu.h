@@ -18,6 +18,22 @@ int run_auto_test(int algo_id, int test_type_id);
 // 수동 테스트 수행 함수
 int run_manual_test(int algo_id, int input_type_id);
 
+// 요청 파일 하나 실행 (배치 실행용, 스레드 안전)
+int run_vector_file(int algo_id, const char* input_path, const char* output_path);
+
+/**
+ * SHA-256 몬테 카를로 요청 파일 여러 개(시드 목록)를 한 번에 실행 (--monte)
+ * 독립된 체인을 SIMD 레인에서 동시에 진행하고, 응답은 파일마다 <이름>.rsp에 단일 실행과 같은 형식으로 기록
+ * @param output_dir 응답 디렉토리 (NULL이면 요청 파일과 같은 디렉토리)
+ */
+int run_monte_files(const char* const input_paths[], size_t count, const char* output_dir);
+
+// 결과에 영향을 주는 백엔드 식별 문자열 (알고리즘 이름과 선택된 구현, 결과 캐시 키용)
+int describe_algorithm_backend(int algo_id, char* buf, size_t size);
+
+// 작업 스레드 시작 전 지연 초기화 항목 미리 실행
+void prepare_algorithms_for_threads(void);
+
 // 알고리즘 유형별 테스트 함수 (신규 추가)
 int run_hash_algorithm_test(AlgorithmConfig* algo, int test_type_id);
 int run_cipher_algorithm_test(AlgorithmConfig* algo, int test_type_id);
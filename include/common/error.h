@@ -32,6 +32,7 @@
 // 암호화 관련 에러 코드 (140번대)
 #define ERR_CRYPTO_OPERATION    140    // 암호화 연산 실패
 #define ERR_CRYPTO_INIT         141    // 암호화 초기화 실패
+#define ERR_MAC_VERIFY          142    // MAC 태그 불일치
 
 // SHA-256 관련 에러 코드 (150번대)
 #define ERR_SHA256_INIT         150    // SHA-256 초기화 실패
@@ -49,6 +50,7 @@
 #define ERR_UNKNOWN_ALGORITHM_TYPE 171 // 알 수 없는 알고리즘 유형
 #define ERR_MAX_ALGORITHMS      172    // 최대 알고리즘 수 초과
 #define ERR_NOT_IMPLEMENTED     173    // 구현되지 않은 기능
+#define ERR_NOT_SUPPORTED       174    // 이 환경에서 지원하지 않는 기능
 
 // 에러 메시지 함수
 void print_error(int error_code);
@@ -0,0 +1,59 @@
+#ifndef EVP_CACHE_H
+#define EVP_CACHE_H
+
+#include <openssl/evp.h>
+
+// 캐시하는 다이제스트
+typedef enum {
+    EVP_CACHE_MD_SHA256 = 0,
+    EVP_CACHE_MD_COUNT
+} EvpCacheMdId;
+
+// 캐시하는 MAC
+typedef enum {
+    EVP_CACHE_MAC_CMAC = 0,
+    EVP_CACHE_MAC_HMAC,
+    EVP_CACHE_MAC_COUNT
+} EvpCacheMacId;
+
+// 캐시하는 블록 암호
+typedef enum {
+    EVP_CACHE_CIPHER_AES_128_ECB = 0,
+    EVP_CACHE_CIPHER_AES_128_CBC,
+    EVP_CACHE_CIPHER_COUNT
+} EvpCacheCipherId;
+
+/**
+ * 알고리즘 객체 (처음 호출할 때 한 번만 EVP_*_fetch, 이후 모든 스레드가 공유)
+ * @return 가져오기 실패 시 NULL
+ */
+const EVP_MD* evp_cache_md(EvpCacheMdId id);
+EVP_MAC* evp_cache_mac(EvpCacheMacId id);
+const EVP_CIPHER* evp_cache_cipher(EvpCacheCipherId id);
+
+/**
+ * 스레드별 재사용 다이제스트 컨텍스트 (한 번에 끝나는 계산용)
+ * 다음 호출 전까지만 사용하고 해제하지 않음
+ */
+EVP_MD_CTX* evp_cache_md_ctx(void);
+
+/**
+ * 스레드별 컨텍스트 풀에서 빌리기/돌려주기 (스트리밍 계산용)
+ * 돌려준 컨텍스트는 해제하지 않고 다음 acquire에서 재초기화해 사용
+ */
+EVP_MD_CTX* evp_cache_md_ctx_acquire(void);
+void evp_cache_md_ctx_release(EVP_MD_CTX* ctx);
+
+EVP_MAC_CTX* evp_cache_mac_ctx_acquire(EvpCacheMacId id);
+void evp_cache_mac_ctx_release(EvpCacheMacId id, EVP_MAC_CTX* ctx);
+
+EVP_CIPHER_CTX* evp_cache_cipher_ctx_acquire(void);
+void evp_cache_cipher_ctx_release(EVP_CIPHER_CTX* ctx);
+
+// 현재 스레드의 컨텍스트 풀 해제 (작업 스레드 종료 전에 호출)
+void evp_cache_thread_cleanup(void);
+
+// 현재 스레드 풀과 가져온 알고리즘 객체 모두 해제 (프로그램 종료 시)
+void evp_cache_cleanup(void);
+
+#endif // EVP_CACHE_H
@@ -0,0 +1,32 @@
+#ifndef HEX_CODEC_H
+#define HEX_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * 16진수 디코딩 (검증과 변환을 한 번에, 힙 사용 없음)
+ * 홀수 길이는 앞에 '0'이 있는 것으로 처리
+ * @param out_len 디코딩된 바이트 수 (NULL 가능)
+ * @return SUCCESS, ERR_INVALID_FORMAT(잘못된 문자), ERR_HEX_BUFFER_OVERFLOW(out_cap 초과)
+ */
+int hex_decode(const char* hex, size_t hex_len, uint8_t* out, size_t out_cap, size_t* out_len);
+
+// 16진수 인코딩 (소문자 2*len 문자, NUL 미포함)
+void hex_encode(const uint8_t* bytes, size_t len, char* hex);
+
+// 현재 사용 중인 구현 이름 (AVX2/SSSE3/Scalar)
+const char* hex_codec_impl_name(void);
+
+// 청크 단위 16진수 디코딩 상태 (청크 경계에서 잘린 니블 보관)
+typedef struct {
+    uint8_t pending;     // 상위 니블
+    bool has_pending;    // 상위 니블 대기 여부
+} HexStreamState;
+
+// 청크 단위 16진수 디코딩 (공백/개행은 건너뜀, out에는 최대 hex_len/2+1 바이트 기록)
+void hex_stream_init(HexStreamState* st);
+int hex_stream_decode(HexStreamState* st, const char* hex, size_t hex_len, uint8_t* out, size_t* out_len);
+
+#endif // HEX_CODEC_H
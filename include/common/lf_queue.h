@@ -0,0 +1,41 @@
+#ifndef LF_QUEUE_H
+#define LF_QUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// 칸 하나 (순번으로 비었는지/찼는지 구분)
+typedef struct {
+    size_t seq;
+    void* item;
+} LfQueueCell;
+
+/**
+ * 고정 크기 무잠금 큐 (다중 생산자/다중 소비자, 포인터 항목)
+ * 용량은 2의 거듭제곱으로 올림
+ */
+typedef struct {
+    LfQueueCell* cells;
+    size_t mask;
+    char pad0[64];
+    size_t head;         // 다음에 넣을 위치
+    char pad1[64];
+    size_t tail;         // 다음에 꺼낼 위치
+    char pad2[64];
+} LfQueue;
+
+int lf_queue_init(LfQueue* queue, size_t capacity);
+void lf_queue_free(LfQueue* queue);
+
+// 넣기/꺼내기 (가득 찼거나 비었으면 즉시 false)
+bool lf_queue_try_push(LfQueue* queue, void* item);
+bool lf_queue_try_pop(LfQueue* queue, void** item);
+
+// 성공할 때까지 대기 (짧게 돌다가 양보, 그다음 잠깐 잠듦)
+void lf_queue_push(LfQueue* queue, void* item);
+void* lf_queue_pop(LfQueue* queue);
+
+// 대기 루프용 백오프 (spins는 호출자가 0부터 증가시키며 전달)
+void lf_backoff(unsigned spins);
+
+#endif // LF_QUEUE_H
@@ -0,0 +1,53 @@
+#ifndef MAC_BACKEND_H
+#define MAC_BACKEND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "evp_cache.h"
+
+// MAC 계산/검증 함수 (AlgorithmConfig.ops.mac 슬롯과 같은 형태)
+typedef int (*MacFunction)(const unsigned char* key, size_t key_len, const unsigned char* input, size_t input_len,
+                           unsigned char* tag, size_t tag_len);
+typedef int (*MacVerifyFunction)(const unsigned char* key, size_t key_len, const unsigned char* input,
+                                 size_t input_len, const unsigned char* tag, size_t tag_len);
+
+// 검증에서 다시 계산하는 태그의 최대 길이 (바이트)
+#define MAC_BACKEND_MAX_TAG 64
+
+// MAC 백엔드 (CMAC/HMAC 실행기가 공유)
+typedef struct {
+    MacFunction mac_function;
+    MacVerifyFunction mac_verify;
+} MacBackend;
+
+// 백엔드 설정 (NULL인 슬롯은 fallback의 함수 사용)
+void mac_backend_set(MacBackend* backend, MacFunction mac_function, MacVerifyFunction mac_verify,
+                     const MacBackend* fallback);
+
+/**
+ * EVP MAC으로 태그 계산 후 앞 tag_len 바이트만 복사
+ * @param param_name 알고리즘 매개변수 이름 (OSSL_MAC_PARAM_CIPHER, OSSL_MAC_PARAM_DIGEST 등)
+ * @param full_len 알고리즘의 전체 태그 길이
+ * @return SUCCESS, ERR_CRYPTO_INIT 또는 ERR_CRYPTO_OPERATION
+ */
+int mac_backend_evp(EvpCacheMacId id, const char* param_name, const char* param_value,
+                    const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                    unsigned char* tag, size_t tag_len, size_t full_len);
+
+// mac_function으로 태그를 다시 계산해 앞 tag_len 바이트를 상수 시간으로 비교
+int mac_backend_verify(MacFunction mac_function, const unsigned char* key, size_t key_len,
+                       const unsigned char* message, size_t message_len, const unsigned char* tag, size_t tag_len);
+
+/**
+ * 수동 테스트 입력: 16진수 한 줄 (빈 줄이면 길이 0)
+ * @return SUCCESS 또는 ERR_INVALID_INPUT
+ */
+int mac_backend_read_hex(const char* prompt, uint8_t* buf, size_t size, size_t* len);
+
+// 수동 테스트 입력: 메시지 (input_type_id 0은 텍스트, 그 외는 16진수)
+int mac_backend_read_message(int input_type_id, uint8_t* message, size_t size, size_t* len);
+
+// 수동 테스트 태그 출력
+void mac_backend_print_tag(const char* label, const uint8_t* tag, size_t tag_len);
+
+#endif // MAC_BACKEND_H
@@ -0,0 +1,79 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * 하드웨어 성능 카운터 프로파일링 (Linux perf_event_open)
+ * --perf로 켰을 때만 동작하고, 꺼져 있으면 호출부의 비용은 분기 하나
+ *
+ * 알고리즘 커널 호출(해시 한 번, update 한 번, 배치 한 번)을 begin/end로 감싸면
+ * 스레드별 카운터 그룹 값을 호출 전후로 읽어 차이를 "알고리즘 + 메시지 크기 구간"별로 누적
+ * 사용자 공간 실행만 세므로 카운터 읽기 시스템 호출 자체는 거의 포함되지 않음
+ */
+
+// 수집하는 카운터 (하나의 그룹으로 열어 같은 구간을 동시에 셈)
+typedef enum {
+    PERF_EV_CYCLES = 0,
+    PERF_EV_INSTRUCTIONS,
+    PERF_EV_BRANCH_MISSES,
+    PERF_EV_L1D_MISSES,          // L1D 읽기 미스
+    PERF_EV_LLC_MISSES,          // 마지막 단계 캐시 읽기 미스
+    PERF_EV_FRONTEND_STALLS,     // 프런트엔드 정체 사이클
+    PERF_EV_TASK_CLOCK,          // 실행 시간 (ns, 소프트웨어 카운터)
+    PERF_EV_COUNT
+} PerfEvent;
+
+// 메시지 크기 구간: <64B, 64B-256B, ... 4배씩, 마지막은 1MB 이상
+#define PERF_SIZE_BUCKETS 9
+
+// 커널 호출 시작 시점의 카운터 값
+typedef struct {
+    bool active;
+    uint64_t time_enabled;
+    uint64_t time_running;
+    uint64_t values[PERF_EV_COUNT];
+} PerfMark;
+
+// 프로파일링 켜짐 여부 (시작 전에 한 번만 바뀌므로 잠금 없이 읽음)
+extern bool g_perf_profile_enabled;
+
+const char* perf_event_name(PerfEvent event);
+
+/**
+ * 프로파일링 켜기
+ * 호출 스레드에서 카운터 그룹을 열어 사용 가능한지 확인
+ * @return SUCCESS(카운터가 하나라도 열림), ERR_NOT_SUPPORTED(Linux 외 또는 권한/하드웨어 없음)
+ */
+int perf_profile_enable(void);
+
+// 이후 커널 호출을 누적할 알고리즘 이름 (스레드별, 정적 문자열이어야 함)
+void perf_profile_set_label(const char* label);
+const char* perf_profile_label(void);
+
+void perf_profile_start(PerfMark* mark);
+void perf_profile_stop(PerfMark* mark, size_t bytes, size_t ops);
+
+/**
+ * 커널 호출 구간 시작/끝
+ * bytes/ops(호출 한 번에 처리한 메시지당 평균 크기)로 크기 구간을 정함
+ */
+static inline void perf_profile_begin(PerfMark* mark) {
+    mark->active = g_perf_profile_enabled;
+    if (mark->active) {
+        perf_profile_start(mark);
+    }
+}
+
+static inline void perf_profile_end(PerfMark* mark, size_t bytes, size_t ops) {
+    if (mark->active) {
+        perf_profile_stop(mark, bytes, ops);
+    }
+}
+
+// 알고리즘, 크기 구간별 요약 출력 (모든 작업 스레드가 끝난 뒤 호출)
+void perf_profile_report(void);
+
+#endif // PERF_COUNTERS_H
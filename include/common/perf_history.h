@@ -0,0 +1,85 @@
+#ifndef PERF_HISTORY_H
+#define PERF_HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * 성능 기록과 회귀 비교
+ * --bench와 --batch 실행마다 측정값을 기록 파일에 한 줄씩 덧붙이고 (탭 구분),
+ * --compare로 최근 실행을 기준 기록과 비교해 통계적으로 의미 있는 처리량 저하를 표시
+ *
+ * 기록 파일: CRYPTO_TEST_PERF_HISTORY (경로, "off"면 기록 안 함), 기본 test_vectors/perf_history.tsv
+ */
+
+#define PERF_HISTORY_DEFAULT_PATH "test_vectors/perf_history.tsv"
+
+// 기록 형식 버전 (줄 맨 앞 필드, v1 기록은 실행 ID 없이 읽음)
+#define PERF_HISTORY_VERSION "v2"
+
+// 회귀 판정 기본 임계값 (기준 중앙값 대비 처리량 감소율)
+#define PERF_HISTORY_DEFAULT_THRESHOLD 0.05
+
+// 잡음 대비 차이 배수 (1.4826 * MAD를 표준편차 추정값으로 사용)
+#define PERF_HISTORY_NOISE_SIGMAS 3.0
+
+// 실행 간 잡음을 추정하는 최소 기준 실행 수 (반복 측정이 없는 batch 기록은 이보다 적으면 판정 보류)
+#define PERF_HISTORY_MIN_RUNS 3
+
+// 측정값 한 건
+typedef struct {
+    long long timestamp;        // 실행 시작 시각 (유닉스 초, 같은 실행의 기록은 같은 값)
+    char run_id[32];            // 실행 ID ("시각-프로세스 ID", 같은 초에 시작한 실행도 구분)
+    char commit[48];
+    char host[64];
+    char cpu_model[128];
+    char mode[8];               // "bench" 또는 "batch"
+    char algorithm[64];
+    char backend[192];          // describe_algorithm_backend 결과
+    char path[256];             // bench: oneshot/stream/batch/mac/mac-rotate/verify-many, batch: "디렉토리/파일"
+    uint64_t size;              // 메시지 크기 (batch는 요청 파일 크기)
+    double mb_per_sec;          // 처리량 (반복 측정의 중앙값)
+    double mad;                 // 반복 측정 처리량의 중앙값 절대 편차 (반복이 없으면 0)
+    int trials;
+} PerfHistoryRecord;
+
+// 기록 파일 경로 (NULL이면 기록 안 함)
+const char* perf_history_path(void);
+
+// 기록 파일 경로 지정 (--history, 환경 변수보다 우선)
+void perf_history_set_path(const char* path);
+
+/**
+ * 실행 정보(시각, 실행 ID, 커밋, 호스트, CPU 모델)와 mode를 채운 새 기록
+ * 같은 프로세스의 기록은 모두 같은 시각과 실행 ID를 사용
+ */
+void perf_history_record_init(PerfHistoryRecord* record, const char* mode);
+
+/**
+ * 기록 파일에 덧붙이기 (경로가 없으면 아무것도 하지 않음)
+ * @return SUCCESS, ERR_FILE_CREATE, ERR_FILE_WRITE
+ */
+int perf_history_append(const PerfHistoryRecord* records, size_t count);
+
+/**
+ * 기록 파일 읽기 (형식이 맞지 않는 줄은 건너뜀)
+ * @return SUCCESS, ERR_FILE_OPEN, ERR_MEMORY_ALLOC
+ */
+int perf_history_load(const char* path, PerfHistoryRecord** records, size_t* count);
+
+/**
+ * 기록 파일에서 모드별로 최근 실행과 같은 커밋의 실행을 모두 baseline_path로 저장 (기존 파일은 덮어씀)
+ */
+int perf_history_save_baseline(const char* baseline_path);
+
+/**
+ * 모드별 최근 실행을 기준 파일의 같은 (CPU, 모드, 알고리즘, 백엔드, 경로, 크기) 기록과 비교
+ * 기준은 여러 실행의 중앙값과 MAD, 잡음은 실행 간 MAD와 실행 내 MAD 중 큰 값
+ * 감소율이 threshold를 넘고 차이가 잡음의 PERF_HISTORY_NOISE_SIGMAS배를 넘으면 회귀
+ * 기준 실행이 PERF_HISTORY_MIN_RUNS회 미만이고 반복 측정도 없으면 잡음을 알 수 없으므로 판정 보류
+ * @return 회귀가 없으면 SUCCESS, 있으면 ERR_TEST_FAILED
+ */
+int run_perf_compare(const char* baseline_path, double threshold);
+
+#endif // PERF_HISTORY_H
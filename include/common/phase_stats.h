@@ -0,0 +1,88 @@
+#ifndef PHASE_STATS_H
+#define PHASE_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 실행 단계별 시간 계측
+ * CRYPTO_TEST_PHASES로 빌드했을 때만 동작하고 (make PHASES=1),
+ * 그 외에는 모든 PHASE_* 매크로가 빈 문장이 되어 비용이 없음
+ *
+ * 각 구간은 안쪽에 중첩된 다른 구간 시간을 뺀 자기 시간만 기록하므로
+ * 단계별 합계를 그대로 더해도 중복이 없음
+ */
+
+// 계측 단계
+typedef enum {
+    PHASE_PARSE = 0,     // 토큰화, 레코드 디코딩, 캐시 열기
+    PHASE_HEX,           // 16진수 디코딩
+    PHASE_CRYPTO,        // 해시/암호 연산
+    PHASE_FORMAT,        // 응답 레코드 작성
+    PHASE_IO,            // 파일 쓰기
+    PHASE_COMPARE,       // 정답 비교
+    PHASE_WAIT,          // 파이프라인 배치 대기
+    PHASE_COUNT
+} Phase;
+
+// 히스토그램 구간 수 (구간 i는 [2^i, 2^(i+1)) 틱)
+#define PHASE_HIST_BUCKETS 48
+
+// 단계 하나의 누적값
+typedef struct {
+    uint64_t count;
+    uint64_t ticks;
+    uint64_t hist[PHASE_HIST_BUCKETS];
+} PhaseCounter;
+
+// 구간 시작 표시 (중첩 구간 시간을 빼기 위해 시작 시점의 하위 누적값도 기록)
+typedef struct {
+    uint64_t start;
+    uint64_t child;
+} PhaseMark;
+
+const char* phase_name(Phase phase);
+
+#ifdef CRYPTO_TEST_PHASES
+
+PhaseMark phase_begin(void);
+void phase_end(const PhaseMark* mark, Phase phase);
+
+/**
+ * 파일 단위 계측 범위 ("알고리즘 파일" 이름으로 요약에 표시)
+ * 범위를 연 스레드와 그 범위를 넘겨받은 작업 스레드의 기록이 범위별로 모임
+ */
+void* phase_scope_open(const char* algo_name, const char* label);
+void phase_scope_close(void* scope);
+
+// 현재 스레드의 범위 (작업 스레드에 넘길 때 사용)
+void* phase_scope_current(void);
+
+// 작업 스레드가 범위 참여/이탈 (이탈 시 스레드 누적값을 범위에 합침)
+void phase_thread_attach(void* scope);
+void phase_thread_detach(void);
+
+// 전체와 파일별 요약 출력 (모든 작업 스레드가 끝난 뒤 호출)
+void phase_stats_report(void);
+
+#define PHASE_START(mark) PhaseMark mark = phase_begin()
+#define PHASE_STOP(mark, phase) phase_end(&(mark), (phase))
+#define PHASE_SCOPE_OPEN(var, algo_name, label) void* var = phase_scope_open((algo_name), (label))
+#define PHASE_SCOPE_CLOSE(var) phase_scope_close(var)
+#define PHASE_THREAD_ATTACH(scope) phase_thread_attach(scope)
+#define PHASE_THREAD_DETACH() phase_thread_detach()
+#define PHASE_REPORT() phase_stats_report()
+
+#else
+
+#define PHASE_START(mark) ((void)0)
+#define PHASE_STOP(mark, phase) ((void)0)
+#define PHASE_SCOPE_OPEN(var, algo_name, label) ((void)0)
+#define PHASE_SCOPE_CLOSE(var) ((void)0)
+#define PHASE_THREAD_ATTACH(scope) ((void)0)
+#define PHASE_THREAD_DETACH() ((void)0)
+#define PHASE_REPORT() ((void)0)
+
+#endif // CRYPTO_TEST_PHASES
+
+#endif // PHASE_STATS_H
@@ -0,0 +1,80 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "record_batch.h"
+#include "lf_queue.h"
+
+// 파이프라인이 주고받는 배치 (레코드와 레코드별 결과)
+typedef struct {
+    RecordBatch records;
+    uint8_t* results;    // result_size * batch_records 바이트
+    size_t seq;          // 제출 순번 (출력 순서)
+} PipelineBatch;
+
+/**
+ * 배치 하나 계산 (작업 스레드에서 호출, 서로 다른 배치에 대해 동시에 호출됨)
+ * results[i * result_size]에 레코드 i의 결과 기록
+ */
+typedef int (*PipelineComputeFn)(void* user, const RecordBatch* batch, uint8_t* results);
+
+// 계산된 배치 출력 (출력 스레드에서 제출 순서대로 호출)
+typedef int (*PipelineEmitFn)(void* user, const RecordBatch* batch, const uint8_t* results);
+
+// 파이프라인 설정
+typedef struct {
+    size_t batch_records;        // 배치당 레코드 수
+    size_t columns;              // 레코드 열 수
+    size_t arena_block;          // 배치 아레나 블록 크기
+    size_t result_size;          // 레코드당 결과 바이트
+    PipelineComputeFn compute;
+    PipelineEmitFn emit;
+    void* user;
+} PipelineConfig;
+
+/**
+ * 파일 내부 레코드 파이프라인: 읽기(호출 스레드) → 계산(작업 스레드 N개) → 순서 복원 출력(출력 스레드)
+ * 단계 사이는 무잠금 큐로 연결하고, 작업 스레드가 0개면 호출 스레드에서 바로 계산/출력
+ */
+typedef struct {
+    PipelineConfig config;
+    int workers;
+    size_t pool_size;            // 동시에 돌고 있는 배치 최대 수
+    PipelineBatch* pool;
+    PipelineBatch** reorder;     // 순서 복원 창 (seq % pool_size)
+    LfQueue free_queue;          // 빈 배치
+    LfQueue work_queue;          // 계산할 배치 (종료 시 NULL)
+    LfQueue done_queue;          // 계산이 끝난 배치
+    pthread_t* threads;
+    pthread_t writer;
+    size_t submitted;            // 제출한 배치 수
+    bool closed;                 // 더 제출하지 않음
+    int status;                  // 첫 번째 오류
+    const char* perf_label;      // 작업 스레드가 이어받는 카운터 프로파일링 이름
+#ifdef CRYPTO_TEST_PHASES
+    void* phase_scope;           // 작업/출력 스레드가 이어받는 계측 범위
+#endif
+} Pipeline;
+
+// 파일 하나에 쓸 기본 작업 스레드 수 (CRYPTO_TEST_PIPELINE_WORKERS가 있으면 우선)
+int pipeline_default_workers(void);
+void pipeline_set_default_workers(int workers);
+
+int pipeline_start(Pipeline* pipe, const PipelineConfig* config, int workers);
+
+// 채울 빈 배치 얻기 (모두 사용 중이면 반환될 때까지 대기)
+PipelineBatch* pipeline_acquire(Pipeline* pipe);
+
+// 채운 배치 제출 (빈 배치도 가능)
+void pipeline_submit(Pipeline* pipe, PipelineBatch* batch);
+
+// 계산/출력 중 오류가 났는지 (읽기 단계 조기 종료용)
+bool pipeline_failed(Pipeline* pipe);
+
+// 제출한 배치를 모두 출력할 때까지 기다리고 정리 (첫 번째 오류 반환)
+int pipeline_finish(Pipeline* pipe);
+
+#endif // PIPELINE_H
@@ -0,0 +1,60 @@
+#ifndef RECORD_BATCH_H
+#define RECORD_BATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "arena.h"
+#include "vector_reader.h"
+
+// 레코드당 최대 필드(열) 수 (Key/Msg/Mac 등)
+#define RECORD_BATCH_MAX_COLUMNS 4
+
+/**
+ * 구조체 배열(SoA) 형태의 레코드 배치
+ * 열마다 정수 값, 원문 뷰, 디코딩된 바이트를 따로 연속 배열로 보관
+ * 디코딩된 바이트는 배치 아레나에 두고 reset에서 한 번에 비움
+ */
+typedef struct {
+    size_t count;                                   // 채워진 레코드 수
+    size_t capacity;                                // 최대 레코드 수
+    size_t columns;                                 // 사용하는 열 수
+    long long* num[RECORD_BATCH_MAX_COLUMNS];       // 정수 필드 (Len, Tlen 등)
+    StrView* text[RECORD_BATCH_MAX_COLUMNS];        // 원문 값 (에코 출력용)
+    const uint8_t** data[RECORD_BATCH_MAX_COLUMNS]; // 디코딩된 바이트
+    size_t* len[RECORD_BATCH_MAX_COLUMNS];          // 디코딩된 바이트 길이
+    Arena arena;                                    // 디코딩 버퍼 저장소
+    void* storage;                                  // 열 배열 전체 (한 번에 할당)
+} RecordBatch;
+
+int record_batch_init(RecordBatch* batch, size_t capacity, size_t columns, size_t arena_block);
+void record_batch_free(RecordBatch* batch);
+
+// 레코드와 아레나를 모두 비움 (메모리는 재사용)
+void record_batch_reset(RecordBatch* batch);
+
+static inline bool record_batch_full(const RecordBatch* batch) {
+    return batch->count >= batch->capacity;
+}
+
+/**
+ * 새 레코드 추가 (모든 열을 0으로 초기화)
+ * @return 레코드 인덱스, 가득 차면 capacity
+ */
+size_t record_batch_push(RecordBatch* batch);
+
+/**
+ * 16진수 원문을 아레나에 디코딩해 열에 저장
+ * @param out_cap 최대 디코딩 바이트 수
+ * @return SUCCESS, ERR_MEMORY_ALLOC 또는 hex_decode 오류
+ */
+int record_batch_set_hex(RecordBatch* batch, size_t index, size_t column, StrView hex, size_t out_cap);
+
+/**
+ * 16진수 원문이 정확히 len 바이트일 때만 디코딩해 저장 (Len/Mlen 필드와 Msg 길이 검사)
+ * len이 0이면 빈 값이나 자리 표시 "00"만 허용 (CAVP 파일의 빈 메시지 표기)
+ * @return SUCCESS, 길이가 다르면 ERR_INVALID_FORMAT, 그 외 record_batch_set_hex 오류
+ */
+int record_batch_set_hex_exact(RecordBatch* batch, size_t index, size_t column, StrView hex, size_t len);
+
+#endif // RECORD_BATCH_H
@@ -0,0 +1,54 @@
+#ifndef RECORD_INDEX_H
+#define RECORD_INDEX_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "vector_schema.h"
+
+// 선택자 하나에 들어가는 최대 조건 수
+#define RECORD_SELECTOR_MAX_TERMS 8
+#define RECORD_SELECTOR_MAX_KEY 32
+#define RECORD_SELECTOR_MAX_VALUE 128
+
+// 레코드 번호 범위 (1부터, 양 끝 포함)
+typedef struct {
+    size_t first;
+    size_t last;
+} RecordRange;
+
+// 필드 조건 "key=value"
+typedef struct {
+    char key[RECORD_SELECTOR_MAX_KEY];
+    char value[RECORD_SELECTOR_MAX_VALUE];
+} RecordCondition;
+
+/**
+ * 레코드 선택자
+ * 쉼표로 구분한 항목: "12"(레코드 번호), "10-20"(범위), "Count=3", "mod=2048" 등
+ * 범위는 하나라도 맞으면, 필드 조건은 모두 맞아야 선택 (섹션 값도 조건으로 사용 가능)
+ */
+typedef struct {
+    RecordRange ranges[RECORD_SELECTOR_MAX_TERMS];
+    size_t range_count;
+    RecordCondition conditions[RECORD_SELECTOR_MAX_TERMS];
+    size_t condition_count;
+} RecordSelector;
+
+// 선택자 문자열 해석 (형식 오류면 ERR_INVALID_INPUT)
+int record_selector_parse(const char* spec, RecordSelector* selector);
+
+// 디코딩된 레코드가 선택자에 맞는지 (record는 0부터)
+bool record_selector_match(const RecordSelector* selector, const DecodedVectors* decoded, size_t record);
+
+/**
+ * 벡터 파일에서 선택한 레코드만 뽑아 새 파일로 기록
+ * 레코드 위치는 .vbin 캐시의 레코드 범위(원본 해시로 갱신되는 색인)에서 바로 찾고,
+ * 헤더와 선택한 레코드 앞의 섹션/이어지는 값 줄을 함께 기록해 같은 형식의 작은 파일을 만듦
+ * @param selected 뽑은 레코드 수 (NULL 가능)
+ * @param total 원본 파일의 전체 레코드 수 (NULL 가능)
+ * @return SUCCESS, ERR_FILE_OPEN, ERR_FILE_CREATE, ERR_INVALID_FORMAT
+ */
+int record_index_extract(const char* input_path, const char* output_path, const RecordSelector* selector,
+                         size_t* selected, size_t* total);
+
+#endif // RECORD_INDEX_H
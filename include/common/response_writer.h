@@ -0,0 +1,48 @@
+#ifndef RESPONSE_WRITER_H
+#define RESPONSE_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// 기본 출력 버퍼 크기
+#define RESPONSE_WRITER_BUFFER_SIZE (256 * 1024)
+
+/**
+ * .rsp 응답 파일 출력기 (큰 사용자 공간 버퍼에 모아 큰 단위로 write)
+ * 경로가 .gz/.zst로 끝나면 버퍼를 비울 때마다 압축해서 기록
+ */
+typedef struct {
+    int fd;              // 출력 파일 디스크립터
+    char* buf;           // 출력 버퍼
+    size_t cap;          // 버퍼 크기
+    size_t len;          // 버퍼에 쌓인 바이트 수
+    int error;           // 첫 번째 쓰기 오류 (SUCCESS면 정상)
+    void* sink;          // 압축기 (압축 출력일 때만)
+} ResponseWriter;
+
+// 파일 열기/닫기 (close는 남은 버퍼를 기록하고 누적 오류를 반환)
+int response_writer_open(ResponseWriter* writer, const char* path);
+int response_writer_close(ResponseWriter* writer);
+int response_writer_flush(ResponseWriter* writer);
+
+// 확장자와 관계없이 압축하지 않고 기록 (이미 압축된 내용 복사용)
+int response_writer_open_raw(ResponseWriter* writer, const char* path);
+
+// 원시 데이터 기록
+void rw_write(ResponseWriter* writer, const char* data, size_t len);
+void rw_puts(ResponseWriter* writer, const char* str);
+void rw_putc(ResponseWriter* writer, char ch);
+
+// 바이트를 버퍼 안에서 바로 16진수로 인코딩
+void rw_hex(ResponseWriter* writer, const uint8_t* bytes, size_t len);
+
+// 10진수 기록
+void rw_int(ResponseWriter* writer, long long value);
+
+// "key = value\n" 형식 필드 기록
+void rw_field_hex(ResponseWriter* writer, const char* key, const uint8_t* bytes, size_t len);
+void rw_field_int(ResponseWriter* writer, const char* key, long long value);
+void rw_field_str(ResponseWriter* writer, const char* key, const char* value, size_t value_len);
+
+#endif // RESPONSE_WRITER_H
@@ -0,0 +1,42 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 결과 캐시 하위 디렉토리 (.vbin 캐시 디렉토리 아래)
+#define RESULT_CACHE_SUBDIR "results"
+
+// 캐시된 판정
+typedef enum {
+    RESULT_CACHE_MISS = 0,
+    RESULT_CACHE_PASSED,      // 정답과 일치했던 응답
+    RESULT_CACHE_GENERATED    // 정답 파일 없이 생성만 했던 응답
+} ResultCacheVerdict;
+
+// 결과 캐시 키 (요청/정답 내용, 백엔드, 빌드의 해시)
+typedef struct {
+    uint8_t digest[32];
+} ResultCacheKey;
+
+/**
+ * 캐시 키 계산
+ * 요청 파일 내용, 정답 파일 내용(없으면 빈 값), 백엔드 식별 문자열, 빌드 지문을 함께 해시
+ * @return SUCCESS, ERR_FILE_OPEN(요청 파일), ERR_CRYPTO_OPERATION
+ */
+int result_cache_key(const char* request_path, const char* expected_path, const char* backend_id,
+                     ResultCacheKey* key);
+
+/**
+ * 캐시된 응답이 있으면 output_path로 복사하고 판정을 돌려줌
+ * @return 캐시가 없거나 복사에 실패하면 RESULT_CACHE_MISS
+ */
+ResultCacheVerdict result_cache_lookup(const ResultCacheKey* key, const char* output_path);
+
+// 통과/생성 결과만 저장 (실패한 파일은 매번 다시 계산)
+void result_cache_store(const ResultCacheKey* key, const char* output_path, ResultCacheVerdict verdict);
+
+// 빌드 지문 (컴파일 시각과 컴파일러)
+const char* result_cache_build_id(void);
+
+#endif // RESULT_CACHE_H
@@ -0,0 +1,47 @@
+#ifndef RESULT_COMPARE_H
+#define RESULT_COMPARE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// 보고서에 자세히 남길 최대 레코드 수
+#define COMPARE_MAX_DIFFS 8
+
+// 보고서에 출력할 값의 최대 16진수 문자 수
+#define COMPARE_MAX_VALUE_HEX 32
+
+/**
+ * 결과 파일과 정답 파일의 레코드 비교 결과
+ * diff에는 다른 레코드마다 위치(섹션, 기준 필드)와 다른 필드가 한 줄씩 기록됨
+ */
+typedef struct {
+    size_t records;       // 정답 레코드 수
+    size_t mismatched;    // 필드 값이 다른 레코드 수
+    size_t missing;       // 결과 파일에 없는 정답 레코드 수
+    size_t extra;         // 정답 파일에 없는 결과 레코드 수
+    char* diff;           // 레코드별 차이 보고서 (차이가 없으면 NULL)
+    size_t diff_len;
+    size_t diff_cap;
+} CompareReport;
+
+/**
+ * 두 벡터 파일을 정답 파일 이름의 스키마로 디코딩해 레코드 단위로 비교
+ * 레코드는 섹션 값, 기준 필드(Count/Len 등)와 같은 키 안의 순번으로 짝지으므로
+ * 순서가 바뀌어도 같은 레코드끼리 비교하고, 바이트 필드는 디코딩된 값으로 비교
+ * 정답 파일은 .vbin 캐시를 거쳐 읽음
+ * @return SUCCESS(report에 결과), ERR_FILE_OPEN, ERR_INVALID_FORMAT(정답 레코드 없음 또는 디코딩 실패)
+ */
+int compare_vector_files(const char* output_file, const char* expected_file, CompareReport* report);
+
+// allow_extra가 true면 정답 파일에 없는 결과 레코드는 무시 (정답 일부만 뽑아 비교할 때)
+int compare_vector_files_ex(const char* output_file, const char* expected_file, bool allow_extra,
+                            CompareReport* report);
+
+void compare_report_free(CompareReport* report);
+
+// 다른 레코드 수 (0이면 완전 일치)
+static inline size_t compare_report_failures(const CompareReport* report) {
+    return report->mismatched + report->missing + report->extra;
+}
+
+#endif // RESULT_COMPARE_H
@@ -0,0 +1,76 @@
+#ifndef VECTOR_CACHE_H
+#define VECTOR_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "vector_reader.h"
+#include "vector_schema.h"
+
+// 기본 캐시 디렉토리 (CRYPTO_TEST_VBIN_DIR 환경 변수로 변경, "off"면 캐시 사용 안 함)
+#define VECTOR_CACHE_DEFAULT_DIR "test_vectors/cache"
+
+// .vbin 파일 형식
+#define VBIN_MAGIC "CTVBIN\0\0"
+#define VBIN_VERSION 3
+#define VBIN_ENDIAN_MARK 0x01020304u
+#define VBIN_SCHEMA_NAME_SIZE 32
+
+// 이보다 큰 스트리밍 필드 값(LongMsg의 Msg 등)은 .vbin에 넣지 않고 원본에서 청크 단위로 디코딩
+#define VECTOR_CACHE_STREAM_MIN (64 * 1024)
+
+/**
+ * .vbin 파일 헤더
+ * 헤더 뒤에 values(SchemaValue 배열), spans(SchemaSpan 배열), payload 순서로 배치
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;                         // 기록한 시스템의 바이트 순서 확인용
+    char schema[VBIN_SCHEMA_NAME_SIZE];      // 스키마 이름
+    uint64_t schema_hash;                    // 스키마 필드 구성(이름/종류/플래그/순서)의 해시
+    uint8_t source_hash[32];                 // 원본 요청 파일의 SHA-256
+    uint64_t source_size;
+    uint64_t field_count;
+    uint64_t record_count;
+    uint64_t header_len;
+    uint64_t values_offset;
+    uint64_t spans_offset;
+    uint64_t payload_offset;
+    uint64_t payload_len;
+} VbinHeader;
+
+/**
+ * 캐시를 거친 디코딩 결과
+ * 원본 파일은 항상 매핑해 두므로 헤더 에코와 값 원문, 원문만 기록한 큰 값은 source에서 읽음
+ */
+typedef struct {
+    DecodedVectors vectors;   // 레코드 (캐시 적중이면 mapping을 가리킴)
+    VectorReader source;      // 원본 요청 파일
+    VectorReader mapping;     // .vbin 매핑
+    bool from_cache;          // .vbin에서 읽었는지
+} VectorCache;
+
+/**
+ * 요청 파일을 스키마로 디코딩 (캐시 우선)
+ * 원본 내용의 해시로 .vbin을 찾아 유효하면 그대로 매핑하고,
+ * 없거나 맞지 않으면 원본을 디코딩한 뒤 .vbin을 새로 기록 (기록 실패는 무시)
+ * @return SUCCESS, ERR_FILE_OPEN 또는 schema_decode 오류
+ */
+int vector_cache_open(VectorCache* cache, const VectorSchema* schema, const char* path);
+void vector_cache_close(VectorCache* cache);
+
+// 캐시 키로 쓰는 내용 해시 (SHA-256)
+int vector_cache_content_hash(const void* data, size_t size, uint8_t hash[32]);
+
+// 캐시 디렉토리 지정 (NULL이면 캐시 사용 안 함, 환경 변수가 우선)
+void vector_cache_set_dir(const char* dir);
+const char* vector_cache_dir(void);
+
+/**
+ * 이 요청 파일에 캐시를 쓸지
+ * 압축 파일은 캐시가 풀린 전체 내용을 참조하므로 쓰지 않고 해제 스트림으로 읽어 메모리를 창 크기로 유지
+ */
+bool vector_cache_enabled_for(const char* path);
+
+#endif // VECTOR_CACHE_H
@@ -0,0 +1,89 @@
+#ifndef VECTOR_READER_H
+#define VECTOR_READER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// 문자열 뷰 (NUL 종료 아님, 매핑된 파일을 직접 가리킴)
+typedef struct {
+    const char* ptr;
+    size_t len;
+} StrView;
+
+// 토큰 유형
+typedef enum {
+    VEC_TOKEN_BLANK,     // 빈 줄
+    VEC_TOKEN_COMMENT,   // '#'로 시작하는 줄
+    VEC_TOKEN_SECTION,   // [L = 32], [mod = 2048] 등 섹션 헤더
+    VEC_TOKEN_FIELD,     // key = value
+    VEC_TOKEN_OTHER      // 그 외 줄
+} VecTokenType;
+
+// 토큰 (모든 뷰는 리더를 닫기 전까지 유효)
+typedef struct {
+    VecTokenType type;
+    StrView line;        // 줄 전체 (개행 제외)
+    StrView key;         // 필드/섹션 키 (공백 제거)
+    StrView value;       // 필드/섹션 값 (공백 제거)
+    StrView section;     // 현재 섹션 헤더 (대괄호 안쪽)
+    size_t offset;       // 줄 시작 바이트 오프셋
+} VecToken;
+
+/**
+ * CAVP 벡터 파일 리더 (파일 전체를 mmap, 줄 길이 제한 없음)
+ * .gz/.zst 파일은 백그라운드 스레드가 고정 버퍼에 풀어 주고,
+ * 리더는 풀린 부분까지 토큰화하며 뒤따라감 (size는 지금까지 풀린 크기)
+ */
+typedef struct {
+    const char* data;    // 매핑된 파일 내용
+    size_t size;         // 파일 크기
+    size_t pos;          // 다음 줄 시작 위치
+    StrView section;     // 현재 섹션
+    void* map_base;      // 매핑 해제용 기준 주소
+    size_t map_size;
+    void* stream;        // 압축 해제 스트림 (압축 파일일 때만)
+    size_t scan;         // 개행을 찾아 본 위치 (압축 파일일 때만)
+#ifdef _WIN32
+    void* file_handle;
+    void* map_handle;
+#endif
+} VectorReader;
+
+// 파일 열기/닫기 (.gz, .zst 확장자면 압축을 풀며 읽음)
+int vector_reader_open(VectorReader* reader, const char* path);
+void vector_reader_close(VectorReader* reader);
+
+// 압축 여부와 관계없이 파일 바이트를 그대로 매핑
+int vector_reader_open_raw(VectorReader* reader, const char* path);
+
+/**
+ * 압축 해제가 끝날 때까지 대기 (이후 data/size가 파일 전체를 가리킴)
+ * 파일 전체가 필요한 곳(해시, 디코딩 캐시)에서 호출, 일반 파일이면 바로 반환
+ * @return SUCCESS 또는 ERR_FILE_READ(손상된 압축 파일)
+ */
+int vector_reader_wait(VectorReader* reader);
+
+/**
+ * upto 앞의 내용은 더 이상 쓰지 않음 (압축 파일이면 그 메모리를 반환, 일반 파일이면 아무 일도 안 함)
+ * 토큰 뷰를 넘겨받은 출력 단계에서 기록을 마친 뒤 호출 (다른 스레드에서 호출 가능)
+ */
+void vector_reader_release(const VectorReader* reader, const char* upto);
+
+// 압축 해제 오류 (토큰을 끝까지 읽은 뒤 확인, 일반 파일이면 항상 SUCCESS)
+int vector_reader_error(const VectorReader* reader);
+
+// 메모리 버퍼를 대상으로 리더 초기화 (복사하지 않음)
+void vector_reader_init_buffer(VectorReader* reader, const char* data, size_t size);
+
+// 다음 토큰 읽기 (파일 끝이면 false)
+bool vector_reader_next(VectorReader* reader, VecToken* token);
+
+// 다음 FIELD 토큰까지 건너뛰기 (파일 끝이면 false)
+bool vector_reader_next_field(VectorReader* reader, VecToken* token);
+
+// 뷰 유틸리티
+bool strview_eq(StrView view, const char* str);
+bool strview_starts_with(StrView view, const char* prefix);
+long long strview_to_ll(StrView view, bool* ok);
+
+#endif // VECTOR_READER_H
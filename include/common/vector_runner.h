@@ -0,0 +1,92 @@
+#ifndef VECTOR_RUNNER_H
+#define VECTOR_RUNNER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "vector_reader.h"
+#include "vector_cache.h"
+#include "response_writer.h"
+#include "record_batch.h"
+#include "pipeline.h"
+
+/**
+ * 요청 파일 실행기 공용 부분
+ * 요청 파일을 캐시나 토크나이저로 읽어 레코드 파이프라인에 넣고, 응답은 요청 원문에 결과 줄을 끼워 기록
+ */
+
+// 실행 중 파이프라인 콜백이 쓰는 출력과 원본 (vector_runner_run이 채움)
+typedef struct {
+    ResponseWriter out;
+    const VectorReader* source;  // 토크나이저로 읽을 때 원본 (출력을 마친 앞부분을 놓아줌, 캐시를 쓰면 NULL)
+} RunnerIo;
+
+// 캐시로 디코딩한 레코드로 배치 채우기 (헤더 출력 포함)
+typedef int (*RunnerCacheFeedFn)(Pipeline* pipe, PipelineBatch** current, const VectorCache* cache,
+                                 ResponseWriter* out);
+
+// 토크나이저로 직접 읽어 배치 채우기 (헤더 출력 포함)
+typedef int (*RunnerReaderFeedFn)(Pipeline* pipe, PipelineBatch** current, VectorReader* reader,
+                                  ResponseWriter* out);
+
+// 실행기 구성 (pipe.user는 io를 담은 알고리즘별 콜백 컨텍스트)
+typedef struct {
+    const char* schema;              // .vbin 스키마 이름
+    PipelineConfig pipe;
+    RunnerCacheFeedFn feed_cache;
+    RunnerReaderFeedFn feed_reader;
+    RunnerIo* io;
+} VectorRunner;
+
+/**
+ * 요청 파일 하나 실행
+ * 캐시를 쓸 수 있으면 디코딩된 레코드를, 아니면 토크나이저로 읽은 레코드를 배치로 모아
+ * 파이프라인에서 여러 스레드로 계산한 뒤 원래 순서대로 출력
+ * @return SUCCESS, 파일/형식 오류 또는 파이프라인 계산 오류
+ */
+int vector_runner_run(const VectorRunner* runner, const char* input_file, const char* output_file);
+
+// 헤더 줄 그대로 출력
+void vector_runner_echo_line(ResponseWriter* out, const VecToken* token);
+
+// 캐시 원본의 헤더 (첫 레코드 전까지) 그대로 출력
+void vector_runner_echo_header(ResponseWriter* out, const VectorCache* cache);
+
+// 배치가 가득 찼거나 force면 제출하고 새 배치로 교체
+RecordBatch* vector_runner_submit_if_full(Pipeline* pipe, PipelineBatch** current, bool force);
+
+// 레코드 필드 한 줄 처리 (Count 줄 포함)
+typedef int (*RunnerFieldFn)(void* user, RecordBatch* batch, size_t idx, const VecToken* token);
+
+// 섹션 줄 처리 (헤더 안의 섹션 포함)
+typedef int (*RunnerSectionFn)(void* user, const VecToken* token);
+
+/**
+ * Count로 구분한 요청 파일을 토크나이저로 읽어 배치 채우기
+ * 첫 Count 전까지는 헤더로 그대로 출력하고, 레코드마다 echo_column에 원문 범위를 기록
+ * 원문(text)은 Count 줄부터 다음 레코드 직전까지, num은 마지막 필드 줄 끝까지의 길이 (결과 줄을 끼울 자리)
+ * @param section NULL이면 섹션 줄은 원문 에코만
+ */
+int vector_runner_feed_counted(Pipeline* pipe, PipelineBatch** current, VectorReader* reader, ResponseWriter* out,
+                               size_t echo_column, RunnerFieldFn field, RunnerSectionFn section, void* user);
+
+// 캐시의 record번째 레코드 원문 범위를 echo_column에 기록
+void vector_runner_set_echo(RecordBatch* batch, size_t idx, size_t echo_column, const VectorCache* cache,
+                            size_t record);
+
+// 레코드 원문 중 필드 줄 출력 (이어서 결과 줄을 쓸 수 있도록 개행까지)
+void vector_runner_echo_fields(ResponseWriter* out, const RecordBatch* batch, size_t echo_column, size_t i);
+
+// 레코드 원문 중 필드 줄 뒤의 빈 줄과 섹션 줄 출력 (요청 파일 그대로)
+void vector_runner_echo_rest(ResponseWriter* out, const RecordBatch* batch, size_t echo_column, size_t i);
+
+// 배치를 모두 기록한 뒤 원본의 앞부분 놓아주기 (압축 파일 해제 버퍼 반환)
+void vector_runner_release(const RunnerIo* io, const RecordBatch* batch, size_t text_column);
+
+/**
+ * 자동 테스트: test_vectors/request/<dir>/<파일> 실행 후 정답이 있으면 비교
+ * @param run 요청 파일 실행 함수 (xxx_test)
+ */
+int vector_runner_auto_test(const char* dir, const char* test_file,
+                            int (*run)(const char* input_file, const char* output_file));
+
+#endif // VECTOR_RUNNER_H
@@ -0,0 +1,139 @@
+#ifndef VECTOR_SCHEMA_H
+#define VECTOR_SCHEMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "vector_reader.h"
+
+// 스키마 하나의 최대 필드 수
+#define SCHEMA_MAX_FIELDS 24
+
+// 필드 값 형식
+typedef enum {
+    SCHEMA_INT,      // 10진수 정수 (Len, Klen, Tlen 등)
+    SCHEMA_HEX,      // 16진수 바이트 (Key, Msg, Mac 등)
+    SCHEMA_TEXT      // 원문 그대로 (SHAAlg, Result 등)
+} SchemaFieldKind;
+
+// 필드 플래그
+#define SCHEMA_FLAG_START         0x01  // 이 필드가 나오면 새 레코드 시작
+#define SCHEMA_FLAG_SECTION       0x02  // [key = value] 섹션 파라미터 (섹션 안의 모든 레코드에 적용)
+#define SCHEMA_FLAG_SECTION_NAME  0x04  // [이름] 형식 섹션 (key는 접두사, 빈 문자열이면 모든 섹션)
+#define SCHEMA_FLAG_STICKY        0x08  // 레코드 사이에 한 번 나와 이후 레코드에 이어짐 (RSA n, e 등)
+#define SCHEMA_FLAG_VERDICT       0x10  // 판정 값 (결과 비교 시 P/F 첫 글자만 비교)
+#define SCHEMA_FLAG_STREAM        0x20  // 큰 값은 디코딩하지 않고 원문 위치만 기록 가능 (LongMsg의 Msg 등)
+
+// 값 플래그 (SchemaValue.flags)
+#define SCHEMA_VALUE_TEXT_ONLY    0x01  // 바이트를 payload에 두지 않음 (원문을 청크 단위로 디코딩해 사용)
+
+// 필드 정의
+typedef struct {
+    const char* key;
+    SchemaFieldKind kind;
+    unsigned flags;
+} SchemaField;
+
+// 테스트 유형별 스키마
+typedef struct {
+    const char* name;
+    const SchemaField* fields;
+    size_t field_count;
+} VectorSchema;
+
+// 디코딩된 필드 값 (.vbin 캐시에 그대로 기록되므로 패딩 없는 고정 배치)
+typedef struct {
+    uint64_t offset;       // payload 안의 위치 (HEX/TEXT)
+    uint64_t text_offset;  // 원본 파일 안의 값 원문 위치 (에코 출력용)
+    int64_t num;           // 정수 값 (INT)
+    uint32_t len;          // 바이트 길이 (HEX/TEXT)
+    uint32_t text_len;     // 원문 길이
+    uint32_t present;      // 값이 있는지 (섹션/이어지는 값 포함)
+    uint32_t flags;        // SCHEMA_VALUE_* (원문만 기록한 값이면 len은 디코딩될 바이트 수)
+} SchemaValue;
+
+// 레코드가 차지하는 원본 파일 범위 [start, end)
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+} SchemaSpan;
+
+/**
+ * 한 번에 디코딩한 벡터 파일
+ * 레코드 i의 필드 f 값은 values[i * field_count + f], 바이트는 payload에 연속 배치
+ */
+typedef struct {
+    const VectorSchema* schema;
+    size_t count;            // 레코드 수
+    size_t field_count;
+    SchemaValue* values;
+    SchemaSpan* spans;
+    const char* source;      // 디코딩한 원본 내용 (원문만 기록한 값을 읽을 때 사용, 원본을 닫으면 NULL)
+    uint8_t* payload;
+    size_t payload_len;
+    uint64_t header_len;     // 첫 레코드 앞 헤더 바이트 수
+    size_t capacity;         // 할당된 레코드 수
+    size_t payload_cap;
+} DecodedVectors;
+
+// 이름/파일명으로 스키마 찾기 (없으면 NULL)
+const VectorSchema* vector_schema_find(const char* name);
+const VectorSchema* vector_schema_for_file(const char* path);
+
+// 필드 이름의 인덱스 (없으면 -1)
+int vector_schema_field(const VectorSchema* schema, const char* key);
+
+/**
+ * 리더의 남은 내용을 스키마에 따라 한 번에 디코딩
+ * @return SUCCESS, ERR_INVALID_FORMAT(정수/16진수 형식 오류), ERR_MEMORY_ALLOC
+ */
+int schema_decode(const VectorSchema* schema, VectorReader* reader, DecodedVectors* out);
+
+/**
+ * schema_decode와 같지만 SCHEMA_FLAG_STREAM 필드 중 디코딩 결과가 stream_min 바이트보다 큰 값은
+ * payload에 넣지 않고 원문 위치만 기록 (SCHEMA_VALUE_TEXT_ONLY, 원본을 열어 둔 동안만 사용 가능)
+ * stream_min이 0이면 모든 값을 디코딩
+ */
+int schema_decode_ex(const VectorSchema* schema, VectorReader* reader, size_t stream_min, DecodedVectors* out);
+int schema_decode_file(const VectorSchema* schema, const char* path, DecodedVectors* out);
+void decoded_vectors_free(DecodedVectors* decoded);
+
+static inline const SchemaValue* decoded_value(const DecodedVectors* decoded, size_t record, int field) {
+    return &decoded->values[record * decoded->field_count + (size_t)field];
+}
+
+static inline const uint8_t* decoded_bytes(const DecodedVectors* decoded, const SchemaValue* value) {
+    return decoded->payload + value->offset;
+}
+
+// 원문만 기록한 값인지 (decoded_bytes 대신 decoded_text나 decoded_bytes_chunk 사용)
+static inline bool decoded_text_only(const SchemaValue* value) {
+    return (value->flags & SCHEMA_VALUE_TEXT_ONLY) != 0;
+}
+
+/**
+ * 값의 바이트 [pos, pos + n) (원문만 기록한 값은 buf에 디코딩)
+ * @return 바이트 위치, 범위나 16진수 형식이 잘못되면 NULL
+ */
+const uint8_t* decoded_bytes_chunk(const DecodedVectors* decoded, const SchemaValue* value, size_t pos, size_t n,
+                                   uint8_t* buf);
+
+// 두 바이트 값이 같은지 (원문만 기록한 값은 청크 단위로 디코딩해 비교)
+bool decoded_bytes_equal(const DecodedVectors* a, const SchemaValue* va, const DecodedVectors* b,
+                         const SchemaValue* vb);
+
+// 값의 원문 (source는 디코딩한 원본 파일 내용)
+// 값이 정확히 len 바이트인지 (len이 0이면 자리 표시 "00"도 허용, record_batch_set_hex_exact와 같은 규칙)
+static inline bool decoded_len_is(const DecodedVectors* decoded, const SchemaValue* value, uint64_t len) {
+    if (len == 0 && value->len == 1 && !decoded_text_only(value)) {
+        return decoded_bytes(decoded, value)[0] == 0;
+    }
+    return value->len == len;
+}
+
+static inline StrView decoded_text(const char* source, const SchemaValue* value) {
+    StrView view = { source + value->text_offset, value->text_len };
+    return view;
+}
+
+#endif // VECTOR_SCHEMA_H
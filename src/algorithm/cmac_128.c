@@ -0,0 +1,340 @@
+#include <openssl/core_names.h>
+#include "../../include/algorithm/cmac_128.h"
+#include "../../include/algorithm/cmac_128_native.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/mac_backend.h"
+#include "../../include/common/vector_runner.h"
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/perf_counters.h"
+
+// 기본 MAC 백엔드 (EVP)
+static const MacBackend EVP_BACKEND = { cmac128_mac, cmac128_verify };
+
+// 자동/수동 테스트에서 사용할 MAC 백엔드 (배치 작업 스레드마다 따로 설정)
+static THREAD_LOCAL MacBackend g_backend = { cmac128_mac, cmac128_verify };
+
+void cmac128_set_backend(int (*mac_function)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                             unsigned char*, size_t),
+                         int (*mac_verify)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                           const unsigned char*, size_t)) {
+    mac_backend_set(&g_backend, mac_function, mac_verify, &EVP_BACKEND);
+}
+
+/**
+ * CMAC-AES128 태그 계산 (EVP 인터페이스 사용)
+ * EVP_MAC_init이 레코드마다 키 일정과 서브키를 다시 만드므로 기준 구현으로만 사용
+ */
+int cmac128_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                unsigned char* tag, size_t tag_len) {
+    if (key == NULL || key_len != CMAC128_KEY_LENGTH || (message == NULL && message_len > 0) ||
+        tag == NULL || tag_len == 0 || tag_len > CMAC128_TAG_LENGTH) {
+        return ERR_INVALID_INPUT;
+    }
+
+    return mac_backend_evp(EVP_CACHE_MAC_CMAC, OSSL_MAC_PARAM_CIPHER, "AES-128-CBC", key, key_len,
+                           message, message_len, tag, tag_len, CMAC128_TAG_LENGTH);
+}
+
+// 태그 검증 (앞 tag_len 바이트를 상수 시간으로 비교)
+int cmac128_verify(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                   const unsigned char* tag, size_t tag_len) {
+    return mac_backend_verify(cmac128_mac, key, key_len, message, message_len, tag, tag_len);
+}
+
+// 한 번에 모아서 처리하는 레코드 수
+#define CMAC_BATCH_RECORDS 64
+
+// 배치 아레나 블록 크기 (CMACGen의 64KB 메시지 몇 개가 한 블록에 들어가도록)
+#define CMAC_BATCH_ARENA (256 * 1024)
+
+// 배치 열: Key(num=Tlen), Msg(num=Mlen), Mac(CMACVer만), 레코드 원문
+// 원문(text)은 Count 줄부터 다음 레코드 직전까지이고, num은 마지막 필드 줄 끝까지의 길이 (결과 줄을 끼울 자리)
+#define CMAC_COL_KEY  0
+#define CMAC_COL_MSG  1
+#define CMAC_COL_MAC  2
+#define CMAC_COL_ECHO 3
+#define CMAC_COLUMNS  4
+
+// 검증 실패 시 기록하는 사유 (태그만으로는 어느 입력이 바뀌었는지 알 수 없으므로 CAVP의 태그 불일치 코드 사용)
+#define CMAC_RESULT_FAIL "F (3 - MAC changed)"
+
+// 레코드 결과 유형
+typedef enum {
+    CMAC_VERDICT_NONE = 0,      // CMACGen: tag 기록
+    CMAC_VERDICT_PASS,
+    CMAC_VERDICT_FAIL
+} CmacVerdict;
+
+// 레코드 하나의 결과 (파이프라인 결과 버퍼에 그대로 저장)
+typedef struct {
+    uint8_t tag[CMAC128_TAG_LENGTH];
+    uint8_t verdict;
+} Cmac128Result;
+
+// 파이프라인 콜백 컨텍스트 (작업 스레드는 호출 스레드의 백엔드 설정을 볼 수 없으므로 복사해 전달)
+typedef struct {
+    MacBackend backend;
+    RunnerIo io;
+} Cmac128PipelineCtx;
+
+// 레코드 하나 계산: Mac이 있으면 검증, 없으면 Tlen 바이트 태그 생성
+static int compute_record(const MacBackend* backend, const RecordBatch* batch, size_t i, Cmac128Result* result) {
+    const uint8_t* key = batch->data[CMAC_COL_KEY][i];
+    const uint8_t* msg = batch->data[CMAC_COL_MSG][i];
+    const uint8_t* mac = batch->data[CMAC_COL_MAC][i];
+    size_t key_len = batch->len[CMAC_COL_KEY][i];
+    size_t msg_len = batch->len[CMAC_COL_MSG][i];
+    long long tlen = batch->num[CMAC_COL_KEY][i];
+    PerfMark perf;
+    int ret;
+
+    perf_profile_begin(&perf);
+    if (mac != NULL) {
+        ret = backend->mac_verify(key, key_len, msg, msg_len, mac, batch->len[CMAC_COL_MAC][i]);
+        result->verdict = (ret == SUCCESS) ? CMAC_VERDICT_PASS : CMAC_VERDICT_FAIL;
+        if (ret == ERR_MAC_VERIFY) {
+            ret = SUCCESS;
+        }
+    } else {
+        result->verdict = CMAC_VERDICT_NONE;
+        ret = (tlen > 0 && tlen <= CMAC128_TAG_LENGTH) ?
+            backend->mac_function(key, key_len, msg, msg_len, result->tag, (size_t)tlen) : ERR_INVALID_INPUT;
+    }
+    perf_profile_end(&perf, msg_len, 1);
+    return ret;
+}
+
+/**
+ * 배치의 CMACVer 레코드를 네이티브 다중 레인 커널로 한 번에 검증
+ * 레코드마다 키와 길이가 달라도 되므로 배치 순서 그대로 넘김
+ */
+static int verify_batch_native(const RecordBatch* batch, Cmac128Result* results) {
+    const uint8_t* keys[CMAC_BATCH_RECORDS];
+    const uint8_t* msgs[CMAC_BATCH_RECORDS];
+    const uint8_t* macs[CMAC_BATCH_RECORDS];
+    size_t key_lens[CMAC_BATCH_RECORDS];
+    size_t msg_lens[CMAC_BATCH_RECORDS];
+    size_t mac_lens[CMAC_BATCH_RECORDS];
+    size_t index[CMAC_BATCH_RECORDS];
+    int verdicts[CMAC_BATCH_RECORDS];
+    size_t n = 0;
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < batch->count && n < CMAC_BATCH_RECORDS; i++) {
+        if (batch->data[CMAC_COL_MAC][i] == NULL) continue;
+        keys[n] = batch->data[CMAC_COL_KEY][i];
+        key_lens[n] = batch->len[CMAC_COL_KEY][i];
+        msgs[n] = batch->data[CMAC_COL_MSG][i];
+        msg_lens[n] = batch->len[CMAC_COL_MSG][i];
+        macs[n] = batch->data[CMAC_COL_MAC][i];
+        mac_lens[n] = batch->len[CMAC_COL_MAC][i];
+        bytes += msg_lens[n];
+        index[n++] = i;
+    }
+    if (n == 0) {
+        return SUCCESS;
+    }
+
+    PerfMark perf;
+    perf_profile_begin(&perf);
+    int ret = cmac128_native_verify_many(keys, key_lens, msgs, msg_lens, macs, mac_lens, verdicts, n);
+    perf_profile_end(&perf, bytes, n);
+
+    for (size_t j = 0; j < n && ret == SUCCESS; j++) {
+        if (verdicts[j] == SUCCESS || verdicts[j] == ERR_MAC_VERIFY) {
+            results[index[j]].verdict = (verdicts[j] == SUCCESS) ? CMAC_VERDICT_PASS : CMAC_VERDICT_FAIL;
+        } else {
+            ret = verdicts[j];
+        }
+    }
+    return ret;
+}
+
+/**
+ * 파이프라인 계산 단계: 배치 하나의 태그 계산/검증
+ * 네이티브 백엔드는 CMACVer 레코드를 다중 레인 커널로, 나머지는 레코드별로 계산
+ */
+static int cmac128_compute_batch(void* user, const RecordBatch* batch, uint8_t* results) {
+    const Cmac128PipelineCtx* ctx = (const Cmac128PipelineCtx*)user;
+    Cmac128Result* out = (Cmac128Result*)results;
+    bool multi_lane = (ctx->backend.mac_verify == cmac128_native_verify);
+    int ret = SUCCESS;
+
+    PHASE_START(crypto_mark);
+    if (multi_lane) {
+        ret = verify_batch_native(batch, out);
+    }
+    for (size_t i = 0; i < batch->count && ret == SUCCESS; i++) {
+        if (multi_lane && batch->data[CMAC_COL_MAC][i] != NULL) continue;
+        ret = compute_record(&ctx->backend, batch, i, &out[i]);
+    }
+    PHASE_STOP(crypto_mark, PHASE_CRYPTO);
+    return ret;
+}
+
+// 파이프라인 출력 단계: 요청 레코드 원문 뒤에 Mac 또는 Result 기록
+static int cmac128_emit_batch(void* user, const RecordBatch* batch, const uint8_t* results) {
+    Cmac128PipelineCtx* ctx = (Cmac128PipelineCtx*)user;
+    const Cmac128Result* res = (const Cmac128Result*)results;
+    ResponseWriter* out = &ctx->io.out;
+
+    PHASE_START(format_mark);
+    for (size_t i = 0; i < batch->count; i++) {
+        vector_runner_echo_fields(out, batch, CMAC_COL_ECHO, i);
+        if (res[i].verdict == CMAC_VERDICT_NONE) {
+            rw_field_hex(out, "Mac", res[i].tag, (size_t)batch->num[CMAC_COL_KEY][i]);
+        } else if (res[i].verdict == CMAC_VERDICT_PASS) {
+            rw_field_str(out, "Result", "P", 1);
+        } else {
+            rw_field_str(out, "Result", CMAC_RESULT_FAIL, sizeof(CMAC_RESULT_FAIL) - 1);
+        }
+        vector_runner_echo_rest(out, batch, CMAC_COL_ECHO, i);
+    }
+    // 이 배치까지 기록했으므로 원본의 앞부분은 더 이상 참조하지 않음
+    vector_runner_release(&ctx->io, batch, CMAC_COL_ECHO);
+    PHASE_STOP(format_mark, PHASE_FORMAT);
+    return out->error;
+}
+
+// 캐시 경로에서 빈 메시지(Mlen = 0, 원문은 보통 "00")가 가리킬 자리
+static const uint8_t EMPTY_MSG[1] = { 0 };
+
+// 토크나이저로 읽은 필드 하나를 레코드 열에 저장 (Msg는 앞서 나온 Mlen과 길이가 같아야 함)
+static int set_record_field(void* user, RecordBatch* batch, size_t idx, const VecToken* token) {
+    bool ok = true;
+    (void)user;
+
+    if (strview_eq(token->key, "Tlen")) {
+        batch->num[CMAC_COL_KEY][idx] = strview_to_ll(token->value, &ok);
+    } else if (strview_eq(token->key, "Mlen")) {
+        batch->num[CMAC_COL_MSG][idx] = strview_to_ll(token->value, &ok);
+        ok = ok && batch->num[CMAC_COL_MSG][idx] >= 0;
+    } else if (strview_eq(token->key, "Key")) {
+        return record_batch_set_hex(batch, idx, CMAC_COL_KEY, token->value, CMAC128_KEY_LENGTH);
+    } else if (strview_eq(token->key, "Mac")) {
+        return record_batch_set_hex(batch, idx, CMAC_COL_MAC, token->value, CMAC128_TAG_LENGTH);
+    } else if (strview_eq(token->key, "Msg")) {
+        // Msg는 정확히 Mlen 바이트 (Mlen=0은 빈 값이나 "00")
+        return record_batch_set_hex_exact(batch, idx, CMAC_COL_MSG, token->value,
+                                          (size_t)batch->num[CMAC_COL_MSG][idx]);
+    }
+    return ok ? SUCCESS : ERR_INVALID_FORMAT;
+}
+
+/**
+ * 요청 파일을 토크나이저로 직접 읽어 배치 채우기 (.vbin 캐시를 쓰지 않을 때)
+ * 레코드는 Count 줄부터 다음 Count 직전까지이고, 그 줄들을 원문 그대로 에코
+ */
+static int feed_from_reader(Pipeline* pipe, PipelineBatch** current, VectorReader* reader, ResponseWriter* out) {
+    return vector_runner_feed_counted(pipe, current, reader, out, CMAC_COL_ECHO, set_record_field, NULL, NULL);
+}
+
+/**
+ * 디코딩된 레코드로 배치 채우기
+ * 키/메시지/태그 바이트는 캐시를 그대로 가리키고, 에코 원문은 원본 파일의 레코드 범위
+ */
+static int feed_from_cache(Pipeline* pipe, PipelineBatch** current, const VectorCache* cache, ResponseWriter* out) {
+    const DecodedVectors* vectors = &cache->vectors;
+    const VectorSchema* schema = vectors->schema;
+    int mlen_field = vector_schema_field(schema, "Mlen");
+    int tlen_field = vector_schema_field(schema, "Tlen");
+    int key_field = vector_schema_field(schema, "Key");
+    int msg_field = vector_schema_field(schema, "Msg");
+    int mac_field = vector_schema_field(schema, "Mac");
+    RecordBatch* batch = &(*current)->records;
+
+    // 헤더 정복사 (첫 Count 전까지)
+    vector_runner_echo_header(out, cache);
+
+    for (size_t i = 0; i < vectors->count; i++) {
+        const SchemaValue* mlen = decoded_value(vectors, i, mlen_field);
+        const SchemaValue* tlen = decoded_value(vectors, i, tlen_field);
+        const SchemaValue* key = decoded_value(vectors, i, key_field);
+        const SchemaValue* msg = decoded_value(vectors, i, msg_field);
+        const SchemaValue* mac = decoded_value(vectors, i, mac_field);
+        // 필드가 빠진 레코드는 토크나이저 경로와 같이 오류로 처리 (건너뛰면 원문이 앞 레코드에 섞임)
+        // Msg는 토크나이저 경로와 같이 정확히 Mlen 바이트
+        if (!mlen->present || !tlen->present || !key->present || !msg->present || mlen->num < 0 ||
+            !decoded_len_is(vectors, msg, (uint64_t)mlen->num)) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        size_t idx = record_batch_push(batch);
+        batch->num[CMAC_COL_KEY][idx] = tlen->num;
+        batch->data[CMAC_COL_KEY][idx] = decoded_bytes(vectors, key);
+        batch->len[CMAC_COL_KEY][idx] = key->len;
+        batch->num[CMAC_COL_MSG][idx] = mlen->num;
+        batch->data[CMAC_COL_MSG][idx] = mlen->num > 0 ? decoded_bytes(vectors, msg) : EMPTY_MSG;
+        batch->len[CMAC_COL_MSG][idx] = (size_t)mlen->num;
+        if (mac->present) {
+            batch->data[CMAC_COL_MAC][idx] = decoded_bytes(vectors, mac);
+            batch->len[CMAC_COL_MAC][idx] = mac->len;
+        }
+
+        vector_runner_set_echo(batch, idx, CMAC_COL_ECHO, cache, i);
+
+        batch = vector_runner_submit_if_full(pipe, current, false);
+        if (pipeline_failed(pipe)) break;
+    }
+    return SUCCESS;
+}
+
+/**
+ * CMAC-AES128 테스트 실행 (CMACGen, CMACVer)
+ * .vbin 캐시가 켜져 있으면 디코딩된 레코드를, 아니면 공용 토크나이저로 읽은 레코드를 배치로 모으고,
+ * 레코드 파이프라인으로 여러 스레드에서 계산한 뒤 원래 순서대로 출력
+ */
+int cmac128_test(const char* input_file, const char* output_file) {
+    Cmac128PipelineCtx pipe_ctx = { g_backend, { { 0 }, NULL } };
+    VectorRunner runner = {
+        "CMAC",
+        { CMAC_BATCH_RECORDS, CMAC_COLUMNS, CMAC_BATCH_ARENA, sizeof(Cmac128Result),
+          cmac128_compute_batch, cmac128_emit_batch, &pipe_ctx },
+        feed_from_cache, feed_from_reader, &pipe_ctx.io
+    };
+    return vector_runner_run(&runner, input_file, output_file);
+}
+
+// 자동 테스트 구현
+int cmac128_run_auto_test(int test_type_id) {
+    const char* test_file = NULL;
+
+    if (test_type_id == CMAC_TEST_GEN) {
+        test_file = "CMACGenAES128.req";
+    } else if (test_type_id == CMAC_TEST_VER) {
+        test_file = "CMACVerAES128.req";
+    } else {
+        return ERR_INVALID_TEST_TYPE;
+    }
+
+    return vector_runner_auto_test("CMAC_128", test_file, cmac128_test);
+}
+
+// 수동 테스트 구현 (키는 16진수, 메시지는 선택한 입력 유형)
+int cmac128_run_manual_test(int input_type_id) {
+    uint8_t key[CMAC128_KEY_LENGTH];
+    size_t key_len = 0;
+
+    int result = mac_backend_read_hex("키를 16진수로 입력하세요 (16바이트):", key, sizeof(key), &key_len);
+    if (result != SUCCESS || key_len != CMAC128_KEY_LENGTH) {
+        return ERR_INVALID_INPUT;
+    }
+
+    uint8_t message[MAX_LINE_LENGTH / 2];
+    size_t message_len = 0;
+    result = mac_backend_read_message(input_type_id, message, sizeof(message), &message_len);
+    if (result != SUCCESS) {
+        return result;
+    }
+
+    uint8_t tag[CMAC128_TAG_LENGTH];
+    result = g_backend.mac_function(key, key_len, message, message_len, tag, sizeof(tag));
+    if (result == SUCCESS) {
+        printf("\n[입력 길이] %zu 바이트\n", message_len);
+        mac_backend_print_tag("CMAC-AES128", tag, sizeof(tag));
+    }
+
+    return result;
+}
@@ -0,0 +1,431 @@
+#include "../../include/algorithm/cmac_128_native.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/cpu_features.h"
+#include <openssl/crypto.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CMAC128_NATIVE_X86 1
+#endif
+
+/**
+ * 서브키 유도: GF(2^128)에서 x를 곱함 (왼쪽 1비트 이동, 최상위 비트가 있었으면 0x87을 XOR)
+ * 분기 없이 계산해 키에 따라 시간이 달라지지 않음
+ */
+static void cmac_double(const uint8_t in[CMAC128_BLOCK_SIZE], uint8_t out[CMAC128_BLOCK_SIZE]) {
+    uint8_t carry = (uint8_t)(in[0] >> 7);
+    for (int i = 0; i < CMAC128_BLOCK_SIZE - 1; i++) {
+        out[i] = (uint8_t)((in[i] << 1) | (in[i + 1] >> 7));
+    }
+    out[CMAC128_BLOCK_SIZE - 1] = (uint8_t)((in[CMAC128_BLOCK_SIZE - 1] << 1) ^ (0x87 & -carry));
+}
+
+#ifdef CMAC128_NATIVE_X86
+__attribute__((target("aes,sse2")))
+static inline __m128i aes128_expand_step(__m128i key, __m128i assist) {
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+// aeskeygenassist는 라운드 상수를 즉시값으로만 받으므로 매크로로 펼침
+#define AES128_EXPAND(rk, i, rcon) do { \
+    rk[i] = aes128_expand_step(rk[(i) - 1], _mm_aeskeygenassist_si128(rk[(i) - 1], rcon)); \
+} while (0)
+
+__attribute__((target("aes,sse2")))
+static inline __m128i aes128_encrypt_block(const __m128i rk[AES128_ROUND_KEYS], __m128i block) {
+    block = _mm_xor_si128(block, rk[0]);
+    for (int r = 1; r < AES128_ROUND_KEYS - 1; r++) {
+        block = _mm_aesenc_si128(block, rk[r]);
+    }
+    return _mm_aesenclast_si128(block, rk[AES128_ROUND_KEYS - 1]);
+}
+
+// 라운드 키 확장과 서브키 K1/K2 유도
+__attribute__((target("aes,sse2")))
+static void cmac128_schedule_aesni(Cmac128KeySchedule* schedule, const uint8_t key[CMAC128_KEY_LENGTH]) {
+    __m128i rk[AES128_ROUND_KEYS];
+
+    rk[0] = _mm_loadu_si128((const __m128i*)key);
+    AES128_EXPAND(rk, 1, 0x01);
+    AES128_EXPAND(rk, 2, 0x02);
+    AES128_EXPAND(rk, 3, 0x04);
+    AES128_EXPAND(rk, 4, 0x08);
+    AES128_EXPAND(rk, 5, 0x10);
+    AES128_EXPAND(rk, 6, 0x20);
+    AES128_EXPAND(rk, 7, 0x40);
+    AES128_EXPAND(rk, 8, 0x80);
+    AES128_EXPAND(rk, 9, 0x1b);
+    AES128_EXPAND(rk, 10, 0x36);
+
+    memcpy(schedule->key, key, CMAC128_KEY_LENGTH);
+    for (int r = 0; r < AES128_ROUND_KEYS; r++) {
+        _mm_storeu_si128((__m128i*)schedule->round_keys[r], rk[r]);
+    }
+
+    // L = AES(K, 0), K1 = L·x, K2 = K1·x
+    uint8_t l[CMAC128_BLOCK_SIZE];
+    _mm_storeu_si128((__m128i*)l, aes128_encrypt_block(rk, _mm_setzero_si128()));
+    cmac_double(l, schedule->k1);
+    cmac_double(schedule->k1, schedule->k2);
+}
+
+/**
+ * 마지막 블록 준비: 꽉 찼으면 K1, 아니면 10* 패딩 후 K2를 XOR
+ * full_blocks에는 마지막 블록 앞의 완전한 블록 수를 돌려줌 (빈 메시지도 마지막 블록 하나)
+ */
+__attribute__((target("aes,sse2")))
+static inline __m128i cmac128_last_block(const Cmac128KeySchedule* schedule, const uint8_t* message,
+                                         size_t message_len, size_t* full_blocks) {
+    size_t full = message_len > 0 ? (message_len - 1) / CMAC128_BLOCK_SIZE : 0;
+    size_t rest = message_len - full * CMAC128_BLOCK_SIZE;
+    uint8_t last[CMAC128_BLOCK_SIZE] = { 0 };
+    const uint8_t* subkey = schedule->k1;
+    if (rest > 0) {
+        memcpy(last, message + full * CMAC128_BLOCK_SIZE, rest);
+    }
+    if (rest < CMAC128_BLOCK_SIZE) {
+        last[rest] = 0x80;
+        subkey = schedule->k2;
+    }
+
+    *full_blocks = full;
+    return _mm_xor_si128(_mm_loadu_si128((const __m128i*)last), _mm_loadu_si128((const __m128i*)subkey));
+}
+
+// CBC-MAC 체인: 마지막 블록 앞까지는 그대로 암호화하고 마지막 블록에만 서브키를 섞음
+__attribute__((target("aes,sse2")))
+static void cmac128_compute_aesni(const Cmac128KeySchedule* schedule, const uint8_t* message, size_t message_len,
+                                  uint8_t tag[CMAC128_TAG_LENGTH]) {
+    __m128i rk[AES128_ROUND_KEYS];
+    for (int r = 0; r < AES128_ROUND_KEYS; r++) {
+        rk[r] = _mm_loadu_si128((const __m128i*)schedule->round_keys[r]);
+    }
+
+    size_t full_blocks;
+    __m128i last = cmac128_last_block(schedule, message, message_len, &full_blocks);
+    __m128i x = _mm_setzero_si128();
+    for (size_t i = 0; i < full_blocks; i++) {
+        __m128i m = _mm_loadu_si128((const __m128i*)(message + i * CMAC128_BLOCK_SIZE));
+        x = aes128_encrypt_block(rk, _mm_xor_si128(x, m));
+    }
+
+    x = aes128_encrypt_block(rk, _mm_xor_si128(x, last));
+    _mm_storeu_si128((__m128i*)tag, x);
+}
+
+/**
+ * 독립된 레코드 여러 개의 CBC 체인을 레인별로 엇갈려 계산 (LANES는 상수로 펼쳐짐)
+ * 단계마다 모든 레인이 블록 하나씩 흡수하고, 라운드마다 레인을 이어서 AESENC를 내보내므로
+ * 한 체인의 AESENC 지연 시간 동안 다른 레인의 명령이 파이프라인을 채움
+ * 체인 값은 레지스터에 두고, 라운드 키는 레인에 올릴 때 캐시에서 복사해 이후 캐시 교체와 무관
+ * 끝난 레인은 그 자리에서 다음 레코드로 채우므로 키와 길이가 달라도 레인이 놀지 않음
+ */
+__attribute__((target("aes,sse2")))
+static inline __attribute__((always_inline))
+void cmac128_compute_lanes(const uint8_t* const keys[], const uint8_t* const messages[],
+                           const size_t message_lens[], uint8_t (*tags)[CMAC128_TAG_LENGTH],
+                           size_t count, const size_t LANES) {
+    __m128i rk[CMAC128_MB_MAX_LANES][AES128_ROUND_KEYS];
+    __m128i x[CMAC128_MB_MAX_LANES];
+    __m128i last[CMAC128_MB_MAX_LANES];          // 서브키를 섞은 마지막 블록
+    const uint8_t* ptr[CMAC128_MB_MAX_LANES];
+    size_t blocks[CMAC128_MB_MAX_LANES];         // 마지막 블록 앞에 남은 블록 수
+    size_t record[CMAC128_MB_MAX_LANES];         // 결과를 기록할 레코드 번호
+    bool busy[CMAC128_MB_MAX_LANES];
+    size_t busy_count = 0;
+    size_t next = 0;
+
+// 레코드 i를 레인 l에 올림 (남은 레코드가 없으면 레인을 비움)
+#define CMAC_LANE_LOAD(l) do { \
+    busy[l] = next < count; \
+    if (busy[l]) { \
+        const Cmac128KeySchedule* schedule = cmac128_key_schedule_get(keys[next]); \
+        for (int r = 0; r < AES128_ROUND_KEYS; r++) { \
+            rk[l][r] = _mm_loadu_si128((const __m128i*)schedule->round_keys[r]); \
+        } \
+        last[l] = cmac128_last_block(schedule, messages[next], message_lens[next], &blocks[l]); \
+        x[l] = _mm_setzero_si128(); \
+        ptr[l] = messages[next]; \
+        record[l] = next++; \
+        busy_count++; \
+    } else { \
+        blocks[l] = 0; \
+        last[l] = _mm_setzero_si128(); \
+        x[l] = _mm_setzero_si128(); \
+        memset(rk[l], 0, sizeof(rk[l])); \
+    } \
+} while (0)
+
+#pragma GCC unroll 8
+    for (size_t l = 0; l < LANES; l++) {
+        CMAC_LANE_LOAD(l);
+    }
+
+    while (busy_count > 0) {
+        // 빈 레인도 같은 연산을 하지만 결과는 버림 (레인 수만큼 펼친 코드를 분기 없이 유지)
+#pragma GCC unroll 8
+        for (size_t l = 0; l < LANES; l++) {
+            __m128i m = blocks[l] > 0 ? _mm_loadu_si128((const __m128i*)ptr[l]) : last[l];
+            x[l] = _mm_xor_si128(_mm_xor_si128(x[l], m), rk[l][0]);
+        }
+        for (int r = 1; r < AES128_ROUND_KEYS - 1; r++) {
+#pragma GCC unroll 8
+            for (size_t l = 0; l < LANES; l++) {
+                x[l] = _mm_aesenc_si128(x[l], rk[l][r]);
+            }
+        }
+#pragma GCC unroll 8
+        for (size_t l = 0; l < LANES; l++) {
+            x[l] = _mm_aesenclast_si128(x[l], rk[l][AES128_ROUND_KEYS - 1]);
+        }
+
+        // 마지막 블록을 처리한 레인은 태그를 기록하고 다음 레코드로 교체
+#pragma GCC unroll 8
+        for (size_t l = 0; l < LANES; l++) {
+            if (!busy[l]) continue;
+            if (blocks[l] > 0) {
+                blocks[l]--;
+                ptr[l] += CMAC128_BLOCK_SIZE;
+                continue;
+            }
+            _mm_storeu_si128((__m128i*)tags[record[l]], x[l]);
+            busy_count--;
+            CMAC_LANE_LOAD(l);
+        }
+    }
+#undef CMAC_LANE_LOAD
+}
+
+__attribute__((target("aes,sse2")))
+static void cmac128_compute_x4(const uint8_t* const keys[], const uint8_t* const messages[],
+                               const size_t message_lens[], uint8_t (*tags)[CMAC128_TAG_LENGTH], size_t count) {
+    cmac128_compute_lanes(keys, messages, message_lens, tags, count, 4);
+}
+
+__attribute__((target("aes,sse2")))
+static void cmac128_compute_x8(const uint8_t* const keys[], const uint8_t* const messages[],
+                               const size_t message_lens[], uint8_t (*tags)[CMAC128_TAG_LENGTH], size_t count) {
+    cmac128_compute_lanes(keys, messages, message_lens, tags, count, 8);
+}
+
+// 레인 폭에 맞는 커널 선택 (1이면 레코드별 단일 체인)
+static void cmac128_compute_many_aesni(const uint8_t* const keys[], const uint8_t* const messages[],
+                                       const size_t message_lens[], uint8_t (*tags)[CMAC128_TAG_LENGTH],
+                                       size_t count, size_t lanes) {
+    if (lanes >= 8) {
+        cmac128_compute_x8(keys, messages, message_lens, tags, count);
+    } else if (lanes >= 4) {
+        cmac128_compute_x4(keys, messages, message_lens, tags, count);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            cmac128_compute_aesni(cmac128_key_schedule_get(keys[i]), messages[i], message_lens[i], tags[i]);
+        }
+    }
+}
+#endif
+
+static Cmac128Impl g_impl = CMAC128_IMPL_EVP;
+static bool g_dispatched = false;
+
+/**
+ * 런타임 디스패치
+ * 환경 변수 CRYPTO_TEST_CMAC_IMPL=evp로 AES-NI가 있어도 EVP 위임 강제 가능
+ */
+Cmac128Impl cmac128_native_dispatch(void) {
+    if (g_dispatched) {
+        return g_impl;
+    }
+
+    Cmac128Impl impl = CMAC128_IMPL_EVP;
+
+#ifdef CMAC128_NATIVE_X86
+    bool has_aesni = get_cpu_features()->aesni;
+
+    const char* force = getenv("CRYPTO_TEST_CMAC_IMPL");
+    if (force != NULL && strcmp(force, "evp") == 0) {
+        has_aesni = false;
+    }
+
+    if (has_aesni) {
+        impl = CMAC128_IMPL_AESNI;
+    }
+#endif
+
+    g_impl = impl;
+    g_dispatched = true;
+    return impl;
+}
+
+const char* cmac128_native_impl_name(void) {
+    return cmac128_native_dispatch() == CMAC128_IMPL_AESNI ? "AES-NI" : "EVP";
+}
+
+static size_t g_lanes = 0;
+
+/**
+ * 다중 레인 검증 폭
+ * 환경 변수 CRYPTO_TEST_CMAC_LANES(1/4/8)로 변경 가능, 기본값은 최대 폭
+ */
+size_t cmac128_mb_lanes(void) {
+    if (g_lanes != 0) {
+        return g_lanes;
+    }
+
+    size_t lanes = CMAC128_MB_MAX_LANES;
+    const char* force = getenv("CRYPTO_TEST_CMAC_LANES");
+    if (force != NULL) {
+        int value = atoi(force);
+        if (value == 1 || value == 4 || value == 8) {
+            lanes = (size_t)value;
+        }
+    }
+
+    g_lanes = lanes;
+    return lanes;
+}
+
+// 스레드별 키 캐시 (슬롯이 다 차면 가장 먼저 만든 슬롯부터 교체)
+typedef struct {
+    Cmac128KeySchedule slots[CMAC128_KEY_CACHE_SLOTS];
+    size_t used;        // 채워진 슬롯 수
+    size_t next;        // 다음에 교체할 슬롯
+    size_t last;        // 마지막으로 찾은 슬롯 (같은 키가 이어질 때 바로 적중)
+} Cmac128KeyCache;
+
+static THREAD_LOCAL Cmac128KeyCache g_key_cache;
+
+const Cmac128KeySchedule* cmac128_key_schedule_get(const uint8_t key[CMAC128_KEY_LENGTH]) {
+#ifdef CMAC128_NATIVE_X86
+    Cmac128KeyCache* cache = &g_key_cache;
+
+    if (cache->used > 0 && memcmp(cache->slots[cache->last].key, key, CMAC128_KEY_LENGTH) == 0) {
+        return &cache->slots[cache->last];
+    }
+    for (size_t i = 0; i < cache->used; i++) {
+        if (memcmp(cache->slots[i].key, key, CMAC128_KEY_LENGTH) == 0) {
+            cache->last = i;
+            return &cache->slots[i];
+        }
+    }
+
+    size_t slot = cache->next;
+    cache->next = (slot + 1) % CMAC128_KEY_CACHE_SLOTS;
+    if (cache->used < CMAC128_KEY_CACHE_SLOTS) {
+        cache->used++;
+    }
+    cmac128_schedule_aesni(&cache->slots[slot], key);
+    cache->last = slot;
+    return &cache->slots[slot];
+#else
+    (void)key;
+    (void)g_key_cache;
+    return NULL;
+#endif
+}
+
+void cmac128_native_compute(const Cmac128KeySchedule* schedule, const uint8_t* message, size_t message_len,
+                            uint8_t tag[CMAC128_TAG_LENGTH]) {
+#ifdef CMAC128_NATIVE_X86
+    cmac128_compute_aesni(schedule, message, message_len, tag);
+#else
+    (void)schedule;
+    (void)message;
+    (void)message_len;
+    memset(tag, 0, CMAC128_TAG_LENGTH);
+#endif
+}
+
+// 키/태그 길이 검사 (EVP 구현과 같은 조건)
+static bool valid_args(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       const unsigned char* tag, size_t tag_len) {
+    return key != NULL && key_len == CMAC128_KEY_LENGTH && (message != NULL || message_len == 0) &&
+           tag != NULL && tag_len > 0 && tag_len <= CMAC128_TAG_LENGTH;
+}
+
+int cmac128_native_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       unsigned char* tag, size_t tag_len) {
+    if (cmac128_native_dispatch() != CMAC128_IMPL_AESNI) {
+        return cmac128_mac(key, key_len, message, message_len, tag, tag_len);
+    }
+    if (!valid_args(key, key_len, message, message_len, tag, tag_len)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    uint8_t full[CMAC128_TAG_LENGTH];
+    cmac128_native_compute(cmac128_key_schedule_get(key), message, message_len, full);
+    memcpy(tag, full, tag_len);
+    return SUCCESS;
+}
+
+int cmac128_native_verify(const unsigned char* key, size_t key_len, const unsigned char* message,
+                          size_t message_len, const unsigned char* tag, size_t tag_len) {
+    if (cmac128_native_dispatch() != CMAC128_IMPL_AESNI) {
+        return cmac128_verify(key, key_len, message, message_len, tag, tag_len);
+    }
+    if (!valid_args(key, key_len, message, message_len, tag, tag_len)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    uint8_t full[CMAC128_TAG_LENGTH];
+    cmac128_native_compute(cmac128_key_schedule_get(key), message, message_len, full);
+    return CRYPTO_memcmp(full, tag, tag_len) == 0 ? SUCCESS : ERR_MAC_VERIFY;
+}
+
+// 한 번에 커널로 넘기는 레코드 수 (스택 배열 크기)
+#define CMAC128_VERIFY_CHUNK 64
+
+int cmac128_native_verify_many(const unsigned char* const keys[], const size_t key_lens[],
+                               const unsigned char* const messages[], const size_t message_lens[],
+                               const unsigned char* const tags[], const size_t tag_lens[],
+                               int results[], size_t count) {
+    if (count > 0 && (keys == NULL || key_lens == NULL || messages == NULL || message_lens == NULL ||
+                      tags == NULL || tag_lens == NULL || results == NULL)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    if (cmac128_native_dispatch() != CMAC128_IMPL_AESNI) {
+        for (size_t i = 0; i < count; i++) {
+            results[i] = cmac128_verify(keys[i], key_lens[i], messages[i], message_lens[i], tags[i], tag_lens[i]);
+        }
+        return SUCCESS;
+    }
+
+#ifdef CMAC128_NATIVE_X86
+    const uint8_t* lane_keys[CMAC128_VERIFY_CHUNK];
+    const uint8_t* lane_msgs[CMAC128_VERIFY_CHUNK];
+    size_t lane_lens[CMAC128_VERIFY_CHUNK];
+    size_t index[CMAC128_VERIFY_CHUNK];
+    uint8_t full[CMAC128_VERIFY_CHUNK][CMAC128_TAG_LENGTH];
+    size_t lanes = cmac128_mb_lanes();
+
+    for (size_t start = 0; start < count; start += CMAC128_VERIFY_CHUNK) {
+        size_t end = count - start < CMAC128_VERIFY_CHUNK ? count : start + CMAC128_VERIFY_CHUNK;
+
+        // 길이가 맞지 않는 레코드는 커널에 넣지 않고 바로 오류로 표시
+        size_t n = 0;
+        for (size_t i = start; i < end; i++) {
+            if (!valid_args(keys[i], key_lens[i], messages[i], message_lens[i], tags[i], tag_lens[i])) {
+                results[i] = ERR_INVALID_INPUT;
+                continue;
+            }
+            lane_keys[n] = keys[i];
+            lane_msgs[n] = messages[i];
+            lane_lens[n] = message_lens[i];
+            index[n++] = i;
+        }
+
+        cmac128_compute_many_aesni(lane_keys, lane_msgs, lane_lens, full, n, lanes);
+
+        for (size_t j = 0; j < n; j++) {
+            size_t i = index[j];
+            results[i] = CRYPTO_memcmp(full[j], tags[i], tag_lens[i]) == 0 ? SUCCESS : ERR_MAC_VERIFY;
+        }
+    }
+#endif
+    return SUCCESS;
+}
@@ -0,0 +1,38 @@
+#include "../../include/common/algorithm_registry.h"
+#include "../../include/algorithm/cmac_128.h"
+#include "../../include/algorithm/cmac_128_native.h"
+#include <string.h>
+#include <stdio.h>
+
+// CMAC-AES128 알고리즘 등록 함수
+void register_cmac128_algorithm(void) {
+    REGISTER_MAC_ALGO(
+        "CMAC-AES128",                // 알고리즘 이름
+        "AES-128 기반 CMAC",          // 설명
+        cmac128_mac,                  // 태그 생성 함수
+        cmac128_verify,               // 태그 검증 함수
+        NULL,                         // 여러 레코드 검증 함수 (없으면 NULL)
+        CMAC128_KEY_LENGTH,           // 키 길이
+        CMAC128_TAG_LENGTH,           // 최대 태그 길이
+        "./test_vectors/CMAC_128",    // 테스트 벡터 경로
+        "Gen",                        // 테스트 유형들...
+        "Ver"
+    );
+
+    // 네이티브 엔진 백엔드 (키 일정과 서브키를 키별로 한 번만 만들어 재사용)
+    char native_desc[MAX_ALGO_DESC / 2];
+    snprintf(native_desc, sizeof(native_desc), "CMAC-AES128 네이티브 엔진 (%s)", cmac128_native_impl_name());
+
+    REGISTER_MAC_ALGO(
+        "CMAC-AES128-NATIVE",         // 알고리즘 이름
+        native_desc,                  // 설명
+        cmac128_native_mac,           // 태그 생성 함수
+        cmac128_native_verify,        // 태그 검증 함수
+        cmac128_native_verify_many,   // 여러 레코드 검증 함수 (없으면 NULL)
+        CMAC128_KEY_LENGTH,           // 키 길이
+        CMAC128_TAG_LENGTH,           // 최대 태그 길이
+        "./test_vectors/CMAC_128",    // 테스트 벡터 경로
+        "Gen",                        // 테스트 유형들...
+        "Ver"
+    );
+}
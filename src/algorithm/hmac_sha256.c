@@ -0,0 +1,265 @@
+#include <openssl/core_names.h>
+#include "../../include/algorithm/hmac_sha256.h"
+#include "../../include/algorithm/hmac_sha256_native.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/mac_backend.h"
+#include "../../include/common/vector_runner.h"
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/perf_counters.h"
+
+// 기본 MAC 백엔드 (EVP)
+static const MacBackend EVP_BACKEND = { hmac_sha256_mac, hmac_sha256_verify };
+
+// 자동/수동 테스트에서 사용할 MAC 백엔드 (배치 작업 스레드마다 따로 설정)
+static THREAD_LOCAL MacBackend g_backend = { hmac_sha256_mac, hmac_sha256_verify };
+
+void hmac_sha256_set_backend(int (*mac_function)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                                 unsigned char*, size_t),
+                             int (*mac_verify)(const unsigned char*, size_t, const unsigned char*, size_t,
+                                               const unsigned char*, size_t)) {
+    mac_backend_set(&g_backend, mac_function, mac_verify, &EVP_BACKEND);
+}
+
+/**
+ * HMAC-SHA256 태그 계산 (EVP 인터페이스 사용)
+ * EVP_MAC_init이 레코드마다 패드 블록을 다시 압축하므로 기준 구현으로만 사용
+ */
+int hmac_sha256_mac(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                    unsigned char* tag, size_t tag_len) {
+    if ((key == NULL && key_len > 0) || (message == NULL && message_len > 0) ||
+        tag == NULL || tag_len == 0 || tag_len > HMAC_SHA256_TAG_LENGTH) {
+        return ERR_INVALID_INPUT;
+    }
+
+    return mac_backend_evp(EVP_CACHE_MAC_HMAC, OSSL_MAC_PARAM_DIGEST, "SHA256", key, key_len,
+                           message, message_len, tag, tag_len, HMAC_SHA256_TAG_LENGTH);
+}
+
+// 태그 검증 (앞 tag_len 바이트를 상수 시간으로 비교)
+int hmac_sha256_verify(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       const unsigned char* tag, size_t tag_len) {
+    return mac_backend_verify(hmac_sha256_mac, key, key_len, message, message_len, tag, tag_len);
+}
+
+// 한 번에 모아서 처리하는 레코드 수
+#define HMAC_BATCH_RECORDS 64
+
+// 배치 아레나 블록 크기 (128바이트 메시지 레코드 수백 개가 한 블록에 들어가도록)
+#define HMAC_BATCH_ARENA (64 * 1024)
+
+// 배치 열: Key(num=Tlen), Msg(num=섹션의 L), 레코드 원문
+// 원문(text)은 Count 줄부터 다음 레코드 직전까지이고, num은 마지막 필드 줄 끝까지의 길이 (Mac 줄을 끼울 자리)
+#define HMAC_COL_KEY  0
+#define HMAC_COL_MSG  1
+#define HMAC_COL_ECHO 2
+#define HMAC_COLUMNS  3
+
+// 레코드 하나의 결과 (파이프라인 결과 버퍼에 그대로 저장)
+typedef struct {
+    uint8_t tag[HMAC_SHA256_TAG_LENGTH];
+    uint8_t skipped;        // SHA-256이 아닌 L 섹션의 레코드 (원문 그대로 에코)
+} HmacSha256Result;
+
+// 파이프라인 콜백 컨텍스트 (작업 스레드는 호출 스레드의 백엔드 설정을 볼 수 없으므로 복사해 전달)
+typedef struct {
+    MacBackend backend;
+    RunnerIo io;
+} HmacSha256PipelineCtx;
+
+// 레코드 하나 계산: Tlen 바이트 태그 생성
+static int compute_record(const MacBackend* backend, const RecordBatch* batch, size_t i,
+                          HmacSha256Result* result) {
+    size_t msg_len = batch->len[HMAC_COL_MSG][i];
+    long long tlen = batch->num[HMAC_COL_KEY][i];
+    PerfMark perf;
+    int ret;
+
+    result->skipped = (batch->num[HMAC_COL_MSG][i] != HMAC_SHA256_L);
+    if (result->skipped) {
+        return SUCCESS;
+    }
+
+    perf_profile_begin(&perf);
+    ret = (tlen > 0 && tlen <= HMAC_SHA256_TAG_LENGTH) ?
+        backend->mac_function(batch->data[HMAC_COL_KEY][i], batch->len[HMAC_COL_KEY][i],
+                              batch->data[HMAC_COL_MSG][i], msg_len, result->tag, (size_t)tlen) :
+        ERR_INVALID_INPUT;
+    perf_profile_end(&perf, msg_len, 1);
+    return ret;
+}
+
+// 파이프라인 계산 단계: 배치 하나의 태그 계산
+static int hmac_sha256_compute_batch(void* user, const RecordBatch* batch, uint8_t* results) {
+    const HmacSha256PipelineCtx* ctx = (const HmacSha256PipelineCtx*)user;
+    HmacSha256Result* out = (HmacSha256Result*)results;
+    int ret = SUCCESS;
+
+    PHASE_START(crypto_mark);
+    for (size_t i = 0; i < batch->count && ret == SUCCESS; i++) {
+        ret = compute_record(&ctx->backend, batch, i, &out[i]);
+    }
+    PHASE_STOP(crypto_mark, PHASE_CRYPTO);
+    return ret;
+}
+
+// 파이프라인 출력 단계: 요청 레코드 원문 뒤에 Mac 기록
+static int hmac_sha256_emit_batch(void* user, const RecordBatch* batch, const uint8_t* results) {
+    HmacSha256PipelineCtx* ctx = (HmacSha256PipelineCtx*)user;
+    const HmacSha256Result* res = (const HmacSha256Result*)results;
+    ResponseWriter* out = &ctx->io.out;
+
+    PHASE_START(format_mark);
+    for (size_t i = 0; i < batch->count; i++) {
+        if (res[i].skipped) {
+            rw_write(out, batch->text[HMAC_COL_ECHO][i].ptr, batch->text[HMAC_COL_ECHO][i].len);
+            continue;
+        }
+        vector_runner_echo_fields(out, batch, HMAC_COL_ECHO, i);
+        rw_field_hex(out, "Mac", res[i].tag, (size_t)batch->num[HMAC_COL_KEY][i]);
+        vector_runner_echo_rest(out, batch, HMAC_COL_ECHO, i);
+    }
+    // 이 배치까지 기록했으므로 원본의 앞부분은 더 이상 참조하지 않음
+    vector_runner_release(&ctx->io, batch, HMAC_COL_ECHO);
+    PHASE_STOP(format_mark, PHASE_FORMAT);
+    return out->error;
+}
+
+// 빈 키/메시지("00" 원문 포함)가 가리킬 자리
+static const uint8_t EMPTY_FIELD[1] = { 0 };
+
+/**
+ * 토크나이저로 읽은 필드 하나를 레코드 열에 저장 (Key/Msg는 원문 길이만큼 디코딩)
+ * Count 줄에서 현재 섹션의 L을 레코드에 기록
+ */
+static int set_record_field(void* user, RecordBatch* batch, size_t idx, const VecToken* token) {
+    bool ok = true;
+
+    if (strview_eq(token->key, "Count")) {
+        batch->num[HMAC_COL_MSG][idx] = *(const long long*)user;
+    } else if (strview_eq(token->key, "Tlen")) {
+        batch->num[HMAC_COL_KEY][idx] = strview_to_ll(token->value, &ok);
+    } else if (strview_eq(token->key, "Key") || strview_eq(token->key, "Msg")) {
+        size_t column = strview_eq(token->key, "Key") ? HMAC_COL_KEY : HMAC_COL_MSG;
+        if (token->value.len == 0) {
+            batch->data[column][idx] = EMPTY_FIELD;
+            return SUCCESS;
+        }
+        return record_batch_set_hex(batch, idx, column, token->value, (token->value.len + 1) / 2);
+    }
+    return ok ? SUCCESS : ERR_INVALID_FORMAT;
+}
+
+// 섹션의 해시 출력 길이 기록 ([L=..], 섹션이 없으면 SHA-256으로 간주)
+static int set_section(void* user, const VecToken* token) {
+    bool ok = true;
+    if (strview_eq(token->key, "L")) {
+        *(long long*)user = strview_to_ll(token->value, &ok);
+    }
+    return ok ? SUCCESS : ERR_INVALID_FORMAT;
+}
+
+/**
+ * 요청 파일을 토크나이저로 직접 읽어 배치 채우기 (.vbin 캐시를 쓰지 않을 때)
+ * 레코드는 Count 줄부터 다음 Count 직전까지이고, 그 줄들(중간의 [L=..] 섹션 줄 포함)을 원문 그대로 에코
+ */
+static int feed_from_reader(Pipeline* pipe, PipelineBatch** current, VectorReader* reader, ResponseWriter* out) {
+    long long section_l = HMAC_SHA256_L;
+    return vector_runner_feed_counted(pipe, current, reader, out, HMAC_COL_ECHO, set_record_field, set_section,
+                                      &section_l);
+}
+
+/**
+ * 디코딩된 레코드로 배치 채우기
+ * 키/메시지 바이트는 캐시를 그대로 가리키고, 에코 원문은 원본 파일의 레코드 범위
+ */
+static int feed_from_cache(Pipeline* pipe, PipelineBatch** current, const VectorCache* cache, ResponseWriter* out) {
+    const DecodedVectors* vectors = &cache->vectors;
+    const VectorSchema* schema = vectors->schema;
+    int l_field = vector_schema_field(schema, "L");
+    int tlen_field = vector_schema_field(schema, "Tlen");
+    int key_field = vector_schema_field(schema, "Key");
+    int msg_field = vector_schema_field(schema, "Msg");
+    RecordBatch* batch = &(*current)->records;
+
+    // 헤더 정복사 (첫 Count 전까지)
+    vector_runner_echo_header(out, cache);
+
+    for (size_t i = 0; i < vectors->count; i++) {
+        const SchemaValue* l = decoded_value(vectors, i, l_field);
+        const SchemaValue* tlen = decoded_value(vectors, i, tlen_field);
+        const SchemaValue* key = decoded_value(vectors, i, key_field);
+        const SchemaValue* msg = decoded_value(vectors, i, msg_field);
+        // 필드가 빠진 레코드는 오류로 처리 (건너뛰면 원문이 앞 레코드에 섞임)
+        if (!tlen->present || !key->present || !msg->present) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        size_t idx = record_batch_push(batch);
+        batch->num[HMAC_COL_KEY][idx] = tlen->num;
+        batch->data[HMAC_COL_KEY][idx] = key->len > 0 ? decoded_bytes(vectors, key) : EMPTY_FIELD;
+        batch->len[HMAC_COL_KEY][idx] = key->len;
+        batch->num[HMAC_COL_MSG][idx] = l->present ? l->num : HMAC_SHA256_L;
+        batch->data[HMAC_COL_MSG][idx] = msg->len > 0 ? decoded_bytes(vectors, msg) : EMPTY_FIELD;
+        batch->len[HMAC_COL_MSG][idx] = msg->len;
+
+        vector_runner_set_echo(batch, idx, HMAC_COL_ECHO, cache, i);
+
+        batch = vector_runner_submit_if_full(pipe, current, false);
+        if (pipeline_failed(pipe)) break;
+    }
+    return SUCCESS;
+}
+
+/**
+ * HMAC-SHA256 테스트 실행
+ * .vbin 캐시가 켜져 있으면 디코딩된 레코드를, 아니면 공용 토크나이저로 읽은 레코드를 배치로 모으고,
+ * 레코드 파이프라인으로 여러 스레드에서 계산한 뒤 원래 순서대로 출력
+ */
+int hmac_sha256_test(const char* input_file, const char* output_file) {
+    HmacSha256PipelineCtx pipe_ctx = { g_backend, { { 0 }, NULL } };
+    VectorRunner runner = {
+        "HMAC",
+        { HMAC_BATCH_RECORDS, HMAC_COLUMNS, HMAC_BATCH_ARENA, sizeof(HmacSha256Result),
+          hmac_sha256_compute_batch, hmac_sha256_emit_batch, &pipe_ctx },
+        feed_from_cache, feed_from_reader, &pipe_ctx.io
+    };
+    return vector_runner_run(&runner, input_file, output_file);
+}
+
+// 자동 테스트 구현
+int hmac_sha256_run_auto_test(int test_type_id) {
+    if (test_type_id != HMAC_TEST_GEN) {
+        return ERR_INVALID_TEST_TYPE;
+    }
+
+    return vector_runner_auto_test("HMAC_256", "HMAC.req", hmac_sha256_test);
+}
+
+// 수동 테스트 구현 (키는 16진수, 메시지는 선택한 입력 유형)
+int hmac_sha256_run_manual_test(int input_type_id) {
+    uint8_t key[MAX_LINE_LENGTH / 2];
+    size_t key_len = 0;
+
+    int result = mac_backend_read_hex("키를 16진수로 입력하세요 (빈 줄이면 빈 키):", key, sizeof(key), &key_len);
+    if (result != SUCCESS) {
+        return ERR_INVALID_INPUT;
+    }
+
+    uint8_t message[MAX_LINE_LENGTH / 2];
+    size_t message_len = 0;
+    result = mac_backend_read_message(input_type_id, message, sizeof(message), &message_len);
+    if (result != SUCCESS) {
+        return result;
+    }
+
+    uint8_t tag[HMAC_SHA256_TAG_LENGTH];
+    result = g_backend.mac_function(key, key_len, message, message_len, tag, sizeof(tag));
+    if (result == SUCCESS) {
+        printf("\n[키 길이] %zu 바이트, [입력 길이] %zu 바이트\n", key_len, message_len);
+        mac_backend_print_tag("HMAC-SHA256", tag, sizeof(tag));
+    }
+
+    return result;
+}
@@ -0,0 +1,135 @@
+#include "../../include/algorithm/hmac_sha256_native.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <openssl/crypto.h>
+
+// HMAC 패드 바이트 (FIPS 198-1)
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+/**
+ * 패드 블록 하나를 압축한 중간 상태 계산
+ * 내부/외부 해시는 항상 이 블록으로 시작하므로 키마다 한 번만 압축하면 됨
+ */
+static void pad_midstate(uint32_t state[8], const uint8_t k0[HMAC_SHA256_BLOCK_SIZE], uint8_t pad) {
+    uint8_t block[HMAC_SHA256_BLOCK_SIZE];
+    for (int i = 0; i < HMAC_SHA256_BLOCK_SIZE; i++) {
+        block[i] = (uint8_t)(k0[i] ^ pad);
+    }
+    memcpy(state, sha256_h0, 8 * sizeof(uint32_t));
+    sha256_native_compress(state, block, 1);
+    OPENSSL_cleanse(block, sizeof(block));
+}
+
+void hmac_sha256_key_state_init(HmacSha256KeyState* state, const uint8_t* key, size_t key_len) {
+    uint8_t k0[HMAC_SHA256_BLOCK_SIZE] = { 0 };
+
+    // K0: 블록보다 긴 키는 해시값, 나머지는 0으로 채운 키
+    if (key_len > HMAC_SHA256_BLOCK_SIZE) {
+        sha256_native_hash(key, key_len, k0);
+    } else if (key_len > 0) {
+        memcpy(k0, key, key_len);
+    }
+    pad_midstate(state->inner, k0, HMAC_IPAD);
+    pad_midstate(state->outer, k0, HMAC_OPAD);
+    OPENSSL_cleanse(k0, sizeof(k0));
+
+    state->key_len = key_len;
+    if (key_len > 0 && key_len <= HMAC_SHA256_CACHE_KEY_MAX) {
+        memcpy(state->key, key, key_len);
+    }
+}
+
+// 스레드별 키 캐시 (슬롯이 다 차면 가장 먼저 만든 슬롯부터 교체)
+typedef struct {
+    HmacSha256KeyState slots[HMAC_SHA256_KEY_CACHE_SLOTS];
+    size_t used;        // 채워진 슬롯 수
+    size_t next;        // 다음에 교체할 슬롯
+    size_t last;        // 마지막으로 찾은 슬롯 (같은 키가 이어질 때 바로 적중)
+} HmacSha256KeyCache;
+
+static THREAD_LOCAL HmacSha256KeyCache g_key_cache;
+
+static bool slot_matches(const HmacSha256KeyState* slot, const uint8_t* key, size_t key_len) {
+    return slot->key_len == key_len && (key_len == 0 || memcmp(slot->key, key, key_len) == 0);
+}
+
+const HmacSha256KeyState* hmac_sha256_key_state_get(const uint8_t* key, size_t key_len,
+                                                    HmacSha256KeyState* scratch) {
+    if (key_len > HMAC_SHA256_CACHE_KEY_MAX) {
+        hmac_sha256_key_state_init(scratch, key, key_len);
+        return scratch;
+    }
+
+    HmacSha256KeyCache* cache = &g_key_cache;
+
+    if (cache->used > 0 && slot_matches(&cache->slots[cache->last], key, key_len)) {
+        return &cache->slots[cache->last];
+    }
+    for (size_t i = 0; i < cache->used; i++) {
+        if (slot_matches(&cache->slots[i], key, key_len)) {
+            cache->last = i;
+            return &cache->slots[i];
+        }
+    }
+
+    size_t slot = cache->next;
+    cache->next = (slot + 1) % HMAC_SHA256_KEY_CACHE_SLOTS;
+    if (cache->used < HMAC_SHA256_KEY_CACHE_SLOTS) {
+        cache->used++;
+    }
+    hmac_sha256_key_state_init(&cache->slots[slot], key, key_len);
+    cache->last = slot;
+    return &cache->slots[slot];
+}
+
+void hmac_sha256_native_compute(const HmacSha256KeyState* state, const uint8_t* message, size_t message_len,
+                                uint8_t tag[HMAC_SHA256_TAG_LENGTH]) {
+    Sha256NativeCtx ctx;
+    uint8_t inner[SHA256_DIGEST_LENGTH];
+
+    // 내부 해시: H((K0⊕ipad) || msg), 패드 블록은 이미 압축됨
+    sha256_native_ctx_resume(&ctx, state->inner, HMAC_SHA256_BLOCK_SIZE);
+    if (message_len > 0) {
+        sha256_native_ctx_update(&ctx, message, message_len);
+    }
+    sha256_native_ctx_final(&ctx, inner);
+
+    // 외부 해시: H((K0⊕opad) || inner), 32바이트와 패딩이 블록 하나에 들어감
+    sha256_native_ctx_resume(&ctx, state->outer, HMAC_SHA256_BLOCK_SIZE);
+    sha256_native_ctx_update(&ctx, inner, sizeof(inner));
+    sha256_native_ctx_final(&ctx, tag);
+}
+
+// 키/태그 길이 검사 (EVP 구현과 같은 조건)
+static bool valid_args(const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                       const unsigned char* tag, size_t tag_len) {
+    return (key != NULL || key_len == 0) && (message != NULL || message_len == 0) &&
+           tag != NULL && tag_len > 0 && tag_len <= HMAC_SHA256_TAG_LENGTH;
+}
+
+int hmac_sha256_native_mac(const unsigned char* key, size_t key_len, const unsigned char* message,
+                           size_t message_len, unsigned char* tag, size_t tag_len) {
+    if (!valid_args(key, key_len, message, message_len, tag, tag_len)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    HmacSha256KeyState scratch;
+    uint8_t full[HMAC_SHA256_TAG_LENGTH];
+    hmac_sha256_native_compute(hmac_sha256_key_state_get(key, key_len, &scratch), message, message_len, full);
+    memcpy(tag, full, tag_len);
+    return SUCCESS;
+}
+
+int hmac_sha256_native_verify(const unsigned char* key, size_t key_len, const unsigned char* message,
+                              size_t message_len, const unsigned char* tag, size_t tag_len) {
+    if (!valid_args(key, key_len, message, message_len, tag, tag_len)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    HmacSha256KeyState scratch;
+    uint8_t full[HMAC_SHA256_TAG_LENGTH];
+    hmac_sha256_native_compute(hmac_sha256_key_state_get(key, key_len, &scratch), message, message_len, full);
+    return CRYPTO_memcmp(full, tag, tag_len) == 0 ? SUCCESS : ERR_MAC_VERIFY;
+}
@@ -0,0 +1,37 @@
+#include "../../include/common/algorithm_registry.h"
+#include "../../include/algorithm/hmac_sha256.h"
+#include "../../include/algorithm/hmac_sha256_native.h"
+#include "../../include/algorithm/sha256_native.h"
+#include <string.h>
+#include <stdio.h>
+
+// HMAC-SHA256 알고리즘 등록 함수
+void register_hmac_sha256_algorithm(void) {
+    REGISTER_MAC_ALGO(
+        "HMAC-SHA256",                // 알고리즘 이름
+        "SHA-256 기반 HMAC",          // 설명
+        hmac_sha256_mac,              // 태그 생성 함수
+        hmac_sha256_verify,           // 태그 검증 함수
+        NULL,                         // 여러 레코드 검증 함수 (없으면 NULL)
+        0,                            // 키 길이 (가변)
+        HMAC_SHA256_TAG_LENGTH,       // 최대 태그 길이
+        "./test_vectors/HMAC_256",    // 테스트 벡터 경로
+        "HMAC"                        // 테스트 유형들...
+    );
+
+    // 네이티브 엔진 백엔드 (패드 블록 중간 상태를 키별로 한 번만 만들어 재사용)
+    char native_desc[MAX_ALGO_DESC / 2];
+    snprintf(native_desc, sizeof(native_desc), "HMAC-SHA256 네이티브 엔진 (%s)", sha256_native_impl_name());
+
+    REGISTER_MAC_ALGO(
+        "HMAC-SHA256-NATIVE",         // 알고리즘 이름
+        native_desc,                  // 설명
+        hmac_sha256_native_mac,       // 태그 생성 함수
+        hmac_sha256_native_verify,    // 태그 검증 함수
+        NULL,                         // 여러 레코드 검증 함수 (없으면 NULL)
+        0,                            // 키 길이 (가변)
+        HMAC_SHA256_TAG_LENGTH,       // 최대 태그 길이
+        "./test_vectors/HMAC_256",    // 테스트 벡터 경로
+        "HMAC"                        // 테스트 유형들...
+    );
+}
@@ -1,58 +1,74 @@
 #include <openssl/evp.h>
 #include "../../include/algorithm/sha256.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/algorithm/sha256_mb.h"
+#include "../../include/algorithm/sha256_monte.h"
 #include "../../include/common/error.h"
 #include "../../include/common/common.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/vector_runner.h"
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/perf_counters.h"
 #include <ctype.h>
 
+// 해시 백엔드 (AlgorithmConfig.ops.hash 슬롯과 같은 구성)
+typedef struct {
+    int (*hash_function)(const uint8_t* input, size_t input_len, uint8_t* output);
+    int (*hash_init)(void** ctx);
+    int (*hash_update)(void* ctx, const unsigned char* input, size_t input_len);
+    int (*hash_final)(void* ctx, unsigned char* output);
+} Sha256Backend;
+
+// 자동/수동 테스트에서 사용할 해시 백엔드 (기본값: EVP, 배치 작업 스레드마다 따로 설정)
+static THREAD_LOCAL Sha256Backend g_backend = { sha256_hash, sha256_init, sha256_update, sha256_final };
+
+/**
+ * 테스트에 사용할 해시 백엔드 설정 (NULL이면 EVP 기본값 사용)
+ */
+void sha256_set_backend(int (*hash_function)(const uint8_t*, size_t, uint8_t*),
+                        int (*hash_init)(void**),
+                        int (*hash_update)(void*, const unsigned char*, size_t),
+                        int (*hash_final)(void*, unsigned char*)) {
+    g_backend.hash_function = hash_function ? hash_function : sha256_hash;
+    g_backend.hash_init = hash_init ? hash_init : sha256_init;
+    g_backend.hash_update = hash_update ? hash_update : sha256_update;
+    g_backend.hash_final = hash_final ? hash_final : sha256_final;
+}
+
 /**
  * SHA-256 해시 계산 (EVP 인터페이스 사용)
+ * 한 번 가져온 EVP_MD와 스레드별 컨텍스트를 재사용하므로 메시지마다 할당하지 않음
  */
 int sha256_hash(const uint8_t* message, size_t message_len, uint8_t* digest) {
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    if (ctx == NULL) {
+    const EVP_MD* md = evp_cache_md(EVP_CACHE_MD_SHA256);
+    EVP_MD_CTX* ctx = evp_cache_md_ctx();
+    if (md == NULL || ctx == NULL) {
         return ERR_SHA256_INIT;
     }
     
-    int ret = SUCCESS;
-    
-    // 초기화
-    if (EVP_DigestInit_ex(ctx, EVP_sha256(), NULL) != 1) {
-        ret = ERR_SHA256_INIT;
-        goto cleanup;
+    // 초기화 (같은 EVP_MD면 기존 provider 컨텍스트를 재초기화)
+    if (EVP_DigestInit_ex2(ctx, md, NULL) != 1) {
+        return ERR_SHA256_INIT;
     }
     
-    // 대용량 데이터를 청크 단위로 처리
-    const size_t CHUNK_SIZE = 8192;  // 8KB 청크
-    size_t processed = 0;
-    
-    while (processed < message_len) {
-        size_t chunk = (message_len - processed < CHUNK_SIZE) ? 
-                      (message_len - processed) : CHUNK_SIZE;
-        
-        if (EVP_DigestUpdate(ctx, message + processed, chunk) != 1) {
-            ret = ERR_SHA256_UPDATE;
-            goto cleanup;
-        }
-        
-        processed += chunk;
+    if (EVP_DigestUpdate(ctx, message, message_len) != 1) {
+        return ERR_SHA256_UPDATE;
     }
     
     // 해시 값 계산
     unsigned int digest_len = 0;
     if (EVP_DigestFinal_ex(ctx, digest, &digest_len) != 1) {
-        ret = ERR_SHA256_FINAL;
-        goto cleanup;
+        return ERR_SHA256_FINAL;
     }
     
     // 다이제스트 길이 검증 (SHA-256은 항상 32바이트)
     if (digest_len != SHA256_DIGEST_LENGTH) {
-        ret = ERR_SHA256_HASH;
+        return ERR_SHA256_HASH;
     }
     
-cleanup:
-    // 리소스 정리
-    EVP_MD_CTX_free(ctx);
-    return ret;
+    return SUCCESS;
 }
 
 /**
@@ -87,291 +103,427 @@ TestType sha256_detect_test_type(const char* filename) {
     return TEST_SHORT_MSG;
 }
 
+// 한 번에 모아서 해시하는 레코드 수
+#define SHA256_BATCH_RECORDS 64
+
+// 이보다 큰 메시지는 배치에 담지 않고 스트리밍으로 해시 (바이트)
+#define SHA256_STREAM_THRESHOLD (64 * 1024)
+
+// 스트리밍 디코딩 청크 크기 (16진수 문자)
+#define SHA256_STREAM_CHUNK 16384
+
+// 배치 아레나 블록 크기 (배치 하나의 디코딩 메시지가 대부분 한 블록에 들어가도록)
+#define SHA256_BATCH_ARENA (256 * 1024)
+
+// 몬테 카를로 반복 n번의 해시 입력 크기 (반복마다 다이제스트 3개를 이어 붙여 해시)
+#define MONTE_PERF_BYTES(n) ((size_t)(n) * 3 * SHA256_DIGEST_LENGTH)
+
+// 배치 열: Len 값(num), Msg 원문(text)과 디코딩 결과(data/len)
+// 스트리밍 대상 레코드는 data가 NULL이고 혼자 한 배치를 차지
+#define SHA256_COL_MSG 0
+
+// 파이프라인 콜백 컨텍스트 (작업 스레드는 호출 스레드의 백엔드 설정을 볼 수 없으므로 복사해 전달)
+typedef struct {
+    Sha256Backend backend;
+    RunnerIo io;
+} Sha256PipelineCtx;
+
 /**
- * SHA-256 테스트 실행 (ShortMsg, LongMsg 테스트)
+ * 배치 해시: 네이티브 백엔드는 다중 레인 API, 그 외 백엔드는 메시지별 호출
  */
-int sha256_test(const char* input_file, const char* output_file) {
-    FILE* fp = fopen(input_file, "r");
-    if (!fp) {
-        print_error(ERR_FILE_OPEN);
-        return ERR_FILE_OPEN;
+static int hash_batch(const Sha256Backend* backend, const uint8_t* const msgs[], const size_t lens[],
+                      uint8_t (*digests)[SHA256_DIGEST_LENGTH], size_t n) {
+    PerfMark perf;
+
+    if (backend->hash_function == sha256_native_hash) {
+        perf_profile_begin(&perf);
+        int ret = sha256_hash_many(msgs, lens, digests, n);
+        if (perf.active) {
+            size_t bytes = 0;
+            for (size_t i = 0; i < n; i++) bytes += lens[i];
+            perf_profile_end(&perf, bytes, n);
+        }
+        return ret;
     }
 
-    FILE* out_fp = fopen(output_file, "w");
-    if (!out_fp) {
-        fclose(fp);
-        print_error(ERR_FILE_CREATE);
-        return ERR_FILE_CREATE;
+    for (size_t i = 0; i < n; i++) {
+        perf_profile_begin(&perf);
+        int ret = backend->hash_function(msgs[i], lens[i], digests[i]);
+        perf_profile_end(&perf, lens[i], 1);
+        if (ret != SUCCESS) {
+            return ERR_SHA256_HASH;
+        }
     }
+    return SUCCESS;
+}
 
-    char line[MAX_LINE_LENGTH];
-    uint8_t* message = NULL;  // 동적 메시지 버퍼
-    uint8_t digest[SHA256_DIGEST_LENGTH];
-    size_t message_len;
-    int test_count = 0;
-    char *msg_buffer = NULL;  // 16진수 문자열을 위한 동적 버퍼
-
-    // 헤더 정복사
-    while (fgets(line, sizeof(line), fp)) {
-        if (strncmp(line, "Len", 3) == 0) break;
-        fputs(line, out_fp);
-    }
-
-    // 테스트 벡터 처리
-    while (!feof(fp)) {
-        if (strncmp(line, "Len", 3) == 0) {
-            int len_bits = 0;
-            
-            if (sscanf(line, "Len = %d", &len_bits) != 1 || len_bits < 0) {
-                if (!fgets(line, sizeof(line), fp)) break;
-                continue;
-            }
-            
-            message_len = (size_t)((len_bits + 7) / 8);  // 비트를 바이트로 변환
-            
-            // 메시지 버퍼 할당 (이전 버퍼 해제 후)
-            if (message != NULL) {
-                free(message);
-            }
-            message = (uint8_t*)malloc(message_len + 16);  // 여유있게 할당
-            if (message == NULL) {
-                if (!fgets(line, sizeof(line), fp)) break;
-                continue;
-            }
-            
-            // 원본 Len 값 그대로 출력
-            fprintf(out_fp, "Len = %d\n", len_bits);
-            
-            // Msg 읽기
-            if (!fgets(line, sizeof(line), fp)) {
-                free(message);
-                message = NULL;
-                break;
-            }
-            
-            // Msg 값 그대로 출력
-            fputs(line, out_fp);
-            
-            // Msg 내용 파싱 및 해시 계산
-            if (strncmp(line, "Msg", 3) == 0) {
-                char* msg_hex = strchr(line, '=');
-                if (msg_hex) {
-                    msg_hex++;  // = 다음으로 이동
-                    while(*msg_hex == ' ') msg_hex++;  // 공백 건너뛰기
-
-                    
-                    // 개행 문자 제거
-                    char* newline = strchr(msg_hex, '\n');
-                    if (newline) *newline = '\0';
-                    newline = strchr(msg_hex, '\r');
-                    if (newline) *newline = '\0';
-                    
-                    // 메시지의 예상 16진수 길이 계산 (바이트 당 2자리)
-                    size_t expected_hex_len = message_len * 2;
-                    
-                    // 동적으로 충분히 큰 버퍼 할당
-                    msg_buffer = (char*)malloc(expected_hex_len + 100);
-                    if (!msg_buffer) {
-                        free(message);
-                        message = NULL;
-                        fclose(fp);
-                        fclose(out_fp);
-                        return ERR_MEMORY_ALLOC;
-                    }
-                    msg_buffer[0] = '\0';  // 빈 문자열로 초기화
-                    
-                    // 첫 줄 복사
-                    strcpy(msg_buffer, msg_hex);
-                    
-                    // 현재 16진수 길이
-                    size_t current_hex_len = strlen(msg_buffer);
-                    
-                    // 추가 라인이 필요한 경우 계속 읽기
-                    while (current_hex_len < expected_hex_len) {
-                        if (!fgets(line, sizeof(line), fp)) break;
-                        
-                        // 다음 라인이 "Len"으로 시작하면 메시지가 완료된 것
-                        if (strncmp(line, "Len", 3) == 0) {
-                            break;
-                        }
-                        
-                        // 공백과 탭 문자 건너뛰기
-                        char* ptr = line;
-                        while (*ptr && (isspace(*ptr) || *ptr == '\t')) ptr++;
-                        
-                        // 개행 문자 제거
-                        newline = strchr(ptr, '\n');
-                        if (newline) *newline = '\0';
-                        newline = strchr(ptr, '\r');
-                        if (newline) *newline = '\0';
-                        
-                        // 비어있지 않은 경우에만 추가
-                        if (*ptr) {
-                            // 버퍼 크기 검사
-                            if (current_hex_len + strlen(ptr) >= expected_hex_len + 100) {
-                                // 버퍼 확장 필요
-                                size_t new_size = current_hex_len + strlen(ptr) + 200;
-                                char* new_buffer = (char*)realloc(msg_buffer, new_size);
-                                if (!new_buffer) {
-                                    break;
-                                }
-                                msg_buffer = new_buffer;
-                            }
-                            
-                            // 메시지에 추가
-                            strcat(msg_buffer, ptr);
-                            current_hex_len = strlen(msg_buffer);
-                        }
-                    }
-                    
-                    // Len=0 특수 케이스 (입력이 실제로 비어있을 때만)
-                    if (len_bits == 0 && (msg_buffer[0] == '\0' || strcmp(msg_buffer, "00") == 0)) {
-                        memset(message, 0, 1);  // 최소 1바이트 초기화
-                        message_len = 0;
-                    } else {
-                        int bytes_converted = hex_to_bytes(msg_buffer, message, message_len);
-                        
-                        if (bytes_converted < 0) {
-                            print_error(bytes_converted);
-                            free(message);
-                            free(msg_buffer);
-                            fclose(fp);
-                            fclose(out_fp);
-                            return bytes_converted;
-                        } else if ((size_t)bytes_converted != message_len) {
-                            // 경고만 출력하고 계속 진행
-                        }
-                    }
-                    
-                    // SHA-256 해시 계산
-                    int hash_result = sha256_hash(message, message_len, digest);
-                    
-                    if (hash_result != 0) {
-                        free(message);
-                        free(msg_buffer);
-                        fclose(fp);
-                        fclose(out_fp);
-                        return ERR_SHA256_HASH;
-                    }
-                    
-                    // MD 값 출력
-                    fprintf(out_fp, "MD = ");
-                    for (size_t i = 0; i < SHA256_DIGEST_LENGTH; i++) {
-                        fprintf(out_fp, "%02x", digest[i]);
-                    }
-                    fprintf(out_fp, "\n\n");
-                    
-                    test_count++;
-                }
+// Len/Msg/MD 레코드 출력
+static void write_msg_record(ResponseWriter* out, int len_bits, StrView msg_hex,
+                             const uint8_t digest[SHA256_DIGEST_LENGTH]) {
+    rw_field_int(out, "Len", len_bits);
+    rw_field_str(out, "Msg", msg_hex.ptr, msg_hex.len);
+    rw_field_hex(out, "MD", digest, SHA256_DIGEST_LENGTH);
+    rw_putc(out, '\n');
+}
+
+/**
+ * 큰 Msg 레코드 스트리밍 해시
+ * 16진수 값을 청크 단위로 디코딩해 hash_update로 넘기므로 메시지 길이와 무관하게
+ * 청크 버퍼만큼의 메모리로 선형 시간에 처리
+ * 정확히 message_len 바이트를 해시하고, 16진수가 그보다 짧으면 ERR_INVALID_FORMAT
+ */
+static int stream_msg_digest(const Sha256Backend* backend, StrView msg_hex, size_t message_len,
+                             uint8_t digest[SHA256_DIGEST_LENGTH]) {
+    uint8_t decoded[SHA256_STREAM_CHUNK / 2 + 1];
+    HexStreamState hex_state;
+    void* ctx = NULL;
+    size_t hashed = 0;
+    int ret = SUCCESS;
+
+    if (backend->hash_init(&ctx) != SUCCESS) {
+        return ERR_SHA256_INIT;
+    }
+
+    hex_stream_init(&hex_state);
+
+    for (size_t off = 0; off < msg_hex.len && hashed < message_len && ret == SUCCESS; off += SHA256_STREAM_CHUNK) {
+        size_t n = msg_hex.len - off < SHA256_STREAM_CHUNK ? msg_hex.len - off : SHA256_STREAM_CHUNK;
+        size_t decoded_len = 0;
+
+        PHASE_START(hex_mark);
+        ret = hex_stream_decode(&hex_state, msg_hex.ptr + off, n, decoded, &decoded_len);
+        PHASE_STOP(hex_mark, PHASE_HEX);
+        if (decoded_len > message_len - hashed) {
+            decoded_len = message_len - hashed;
+        }
+        hashed += decoded_len;
+        if (ret == SUCCESS && decoded_len > 0) {
+            PerfMark perf;
+            perf_profile_begin(&perf);
+            ret = backend->hash_update(ctx, decoded, decoded_len);
+            perf_profile_end(&perf, decoded_len, 1);
+        }
+    }
+
+    if (ret == SUCCESS && hashed != message_len) {
+        ret = ERR_INVALID_FORMAT;
+    }
+
+    // final이 컨텍스트를 해제하므로 오류 시에도 호출
+    if (backend->hash_final(ctx, digest) != SUCCESS && ret == SUCCESS) {
+        ret = ERR_SHA256_FINAL;
+    }
+    return ret;
+}
+
+// 파이프라인 계산 단계: 배치 하나의 다이제스트 계산
+static int sha256_compute_batch(void* user, const RecordBatch* batch, uint8_t* results) {
+    const Sha256PipelineCtx* ctx = (const Sha256PipelineCtx*)user;
+    uint8_t (*digests)[SHA256_DIGEST_LENGTH] = (uint8_t (*)[SHA256_DIGEST_LENGTH])results;
+    int ret = SUCCESS;
+
+    PHASE_START(crypto_mark);
+    if (batch->count == 1 && batch->data[SHA256_COL_MSG][0] == NULL) {
+        ret = stream_msg_digest(&ctx->backend, batch->text[SHA256_COL_MSG][0], batch->len[SHA256_COL_MSG][0],
+                                digests[0]);
+    } else if (hash_batch(&ctx->backend, batch->data[SHA256_COL_MSG], batch->len[SHA256_COL_MSG],
+                          digests, batch->count) != SUCCESS) {
+        ret = ERR_SHA256_HASH;
+    }
+    PHASE_STOP(crypto_mark, PHASE_CRYPTO);
+    return ret;
+}
+
+// 파이프라인 출력 단계: Len/Msg/MD 기록
+static int sha256_emit_batch(void* user, const RecordBatch* batch, const uint8_t* results) {
+    Sha256PipelineCtx* ctx = (Sha256PipelineCtx*)user;
+
+    PHASE_START(format_mark);
+    for (size_t i = 0; i < batch->count; i++) {
+        write_msg_record(&ctx->io.out, (int)batch->num[SHA256_COL_MSG][i], batch->text[SHA256_COL_MSG][i],
+                         results + i * SHA256_DIGEST_LENGTH);
+    }
+    // 이 배치까지 기록했으므로 원본의 앞부분은 더 이상 참조하지 않음
+    vector_runner_release(&ctx->io, batch, SHA256_COL_MSG);
+    PHASE_STOP(format_mark, PHASE_FORMAT);
+    return ctx->io.out.error;
+}
+
+/**
+ * 요청 파일을 토크나이저로 직접 읽어 배치 채우기 (.vbin 캐시를 쓰지 않을 때)
+ * 큰 메시지는 디코딩하지 않고 단독 배치로 넘겨 스트리밍 해시
+ */
+static int feed_from_reader(Pipeline* pipe, PipelineBatch** current, VectorReader* reader, ResponseWriter* out) {
+    RecordBatch* batch = &(*current)->records;
+    VecToken token;
+    bool in_header = true;
+
+    while (vector_reader_next(reader, &token)) {
+        bool is_len = (token.type == VEC_TOKEN_FIELD && strview_eq(token.key, "Len"));
+
+        // 헤더 정복사 (첫 Len 전까지)
+        if (in_header && !is_len) {
+            vector_runner_echo_line(out, &token);
+            continue;
+        }
+        in_header = false;
+        if (!is_len) continue;
+
+        bool ok = false;
+        long long len_value = strview_to_ll(token.value, &ok);
+        if (!ok || len_value < 0 || len_value > INT32_MAX) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        int len_bits = (int)len_value;
+        size_t message_len = (size_t)((len_value + 7) / 8);  // 비트를 바이트로 변환
+
+        // Msg 읽기
+        if (!vector_reader_next_field(reader, &token) || !strview_eq(token.key, "Msg")) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        bool stream = message_len > SHA256_STREAM_THRESHOLD;
+        if (stream && batch->count > 0) {
+            batch = vector_runner_submit_if_full(pipe, current, true);
+        }
+
+        size_t idx = record_batch_push(batch);
+        batch->num[SHA256_COL_MSG][idx] = len_bits;
+        batch->text[SHA256_COL_MSG][idx] = token.value;
+
+        if (stream) {
+            // 스트리밍 레코드도 배치 경로와 같이 Msg가 정확히 Len 바이트여야 함
+            if (token.value.len != 2 * message_len) {
+                return ERR_INVALID_FORMAT;
             }
+            batch->len[SHA256_COL_MSG][idx] = message_len;
         } else {
-            // 메시지를 모두 읽은 후 다음 Len 라인
-            if (!fgets(line, sizeof(line), fp)) break;
+            // Msg는 정확히 Len 바이트 (Len=0은 빈 값이나 "00")
+            int ret = record_batch_set_hex_exact(batch, idx, SHA256_COL_MSG, token.value, message_len);
+            if (ret != SUCCESS) {
+                return ret;
+            }
         }
-    }
 
-    // 동적 메모리 해제
-    if (msg_buffer) {
-        free(msg_buffer);
+        batch = vector_runner_submit_if_full(pipe, current, stream);
+        if (pipeline_failed(pipe)) break;
     }
-    if (message) {
-        free(message);
+
+    // 손상된 압축 파일은 풀린 데까지만 토큰이 나오므로 여기서 오류로 처리
+    return vector_reader_error(reader);
+}
+
+/**
+ * 디코딩된 레코드로 배치 채우기
+ * 메시지 바이트는 캐시(매핑 또는 디코딩 버퍼)를 그대로 가리키므로 16진수 디코딩과 복사가 없음
+ * 캐시에 넣지 않은 큰 메시지는 원본의 16진수를 그대로 넘겨 스트리밍
+ */
+static int feed_from_cache(Pipeline* pipe, PipelineBatch** current, const VectorCache* cache, ResponseWriter* out) {
+    const DecodedVectors* vectors = &cache->vectors;
+    const char* source = cache->source.data;
+    int len_field = vector_schema_field(vectors->schema, "Len");
+    int msg_field = vector_schema_field(vectors->schema, "Msg");
+    RecordBatch* batch = &(*current)->records;
+
+    // 헤더 정복사 (첫 Len 전까지)
+    vector_runner_echo_header(out, cache);
+
+    for (size_t i = 0; i < vectors->count; i++) {
+        const SchemaValue* len_value = decoded_value(vectors, i, len_field);
+        const SchemaValue* msg = decoded_value(vectors, i, msg_field);
+        // Len/Msg가 빠지거나 잘못된 레코드는 토크나이저 경로와 같이 오류로 처리
+        if (!len_value->present || !msg->present || len_value->num < 0 || len_value->num > INT32_MAX) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        // Msg는 토크나이저 경로와 같이 정확히 Len 바이트 (Len=0은 빈 값이나 "00")
+        size_t message_len = (size_t)((len_value->num + 7) / 8);
+        if (!decoded_len_is(vectors, msg, message_len)) {
+            return ERR_INVALID_FORMAT;
+        }
+
+        // 캐시에 원문 위치만 있는 큰 메시지는 토크나이저 경로와 같이 단독 배치로 스트리밍
+        bool stream = decoded_text_only(msg);
+        if (stream && batch->count > 0) {
+            batch = vector_runner_submit_if_full(pipe, current, true);
+        }
+
+        size_t idx = record_batch_push(batch);
+        batch->num[SHA256_COL_MSG][idx] = len_value->num;
+        batch->text[SHA256_COL_MSG][idx] = decoded_text(source, msg);
+        batch->data[SHA256_COL_MSG][idx] = stream ? NULL : decoded_bytes(vectors, msg);
+        batch->len[SHA256_COL_MSG][idx] = message_len;
+
+        batch = vector_runner_submit_if_full(pipe, current, stream);
+        if (pipeline_failed(pipe)) break;
     }
-    
-    fclose(fp);
-    fclose(out_fp);
     return SUCCESS;
 }
 
 /**
- * SHA-256 몬테 카를로 테스트 실행
+ * SHA-256 테스트 실행 (ShortMsg, LongMsg 테스트)
+ * .vbin 캐시가 켜져 있으면 디코딩된 레코드를, 아니면 공용 토크나이저로 읽은 레코드를 배치로 모으고,
+ * 레코드 파이프라인으로 배치를 여러 스레드에서 해시한 뒤 원래 순서대로 출력
  */
-int sha256_monte(const char* input_file, const char* output_file) {
-    FILE* fp = fopen(input_file, "r");
-    if (!fp) {
+int sha256_test(const char* input_file, const char* output_file) {
+    Sha256PipelineCtx pipe_ctx = { g_backend, { { 0 }, NULL } };
+    VectorRunner runner = {
+        "SHA-MSG",
+        { SHA256_BATCH_RECORDS, 1, SHA256_BATCH_ARENA, SHA256_DIGEST_LENGTH,
+          sha256_compute_batch, sha256_emit_batch, &pipe_ctx },
+        feed_from_cache, feed_from_reader, &pipe_ctx.io
+    };
+    return vector_runner_run(&runner, input_file, output_file);
+}
+
+// 몬테 카를로 체크포인트 출력 콜백
+static int write_monte_checkpoint(void* user, int count, const uint8_t md[SHA256_DIGEST_LENGTH]) {
+    ResponseWriter* out = (ResponseWriter*)user;
+
+    PHASE_START(format_mark);
+    rw_field_int(out, "COUNT", count);
+    rw_field_hex(out, "MD", md, SHA256_DIGEST_LENGTH);
+    rw_putc(out, '\n');
+    PHASE_STOP(format_mark, PHASE_FORMAT);
+    return out->error;
+}
+
+/**
+ * 몬테 카를로 요청 파일을 읽어 응답 파일 헤더와 Seed 줄까지 기록
+ * 성공 시 out은 열린 상태로 남고, 실패 시 닫힘
+ */
+static int monte_prepare(const char* input_file, const char* output_file,
+                         ResponseWriter* out, uint8_t seed[SHA256_DIGEST_LENGTH]) {
+    // Seed 레코드 디코딩
+    VectorCache cache;
+    const VectorSchema* schema = vector_schema_find("SHA-MONTE");
+    int ret = vector_cache_open(&cache, schema, input_file);
+    if (ret != SUCCESS) {
         print_error(ERR_FILE_OPEN);
         return ERR_FILE_OPEN;
     }
 
-    FILE* out_fp = fopen(output_file, "w");
-    if (!out_fp) {
-        fclose(fp);
+    if (response_writer_open(out, output_file) != SUCCESS) {
+        vector_cache_close(&cache);
         print_error(ERR_FILE_CREATE);
         return ERR_FILE_CREATE;
     }
 
-    char line[MAX_LINE_LENGTH];
+    const DecodedVectors* decoded = &cache.vectors;
+    const SchemaValue* value = decoded->count > 0 ?
+        decoded_value(decoded, 0, vector_schema_field(schema, "Seed")) : NULL;
+
+    if (value == NULL || !value->present || value->len != SHA256_DIGEST_LENGTH) {
+        vector_cache_close(&cache);
+        response_writer_close(out);
+        return ERR_INVALID_INPUT;
+    }
+    memcpy(seed, decoded_bytes(decoded, value), SHA256_DIGEST_LENGTH);
+
+    // 헤더 복사 (Seed 앞까지)
+    vector_runner_echo_header(out, &cache);
+    vector_cache_close(&cache);
+
+    // Monte Carlo 테스트 시작
+    rw_field_hex(out, "Seed", seed, SHA256_DIGEST_LENGTH);
+    rw_putc(out, '\n');
+    return SUCCESS;
+}
+
+/**
+ * SHA-256 몬테 카를로 테스트 실행
+ */
+int sha256_monte(const char* input_file, const char* output_file) {
+    ResponseWriter out;
     uint8_t seed[SHA256_DIGEST_LENGTH];
-    uint8_t MD[1003][SHA256_DIGEST_LENGTH]; // 몬테 카를로 테스트를 위한 버퍼
 
-    // 헤더 정복사
-    while (fgets(line, sizeof(line), fp)) {
-        if (strncmp(line, "Seed", 4) == 0) break;
-        fputs(line, out_fp);
+    int ret = monte_prepare(input_file, output_file, &out, seed);
+    if (ret != SUCCESS) {
+        return ret;
     }
 
-    // Seed 값 읽기
-    char* seed_hex = strchr(line, '=');
-    if (!seed_hex) {
-        fclose(fp);
-        fclose(out_fp);
+    Sha256MonteStats stats = { 0 };
+    bool use_native = (g_backend.hash_function == sha256_native_hash);
+    PerfMark perf;
+    PHASE_START(crypto_mark);
+    perf_profile_begin(&perf);
+    ret = sha256_monte_engine_run(seed, use_native, write_monte_checkpoint, &out, &stats);
+    perf_profile_end(&perf, MONTE_PERF_BYTES(stats.iterations), stats.iterations);
+    PHASE_STOP(crypto_mark, PHASE_CRYPTO);
+
+    if (ret == SUCCESS) {
+        printf("몬테 카를로: %llu회 반복, %.3f초 (%.0f 반복/초)\n",
+               (unsigned long long)stats.iterations, stats.elapsed_sec, stats.iterations_per_sec);
+    }
+
+    if (response_writer_close(&out) != SUCCESS && ret == SUCCESS) {
+        ret = ERR_FILE_WRITE;
+    }
+    return ret;
+}
+
+/**
+ * 여러 몬테 카를로 요청 파일을 레인별 체인으로 동시에 실행
+ * 각 체인의 결과는 해당 응답 파일에 단일 실행과 같은 형식으로 기록
+ */
+int sha256_monte_multi(const char* const input_files[], const char* const output_files[], size_t count) {
+    if ((input_files == NULL || output_files == NULL) && count > 0) {
         return ERR_INVALID_INPUT;
     }
-    seed_hex++;
-    while(*seed_hex == ' ') seed_hex++;
-        
-        // 개행 문자 제거
-    char* newline = strchr(seed_hex, '\n');
-    if (newline) *newline = '\0';
-    
-    hex_to_bytes(seed_hex, seed, SHA256_DIGEST_LENGTH);
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (count > SIZE_MAX / SHA256_DIGEST_LENGTH) {
+        return ERR_MEMORY_ALLOC;
+    }
 
-    // Monte Carlo 테스트 시작
-    fprintf(out_fp, "Seed = ");
-    for (int i = 0; i < SHA256_DIGEST_LENGTH; i++) {
-        fprintf(out_fp, "%02x", seed[i]);
-    }
-    fprintf(out_fp, "\n\n");
-
-    // 100개의 체크포인트 반복
-    for (int j = 0; j < 100; j++) {
-        // 초기 상태 설정: MD_0 = MD_1 = MD_2 = Seed
-        memcpy(MD[0], seed, SHA256_DIGEST_LENGTH);
-        memcpy(MD[1], seed, SHA256_DIGEST_LENGTH);
-        memcpy(MD[2], seed, SHA256_DIGEST_LENGTH);
-        
-        // 1000번의 해시 반복
-        for (int i = 3; i < 1003; i++) {
-            uint8_t message[SHA256_DIGEST_LENGTH * 3]; // 96바이트 메시지
-            
-            // M_i = MD_{i-3} || MD_{i-2} || MD_{i-1} (연결)
-            memcpy(message, MD[i-3], SHA256_DIGEST_LENGTH);
-            memcpy(message + SHA256_DIGEST_LENGTH, MD[i-2], SHA256_DIGEST_LENGTH);
-            memcpy(message + (2 * SHA256_DIGEST_LENGTH), MD[i-1], SHA256_DIGEST_LENGTH);
-            
-            // MD_i = SHA-256(M_i)
-            if (sha256_hash(message, SHA256_DIGEST_LENGTH * 3, MD[i]) != 0) {
-                fclose(fp);
-                fclose(out_fp);
-                return ERR_SHA256_HASH;
-            }
+    uint8_t (*seeds)[SHA256_DIGEST_LENGTH] = malloc(count * sizeof(*seeds));
+    ResponseWriter* outs = (ResponseWriter*)calloc(count, sizeof(ResponseWriter));
+    void** users = (void**)calloc(count, sizeof(void*));
+    if (!seeds || !outs || !users) {
+        free(seeds);
+        free(outs);
+        free(users);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    // 실패한 항목은 monte_prepare가 이미 닫으므로 성공한 개수만 센다
+    int ret = SUCCESS;
+    size_t opened = 0;
+    while (opened < count) {
+        ret = monte_prepare(input_files[opened], output_files[opened], &outs[opened], seeds[opened]);
+        if (ret != SUCCESS) break;
+        users[opened] = &outs[opened];
+        opened++;
+    }
+
+    if (ret == SUCCESS) {
+        Sha256MonteStats stats = { 0 };
+        PerfMark perf;
+        PHASE_START(crypto_mark);
+        perf_profile_begin(&perf);
+        ret = sha256_monte_engine_run_many((const uint8_t (*)[SHA256_DIGEST_LENGTH])seeds, count,
+                                           write_monte_checkpoint, (void* const*)users, &stats);
+        perf_profile_end(&perf, MONTE_PERF_BYTES(stats.iterations), stats.iterations);
+        PHASE_STOP(crypto_mark, PHASE_CRYPTO);
+        if (ret == SUCCESS) {
+            printf("몬테 카를로 (%zu개 체인, %zu 레인): %llu회 반복, %.3f초 (%.0f 반복/초)\n",
+                   count, sha256_mb_lanes(), (unsigned long long)stats.iterations,
+                   stats.elapsed_sec, stats.iterations_per_sec);
         }
-        
-        // 체크포인트 출력 (MD_j = MD_1002)
-        fprintf(out_fp, "COUNT = %d\n", j);
-        fprintf(out_fp, "MD = ");
-        for (int i = 0; i < SHA256_DIGEST_LENGTH; i++) {
-            fprintf(out_fp, "%02x", MD[1002][i]);
+    }
+
+    for (size_t i = 0; i < opened; i++) {
+        if (response_writer_close(&outs[i]) != SUCCESS && ret == SUCCESS) {
+            ret = ERR_FILE_WRITE;
         }
-        fprintf(out_fp, "\n\n");
-        
-        // 다음 반복을 위한 시드 업데이트 (Seed = MD_1002)
-        memcpy(seed, MD[1002], SHA256_DIGEST_LENGTH);
     }
 
-    fclose(fp);
-    fclose(out_fp);
-    return SUCCESS;
+    free(seeds);
+    free(outs);
+    free(users);
+    return ret;
 }
 
 // 테스트 벡터 처리 시 입력값과 출력값을 출력
@@ -389,13 +541,15 @@ void print_debug_info(const uint8_t* msg, size_t msg_len, const uint8_t* hash) {
 
 // 초기화 함수
 int sha256_init(void** ctx) {
-    EVP_MD_CTX* mdctx = EVP_MD_CTX_new();
-    if (!mdctx) {
+    const EVP_MD* md = evp_cache_md(EVP_CACHE_MD_SHA256);
+    EVP_MD_CTX* mdctx = evp_cache_md_ctx_acquire();
+    if (!md || !mdctx) {
+        evp_cache_md_ctx_release(mdctx);
         return ERR_SHA256_INIT;
     }
     
-    if (EVP_DigestInit_ex(mdctx, EVP_sha256(), NULL) != 1) {
-        EVP_MD_CTX_free(mdctx);
+    if (EVP_DigestInit_ex2(mdctx, md, NULL) != 1) {
+        evp_cache_md_ctx_release(mdctx);
         return ERR_SHA256_INIT;
     }
     
@@ -419,67 +573,28 @@ int sha256_final(void* ctx, unsigned char* digest) {
     EVP_MD_CTX* mdctx = (EVP_MD_CTX*)ctx;
     unsigned int digest_len;
     
+    int ret = SUCCESS;
+    
     if (EVP_DigestFinal_ex(mdctx, digest, &digest_len) != 1) {
-        return ERR_SHA256_FINAL;
+        ret = ERR_SHA256_FINAL;
     }
     
-    EVP_MD_CTX_free(mdctx);
-    return SUCCESS;
+    // 컨텍스트는 해제하지 않고 스레드 풀로 돌려줌
+    evp_cache_md_ctx_release(mdctx);
+    return ret;
 }
 
 // 자동 테스트 구현
 int sha256_run_auto_test(int test_type_id) {
-    // 테스트 타입에 따른 파일 이름 결정
-    const char* test_file = NULL;
-    
+    // 테스트 타입에 따른 파일 이름과 실행 함수 결정 (Monte는 체인 실행기)
     if (test_type_id == 0) { // ShortMsg
-        test_file = "SHA256ShortMsg.req";
+        return vector_runner_auto_test("SHA_256", "SHA256ShortMsg.req", sha256_test);
     } else if (test_type_id == 1) { // LongMsg
-        test_file = "SHA256LongMsg.req";
+        return vector_runner_auto_test("SHA_256", "SHA256LongMsg.req", sha256_test);
     } else if (test_type_id == 2) { // Monte
-        test_file = "SHA256Monte.req";
-    } else {
-        return ERR_INVALID_TEST_TYPE;
-    }
-    
-    // 파일 경로 구성
-    char input_path[MAX_PATH_LENGTH];
-    char output_path[MAX_PATH_LENGTH];
-    
-    sprintf(input_path, "test_vectors/request/SHA_256/%s", test_file);
-    const char* output_file = replace_extension(test_file, ".req", ".rsp");
-    sprintf(output_path, "test_vectors/response/SHA_256/%s", output_file);
-    
-    // 디렉토리 생성
-    create_directory("test_vectors/response/SHA_256");
-    
-    int result;
-    
-    if (test_type_id == 2) { // Monte
-        result = sha256_monte(input_path, output_path);
-    } else {
-        result = sha256_test(input_path, output_path);
+        return vector_runner_auto_test("SHA_256", "SHA256Monte.req", sha256_monte);
     }
-    
-    if (result == SUCCESS) {
-        printf("\n테스트 완료: 결과 파일이 %s에 저장되었습니다.\n", output_path);
-        
-        // 결과 비교
-        char expected_path[MAX_PATH_LENGTH];
-        sprintf(expected_path, "test_vectors/expected/SHA_256/%s", output_file);
-        
-        if (file_exists(expected_path)) {
-            printf("\n결과 비교 중...\n");
-            result = compare_test_results(output_path, expected_path);
-            if (result == SUCCESS) {
-                printf("\n✓ 모든 테스트 결과가 예상 결과와 일치합니다.\n");
-            } else {
-                printf("\n✕ 일부 테스트 결과가 예상 결과와 일치하지 않습니다.\n");
-            }
-        }
-    }
-    
-    return result;
+    return ERR_INVALID_TEST_TYPE;
 }
 
 // 수동 테스트 구현
@@ -515,7 +630,7 @@ int sha256_run_manual_test(int input_type_id) {
         printf("\n");
         
         // 해시 계산
-        result = sha256_hash((const uint8_t*)text, len, digest);
+        result = g_backend.hash_function((const uint8_t*)text, len, digest);
         
     } else { // 16진수 입력
         char hex_string[MAX_LINE_LENGTH];
@@ -0,0 +1,462 @@
+#include "../../include/algorithm/sha256_mb.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/common/cpu_features.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SHA256_MB_X86 1
+#endif
+
+// 비활성 레인에 넣는 더미 블록
+static const uint8_t g_zero_block[SHA256_BLOCK_SIZE];
+
+static inline uint32_t load_be32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return __builtin_bswap32(v);
+}
+
+static inline void store_be32(uint8_t* p, uint32_t v) {
+    v = __builtin_bswap32(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * 레인별 블록을 워드 단위로 전치 (wt[t][lane])
+ */
+static inline __attribute__((always_inline))
+void transpose_blocks(uint32_t wt[16][SHA256_MB_MAX_LANES], const uint8_t* const blocks[], size_t lanes) {
+    for (size_t lane = 0; lane < lanes; lane++) {
+        const uint8_t* p = blocks[lane];
+        for (int t = 0; t < 16; t++) {
+            wt[t][lane] = load_be32(p + t * 4);
+        }
+    }
+}
+
+#ifdef SHA256_MB_X86
+#define ROTR4(x, n) _mm_or_si128(_mm_srli_epi32((x), (n)), _mm_slli_epi32((x), 32 - (n)))
+
+/**
+ * SSE2 4레인 압축 (state의 base 레인부터 4개, AVX2가 없는 CPU용)
+ */
+__attribute__((target("sse2")))
+static void sha256_x4_sse2(Sha256LaneState state, const uint8_t* const blocks[], size_t base) {
+    uint32_t wt[16][SHA256_MB_MAX_LANES] __attribute__((aligned(16)));
+    __m128i W[16];
+
+    transpose_blocks(wt, blocks, 4);
+
+    __m128i a = _mm_loadu_si128((const __m128i*)&state[0][base]);
+    __m128i b = _mm_loadu_si128((const __m128i*)&state[1][base]);
+    __m128i c = _mm_loadu_si128((const __m128i*)&state[2][base]);
+    __m128i d = _mm_loadu_si128((const __m128i*)&state[3][base]);
+    __m128i e = _mm_loadu_si128((const __m128i*)&state[4][base]);
+    __m128i f = _mm_loadu_si128((const __m128i*)&state[5][base]);
+    __m128i g = _mm_loadu_si128((const __m128i*)&state[6][base]);
+    __m128i h = _mm_loadu_si128((const __m128i*)&state[7][base]);
+
+    for (int t = 0; t < 64; t++) {
+        __m128i w;
+        if (t < 16) {
+            w = _mm_load_si128((const __m128i*)wt[t]);
+        } else {
+            __m128i w2 = W[(t - 2) & 15], w15 = W[(t - 15) & 15];
+            __m128i s1 = _mm_xor_si128(_mm_xor_si128(ROTR4(w2, 17), ROTR4(w2, 19)), _mm_srli_epi32(w2, 10));
+            __m128i s0 = _mm_xor_si128(_mm_xor_si128(ROTR4(w15, 7), ROTR4(w15, 18)), _mm_srli_epi32(w15, 3));
+            w = _mm_add_epi32(_mm_add_epi32(s1, W[(t - 7) & 15]), _mm_add_epi32(s0, W[t & 15]));
+        }
+        W[t & 15] = w;
+
+        __m128i S1 = _mm_xor_si128(_mm_xor_si128(ROTR4(e, 6), ROTR4(e, 11)), ROTR4(e, 25));
+        __m128i ch = _mm_xor_si128(_mm_and_si128(e, f), _mm_andnot_si128(e, g));
+        __m128i t1 = _mm_add_epi32(_mm_add_epi32(h, S1),
+                     _mm_add_epi32(_mm_add_epi32(ch, w), _mm_set1_epi32((int)sha256_k[t])));
+        __m128i S0 = _mm_xor_si128(_mm_xor_si128(ROTR4(a, 2), ROTR4(a, 13)), ROTR4(a, 22));
+        __m128i maj = _mm_or_si128(_mm_and_si128(a, b), _mm_and_si128(c, _mm_or_si128(a, b)));
+        __m128i t2 = _mm_add_epi32(S0, maj);
+
+        h = g; g = f; f = e; e = _mm_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm_add_epi32(t1, t2);
+    }
+
+    __m128i* s = NULL;
+#define MB_STORE4(i, v) \
+    s = (__m128i*)&state[i][base]; \
+    _mm_storeu_si128(s, _mm_add_epi32(_mm_loadu_si128(s), (v)))
+    MB_STORE4(0, a); MB_STORE4(1, b); MB_STORE4(2, c); MB_STORE4(3, d);
+    MB_STORE4(4, e); MB_STORE4(5, f); MB_STORE4(6, g); MB_STORE4(7, h);
+#undef MB_STORE4
+}
+
+#define ROTR8(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+/**
+ * AVX2 8레인 압축 (state의 base 레인부터 8개)
+ */
+__attribute__((target("avx2")))
+static void sha256_x8_avx2(Sha256LaneState state, const uint8_t* const blocks[], size_t base) {
+    uint32_t wt[16][SHA256_MB_MAX_LANES] __attribute__((aligned(32)));
+    __m256i W[16];
+
+    transpose_blocks(wt, blocks, 8);
+
+    __m256i a = _mm256_loadu_si256((const __m256i*)&state[0][base]);
+    __m256i b = _mm256_loadu_si256((const __m256i*)&state[1][base]);
+    __m256i c = _mm256_loadu_si256((const __m256i*)&state[2][base]);
+    __m256i d = _mm256_loadu_si256((const __m256i*)&state[3][base]);
+    __m256i e = _mm256_loadu_si256((const __m256i*)&state[4][base]);
+    __m256i f = _mm256_loadu_si256((const __m256i*)&state[5][base]);
+    __m256i g = _mm256_loadu_si256((const __m256i*)&state[6][base]);
+    __m256i h = _mm256_loadu_si256((const __m256i*)&state[7][base]);
+
+    for (int t = 0; t < 64; t++) {
+        __m256i w;
+        if (t < 16) {
+            w = _mm256_load_si256((const __m256i*)wt[t]);
+        } else {
+            __m256i w2 = W[(t - 2) & 15], w15 = W[(t - 15) & 15];
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(w2, 17), ROTR8(w2, 19)), _mm256_srli_epi32(w2, 10));
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(w15, 7), ROTR8(w15, 18)), _mm256_srli_epi32(w15, 3));
+            w = _mm256_add_epi32(_mm256_add_epi32(s1, W[(t - 7) & 15]), _mm256_add_epi32(s0, W[t & 15]));
+        }
+        W[t & 15] = w;
+
+        __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(e, 6), ROTR8(e, 11)), ROTR8(e, 25));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, S1),
+                     _mm256_add_epi32(_mm256_add_epi32(ch, w), _mm256_set1_epi32((int)sha256_k[t])));
+        __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(a, 2), ROTR8(a, 13)), ROTR8(a, 22));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        __m256i t2 = _mm256_add_epi32(S0, maj);
+
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(t1, t2);
+    }
+
+    __m256i* s = NULL;
+#define MB_STORE8(i, v) \
+    s = (__m256i*)&state[i][base]; \
+    _mm256_storeu_si256(s, _mm256_add_epi32(_mm256_loadu_si256(s), (v)))
+    MB_STORE8(0, a); MB_STORE8(1, b); MB_STORE8(2, c); MB_STORE8(3, d);
+    MB_STORE8(4, e); MB_STORE8(5, f); MB_STORE8(6, g); MB_STORE8(7, h);
+#undef MB_STORE8
+}
+
+/**
+ * AVX-512 16레인 압축 (회전은 vprord, CH/MAJ/XOR3는 vpternlogd)
+ */
+__attribute__((target("avx512f")))
+static void sha256_x16_avx512(Sha256LaneState state, const uint8_t* const blocks[], size_t base) {
+    uint32_t wt[16][SHA256_MB_MAX_LANES] __attribute__((aligned(64)));
+    __m512i W[16];
+
+    (void)base;
+    transpose_blocks(wt, blocks, 16);
+
+    __m512i a = _mm512_loadu_si512(state[0]);
+    __m512i b = _mm512_loadu_si512(state[1]);
+    __m512i c = _mm512_loadu_si512(state[2]);
+    __m512i d = _mm512_loadu_si512(state[3]);
+    __m512i e = _mm512_loadu_si512(state[4]);
+    __m512i f = _mm512_loadu_si512(state[5]);
+    __m512i g = _mm512_loadu_si512(state[6]);
+    __m512i h = _mm512_loadu_si512(state[7]);
+
+    for (int t = 0; t < 64; t++) {
+        __m512i w;
+        if (t < 16) {
+            w = _mm512_load_si512(wt[t]);
+        } else {
+            __m512i w2 = W[(t - 2) & 15], w15 = W[(t - 15) & 15];
+            __m512i s1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w2, 17), _mm512_ror_epi32(w2, 19),
+                                                   _mm512_srli_epi32(w2, 10), 0x96);
+            __m512i s0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w15, 7), _mm512_ror_epi32(w15, 18),
+                                                   _mm512_srli_epi32(w15, 3), 0x96);
+            w = _mm512_add_epi32(_mm512_add_epi32(s1, W[(t - 7) & 15]), _mm512_add_epi32(s0, W[t & 15]));
+        }
+        W[t & 15] = w;
+
+        __m512i S1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(e, 6), _mm512_ror_epi32(e, 11),
+                                               _mm512_ror_epi32(e, 25), 0x96);
+        __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xCA);
+        __m512i t1 = _mm512_add_epi32(_mm512_add_epi32(h, S1),
+                     _mm512_add_epi32(_mm512_add_epi32(ch, w), _mm512_set1_epi32((int)sha256_k[t])));
+        __m512i S0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(a, 2), _mm512_ror_epi32(a, 13),
+                                               _mm512_ror_epi32(a, 22), 0x96);
+        __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xE8);
+        __m512i t2 = _mm512_add_epi32(S0, maj);
+
+        h = g; g = f; f = e; e = _mm512_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm512_add_epi32(t1, t2);
+    }
+
+    _mm512_storeu_si512(state[0], _mm512_add_epi32(_mm512_loadu_si512(state[0]), a));
+    _mm512_storeu_si512(state[1], _mm512_add_epi32(_mm512_loadu_si512(state[1]), b));
+    _mm512_storeu_si512(state[2], _mm512_add_epi32(_mm512_loadu_si512(state[2]), c));
+    _mm512_storeu_si512(state[3], _mm512_add_epi32(_mm512_loadu_si512(state[3]), d));
+    _mm512_storeu_si512(state[4], _mm512_add_epi32(_mm512_loadu_si512(state[4]), e));
+    _mm512_storeu_si512(state[5], _mm512_add_epi32(_mm512_loadu_si512(state[5]), f));
+    _mm512_storeu_si512(state[6], _mm512_add_epi32(_mm512_loadu_si512(state[6]), g));
+    _mm512_storeu_si512(state[7], _mm512_add_epi32(_mm512_loadu_si512(state[7]), h));
+}
+#endif
+
+static size_t g_lanes = 0;
+
+// SSE2는 x86-64의 기본 명령어라 항상 4레인 사용 가능 (32비트는 CPU에 따라 없을 수 있음)
+#if defined(__x86_64__)
+#define SHA256_MB_SSE2_LANES 4
+#else
+#define SHA256_MB_SSE2_LANES 1
+#endif
+
+/**
+ * 레인 수 결정
+ * SHA-NI가 있으면 SIMD 레인보다 메시지별 SHA-NI가 빨라 AVX-512일 때만 레인 사용
+ * 환경 변수 CRYPTO_TEST_SHA256_MB_LANES(1/4/8/16)로 지원 범위 내에서 폭 강제 가능,
+ * 그 밖의 값은 오류를 알리고 기본 폭 사용
+ */
+size_t sha256_mb_lanes(void) {
+    if (g_lanes != 0) {
+        return g_lanes;
+    }
+
+    size_t lanes = 1;
+    size_t max_lanes = 1;
+#ifdef SHA256_MB_X86
+    const CpuFeatures* cpu = get_cpu_features();
+    max_lanes = cpu->avx512f ? 16 : (cpu->avx2 ? 8 : SHA256_MB_SSE2_LANES);
+
+    if (max_lanes == 16) {
+        lanes = 16;
+    } else if (max_lanes > 1 && sha256_native_dispatch() != SHA256_IMPL_SHANI) {
+        lanes = max_lanes;
+    }
+#endif
+
+    const char* force = getenv("CRYPTO_TEST_SHA256_MB_LANES");
+    if (force != NULL && *force != '\0') {
+        char* end = NULL;
+        unsigned long forced = strtoul(force, &end, 10);
+        bool known = (*end == '\0') && (forced == 1 || forced == 4 || forced == 8 || forced == 16);
+        if (known && forced <= max_lanes) {
+            lanes = (size_t)forced;
+        } else {
+            fprintf(stderr, "오류: CRYPTO_TEST_SHA256_MB_LANES=%s는 지원하지 않는 폭입니다 "
+                            "(1/4/8/16 중 이 CPU는 %zu 이하), 기본 %zu레인을 사용합니다.\n",
+                    force, max_lanes, lanes);
+        }
+    }
+
+    g_lanes = lanes;
+    return lanes;
+}
+
+const char* sha256_mb_impl_name(void) {
+    switch (sha256_mb_lanes()) {
+        case 16:
+            return "AVX-512 x16";
+        case 8:
+            return "AVX2 x8";
+        case 4:
+            return "SSE2 x4";
+        default:
+            return "Scalar x1";
+    }
+}
+
+void sha256_mb_state_init(Sha256LaneState state, size_t lane) {
+    for (int i = 0; i < 8; i++) {
+        state[i][lane] = sha256_h0[i];
+    }
+}
+
+void sha256_mb_state_digest(Sha256LaneState state, size_t lane, uint8_t digest[SHA256_DIGEST_LENGTH]) {
+    for (int i = 0; i < 8; i++) {
+        store_be32(digest + i * 4, state[i][lane]);
+    }
+}
+
+/**
+ * 레인 하나를 스칼라 압축 함수로 처리
+ */
+static void compress_lane_scalar(Sha256LaneState state, size_t lane, const uint8_t* data, size_t nblocks) {
+    uint32_t s[8];
+    for (int i = 0; i < 8; i++) {
+        s[i] = state[i][lane];
+    }
+    sha256_native_compress(s, data, nblocks);
+    for (int i = 0; i < 8; i++) {
+        state[i][lane] = s[i];
+    }
+}
+
+void sha256_mb_compress(Sha256LaneState state, const uint8_t* const blocks[], size_t lanes) {
+    size_t width = sha256_mb_lanes();
+
+    if (lanes > SHA256_MB_MAX_LANES) {
+        lanes = SHA256_MB_MAX_LANES;
+    }
+
+#ifdef SHA256_MB_X86
+    if (width > 1) {
+        const uint8_t* padded[SHA256_MB_MAX_LANES];
+        for (size_t i = 0; i < SHA256_MB_MAX_LANES; i++) {
+            padded[i] = (i < lanes) ? blocks[i] : g_zero_block;
+        }
+
+        // 16레인 한 번 또는 8레인/4레인씩 나눠 처리
+        if (width == 16 && lanes > 8) {
+            sha256_x16_avx512(state, padded, 0);
+            return;
+        }
+        if (width == 4) {
+            for (size_t base = 0; base < lanes; base += 4) {
+                sha256_x4_sse2(state, padded + base, base);
+            }
+            return;
+        }
+        for (size_t base = 0; base < lanes; base += 8) {
+            sha256_x8_avx2(state, padded + base, base);
+        }
+        return;
+    }
+#endif
+
+    for (size_t lane = 0; lane < lanes; lane++) {
+        compress_lane_scalar(state, lane, blocks[lane], 1);
+    }
+}
+
+// 레인별 메시지 진행 상태
+typedef struct {
+    const uint8_t* data;                    // 메시지 본문
+    size_t full_blocks;                     // 본문에서 직접 읽는 완전한 블록 수
+    size_t total_blocks;                    // 패딩 포함 전체 블록 수
+    size_t next_block;                      // 다음에 처리할 블록
+    size_t msg_index;                       // 원래 메시지 인덱스
+    bool active;
+    uint8_t tail[2 * SHA256_BLOCK_SIZE];    // 마지막 부분 블록 + 패딩
+} Sha256Lane;
+
+/**
+ * 레인에 새 메시지 배정 (패딩 블록 준비)
+ */
+static void lane_start(Sha256Lane* lane, Sha256LaneState state, size_t lane_idx,
+                       const uint8_t* msg, size_t len, size_t msg_index) {
+    size_t rem = len % SHA256_BLOCK_SIZE;
+    size_t tail_blocks = (rem + 9 > SHA256_BLOCK_SIZE) ? 2 : 1;
+    uint64_t bit_len = (uint64_t)len * 8;
+
+    lane->data = msg;
+    lane->full_blocks = len / SHA256_BLOCK_SIZE;
+    lane->total_blocks = lane->full_blocks + tail_blocks;
+    lane->next_block = 0;
+    lane->msg_index = msg_index;
+    lane->active = true;
+
+    memset(lane->tail, 0, tail_blocks * SHA256_BLOCK_SIZE);
+    if (rem > 0) {
+        memcpy(lane->tail, msg + lane->full_blocks * SHA256_BLOCK_SIZE, rem);
+    }
+    lane->tail[rem] = 0x80;
+    store_be32(lane->tail + tail_blocks * SHA256_BLOCK_SIZE - 8, (uint32_t)(bit_len >> 32));
+    store_be32(lane->tail + tail_blocks * SHA256_BLOCK_SIZE - 4, (uint32_t)bit_len);
+
+    sha256_mb_state_init(state, lane_idx);
+}
+
+static inline const uint8_t* lane_block(const Sha256Lane* lane) {
+    if (lane->next_block < lane->full_blocks) {
+        return lane->data + lane->next_block * SHA256_BLOCK_SIZE;
+    }
+    return lane->tail + (lane->next_block - lane->full_blocks) * SHA256_BLOCK_SIZE;
+}
+
+/**
+ * 마지막으로 남은 레인은 SIMD 대신 스칼라 압축으로 한 번에 마무리
+ */
+static void lane_finish_scalar(Sha256Lane* lane, Sha256LaneState state, size_t lane_idx) {
+    if (lane->next_block < lane->full_blocks) {
+        compress_lane_scalar(state, lane_idx, lane->data + lane->next_block * SHA256_BLOCK_SIZE,
+                             lane->full_blocks - lane->next_block);
+        lane->next_block = lane->full_blocks;
+    }
+    compress_lane_scalar(state, lane_idx, lane->tail + (lane->next_block - lane->full_blocks) * SHA256_BLOCK_SIZE,
+                         lane->total_blocks - lane->next_block);
+    lane->next_block = lane->total_blocks;
+}
+
+int sha256_hash_many(const uint8_t* const msgs[], const size_t lens[],
+                     uint8_t (*digests)[SHA256_DIGEST_LENGTH], size_t n) {
+    if ((msgs == NULL || lens == NULL || digests == NULL) && n > 0) {
+        return ERR_INVALID_INPUT;
+    }
+
+    size_t width = sha256_mb_lanes();
+    if (width <= 1 || n == 1) {
+        for (size_t i = 0; i < n; i++) {
+            sha256_native_hash(msgs[i], lens[i], digests[i]);
+        }
+        return SUCCESS;
+    }
+
+    Sha256LaneState state __attribute__((aligned(64)));
+    Sha256Lane lanes[SHA256_MB_MAX_LANES];
+    const uint8_t* blocks[SHA256_MB_MAX_LANES];
+    size_t next = 0;
+    size_t active = 0;
+
+    for (size_t i = 0; i < width; i++) {
+        lanes[i].active = false;
+        sha256_mb_state_init(state, i);
+        if (next < n) {
+            lane_start(&lanes[i], state, i, msgs[next], lens[next], next);
+            next++;
+            active++;
+        }
+    }
+
+    while (active > 0) {
+        // 남은 메시지가 없고 레인 하나만 남으면 스칼라로 마무리
+        if (active == 1 && next >= n) {
+            for (size_t i = 0; i < width; i++) {
+                if (lanes[i].active) {
+                    lane_finish_scalar(&lanes[i], state, i);
+                    sha256_mb_state_digest(state, i, digests[lanes[i].msg_index]);
+                    lanes[i].active = false;
+                }
+            }
+            break;
+        }
+
+        for (size_t i = 0; i < width; i++) {
+            blocks[i] = lanes[i].active ? lane_block(&lanes[i]) : g_zero_block;
+        }
+
+        sha256_mb_compress(state, blocks, width);
+
+        for (size_t i = 0; i < width; i++) {
+            Sha256Lane* lane = &lanes[i];
+            if (!lane->active || ++lane->next_block < lane->total_blocks) {
+                continue;
+            }
+
+            sha256_mb_state_digest(state, i, digests[lane->msg_index]);
+            lane->active = false;
+            active--;
+
+            // 끝난 레인에 다음 메시지 채우기
+            if (next < n) {
+                lane_start(lane, state, i, msgs[next], lens[next], next);
+                next++;
+                active++;
+            }
+        }
+    }
+
+    return SUCCESS;
+}
@@ -0,0 +1,185 @@
+#include <openssl/evp.h>
+#include "../../include/algorithm/sha256_monte.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/algorithm/sha256_mb.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/evp_cache.h"
+
+/**
+ * 몬테 카를로 엔진 실행
+ * MD_i = SHA-256(MD_{i-3} || MD_{i-2} || MD_{i-1})를 순환 버퍼 3칸으로 계산.
+ * ring[oldest]가 MD_{i-3}이며, 계산한 MD_i로 그 칸을 덮어씀
+ */
+int sha256_monte_engine_run(const uint8_t seed[SHA256_DIGEST_LENGTH], bool use_native,
+                            Sha256MonteCheckpointFn on_checkpoint, void* user,
+                            Sha256MonteStats* stats) {
+    uint8_t ring[3][SHA256_DIGEST_LENGTH];
+    uint8_t checkpoint_seed[SHA256_DIGEST_LENGTH];
+    Sha256NativeCtx native_ctx;
+    EVP_MD_CTX* evp_ctx = NULL;
+    const EVP_MD* md = NULL;
+    int ret = SUCCESS;
+
+    if (seed == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+
+    // EVP 경로는 캐시된 EVP_MD와 컨텍스트를 빌려 반복마다 재초기화
+    if (!use_native) {
+        md = evp_cache_md(EVP_CACHE_MD_SHA256);
+        evp_ctx = evp_cache_md_ctx_acquire();
+        if (md == NULL || evp_ctx == NULL) {
+            evp_cache_md_ctx_release(evp_ctx);
+            return ERR_SHA256_INIT;
+        }
+    }
+
+    double start = get_time_seconds();
+    memcpy(checkpoint_seed, seed, SHA256_DIGEST_LENGTH);
+
+    for (int j = 0; j < SHA256_MONTE_CHECKPOINTS; j++) {
+        // 초기 상태: MD_0 = MD_1 = MD_2 = Seed
+        memcpy(ring[0], checkpoint_seed, SHA256_DIGEST_LENGTH);
+        memcpy(ring[1], checkpoint_seed, SHA256_DIGEST_LENGTH);
+        memcpy(ring[2], checkpoint_seed, SHA256_DIGEST_LENGTH);
+        int oldest = 0;
+
+        for (int i = 0; i < SHA256_MONTE_ITERATIONS; i++) {
+            const uint8_t* m0 = ring[oldest];
+            const uint8_t* m1 = ring[oldest == 2 ? 0 : oldest + 1];
+            const uint8_t* m2 = ring[oldest == 0 ? 2 : oldest - 1];
+
+            if (use_native) {
+                sha256_native_ctx_init(&native_ctx);
+                sha256_native_ctx_update(&native_ctx, m0, SHA256_DIGEST_LENGTH);
+                sha256_native_ctx_update(&native_ctx, m1, SHA256_DIGEST_LENGTH);
+                sha256_native_ctx_update(&native_ctx, m2, SHA256_DIGEST_LENGTH);
+                sha256_native_ctx_final(&native_ctx, ring[oldest]);
+            } else {
+                if (EVP_DigestInit_ex2(evp_ctx, md, NULL) != 1 ||
+                    EVP_DigestUpdate(evp_ctx, m0, SHA256_DIGEST_LENGTH) != 1 ||
+                    EVP_DigestUpdate(evp_ctx, m1, SHA256_DIGEST_LENGTH) != 1 ||
+                    EVP_DigestUpdate(evp_ctx, m2, SHA256_DIGEST_LENGTH) != 1 ||
+                    EVP_DigestFinal_ex(evp_ctx, ring[oldest], NULL) != 1) {
+                    ret = ERR_SHA256_HASH;
+                    goto cleanup;
+                }
+            }
+
+            oldest = (oldest == 2) ? 0 : oldest + 1;
+        }
+
+        // 마지막으로 쓴 칸이 MD_1002 (= 다음 체크포인트의 Seed)
+        const uint8_t* last = ring[oldest == 0 ? 2 : oldest - 1];
+        memcpy(checkpoint_seed, last, SHA256_DIGEST_LENGTH);
+
+        if (on_checkpoint != NULL) {
+            ret = on_checkpoint(user, j, checkpoint_seed);
+            if (ret != SUCCESS) {
+                goto cleanup;
+            }
+        }
+    }
+
+    if (stats != NULL) {
+        stats->iterations = (uint64_t)SHA256_MONTE_CHECKPOINTS * SHA256_MONTE_ITERATIONS;
+        stats->elapsed_sec = get_time_seconds() - start;
+        stats->iterations_per_sec = stats->elapsed_sec > 0.0 ?
+            (double)stats->iterations / stats->elapsed_sec : 0.0;
+    }
+
+cleanup:
+    evp_cache_md_ctx_release(evp_ctx);
+    return ret;
+}
+
+/**
+ * 레인 그룹 하나(최대 SHA256_MB_MAX_LANES 체인)를 동시에 진행
+ * 레인별 메시지 버퍼는 [MD_{i-3} | MD_{i-2} | MD_{i-1} | 패딩] 128바이트 두 블록
+ */
+static int run_lane_group(const uint8_t (*seeds)[SHA256_DIGEST_LENGTH], size_t lanes,
+                          Sha256MonteCheckpointFn on_checkpoint, void* const users[]) {
+    Sha256LaneState state __attribute__((aligned(64)));
+    uint8_t msg[SHA256_MB_MAX_LANES][2 * SHA256_BLOCK_SIZE];
+    const uint8_t* blocks[SHA256_MB_MAX_LANES];
+
+    // 96바이트(768비트) 메시지의 고정 패딩
+    for (size_t l = 0; l < lanes; l++) {
+        memset(msg[l] + 3 * SHA256_DIGEST_LENGTH, 0, 2 * SHA256_BLOCK_SIZE - 3 * SHA256_DIGEST_LENGTH);
+        msg[l][3 * SHA256_DIGEST_LENGTH] = 0x80;
+        msg[l][2 * SHA256_BLOCK_SIZE - 2] = 0x03;
+        memcpy(msg[l] + 2 * SHA256_DIGEST_LENGTH, seeds[l], SHA256_DIGEST_LENGTH);
+    }
+
+    for (int j = 0; j < SHA256_MONTE_CHECKPOINTS; j++) {
+        // 초기 상태: MD_0 = MD_1 = MD_2 = 이전 체크포인트
+        for (size_t l = 0; l < lanes; l++) {
+            memcpy(msg[l], msg[l] + 2 * SHA256_DIGEST_LENGTH, SHA256_DIGEST_LENGTH);
+            memcpy(msg[l] + SHA256_DIGEST_LENGTH, msg[l] + 2 * SHA256_DIGEST_LENGTH, SHA256_DIGEST_LENGTH);
+        }
+
+        for (int i = 0; i < SHA256_MONTE_ITERATIONS; i++) {
+            for (size_t l = 0; l < lanes; l++) {
+                sha256_mb_state_init(state, l);
+                blocks[l] = msg[l];
+            }
+            sha256_mb_compress(state, blocks, lanes);
+
+            for (size_t l = 0; l < lanes; l++) {
+                blocks[l] = msg[l] + SHA256_BLOCK_SIZE;
+            }
+            sha256_mb_compress(state, blocks, lanes);
+
+            // 창을 한 칸 밀고 새 MD를 마지막 칸에 기록
+            for (size_t l = 0; l < lanes; l++) {
+                memmove(msg[l], msg[l] + SHA256_DIGEST_LENGTH, 2 * SHA256_DIGEST_LENGTH);
+                sha256_mb_state_digest(state, l, msg[l] + 2 * SHA256_DIGEST_LENGTH);
+            }
+        }
+
+        if (on_checkpoint != NULL) {
+            for (size_t l = 0; l < lanes; l++) {
+                int ret = on_checkpoint(users ? users[l] : NULL, j, msg[l] + 2 * SHA256_DIGEST_LENGTH);
+                if (ret != SUCCESS) {
+                    return ret;
+                }
+            }
+        }
+    }
+
+    return SUCCESS;
+}
+
+int sha256_monte_engine_run_many(const uint8_t (*seeds)[SHA256_DIGEST_LENGTH], size_t count,
+                                 Sha256MonteCheckpointFn on_checkpoint, void* const users[],
+                                 Sha256MonteStats* stats) {
+    if (seeds == NULL && count > 0) {
+        return ERR_INVALID_INPUT;
+    }
+
+    size_t width = sha256_mb_lanes();
+    double start = get_time_seconds();
+    int ret = SUCCESS;
+
+    for (size_t base = 0; base < count && ret == SUCCESS; base += width) {
+        size_t lanes = (count - base < width) ? count - base : width;
+
+        // SIMD 레인이 없으면 체인별 단일 엔진이 더 빠름
+        if (width <= 1) {
+            ret = sha256_monte_engine_run(seeds[base], true, on_checkpoint,
+                                          users ? users[base] : NULL, NULL);
+        } else {
+            ret = run_lane_group(seeds + base, lanes, on_checkpoint, users ? users + base : NULL);
+        }
+    }
+
+    if (ret == SUCCESS && stats != NULL) {
+        stats->iterations = (uint64_t)count * SHA256_MONTE_CHECKPOINTS * SHA256_MONTE_ITERATIONS;
+        stats->elapsed_sec = get_time_seconds() - start;
+        stats->iterations_per_sec = stats->elapsed_sec > 0.0 ?
+            (double)stats->iterations / stats->elapsed_sec : 0.0;
+    }
+
+    return ret;
+}
@@ -0,0 +1,329 @@
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SHA256_NATIVE_X86 1
+#endif
+
+// SHA-256 라운드 상수
+const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+// 초기 해시 값
+const uint32_t sha256_h0[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define BSIG0(x) (ROTR32(x, 2) ^ ROTR32(x, 13) ^ ROTR32(x, 22))
+#define BSIG1(x) (ROTR32(x, 6) ^ ROTR32(x, 11) ^ ROTR32(x, 25))
+#define SSIG0(x) (ROTR32(x, 7) ^ ROTR32(x, 18) ^ ((x) >> 3))
+#define SSIG1(x) (ROTR32(x, 17) ^ ROTR32(x, 19) ^ ((x) >> 10))
+#define CH(x, y, z)  (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+static inline uint32_t load_be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void store_be32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/**
+ * 스칼라 압축 함수 본체
+ * 호출하는 함수의 target 속성에 따라 rorx 등으로 컴파일됨
+ */
+static inline __attribute__((always_inline))
+void sha256_compress_scalar(uint32_t state[8], const uint8_t* data, size_t nblocks) {
+    uint32_t W[64];
+
+    while (nblocks--) {
+        for (int t = 0; t < 16; t++) {
+            W[t] = load_be32(data + t * 4);
+        }
+        for (int t = 16; t < 64; t++) {
+            W[t] = SSIG1(W[t - 2]) + W[t - 7] + SSIG0(W[t - 15]) + W[t - 16];
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (int t = 0; t < 64; t++) {
+            uint32_t t1 = h + BSIG1(e) + CH(e, f, g) + sha256_k[t] + W[t];
+            uint32_t t2 = BSIG0(a) + MAJ(a, b, c);
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+
+        data += SHA256_BLOCK_SIZE;
+    }
+}
+
+static void sha256_compress_portable(uint32_t state[8], const uint8_t* data, size_t nblocks) {
+    sha256_compress_scalar(state, data, nblocks);
+}
+
+#ifdef SHA256_NATIVE_X86
+__attribute__((target("avx2,bmi2")))
+static void sha256_compress_avx2(uint32_t state[8], const uint8_t* data, size_t nblocks) {
+    sha256_compress_scalar(state, data, nblocks);
+}
+
+/**
+ * SHA-NI 압축 함수
+ * 상태를 ABEF/CDGH 배치로 바꾼 뒤 4라운드 단위로 처리
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha256_compress_shani(uint32_t state[8], const uint8_t* data, size_t nblocks) {
+    const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i STATE0, STATE1, MSG, TMP, ABEF_SAVE, CDGH_SAVE;
+    __m128i M[4];
+
+    TMP = _mm_loadu_si128((const __m128i*)&state[0]);
+    STATE1 = _mm_loadu_si128((const __m128i*)&state[4]);
+    TMP = _mm_shuffle_epi32(TMP, 0xB1);             // CDAB
+    STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);       // EFGH
+    STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);       // ABEF
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);    // CDGH
+
+    while (nblocks--) {
+        ABEF_SAVE = STATE0;
+        CDGH_SAVE = STATE1;
+
+        for (int i = 0; i < 4; i++) {
+            M[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), MASK);
+        }
+
+        // 16개 그룹 x 4라운드, 메시지 스케줄은 msg1/msg2로 4개 레지스터를 순환
+        for (int g = 0; g < 16; g++) {
+            __m128i Mg = M[g & 3];
+
+            MSG = _mm_add_epi32(Mg, _mm_loadu_si128((const __m128i*)&sha256_k[g * 4]));
+            STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+            if (g >= 3 && g <= 14) {
+                TMP = _mm_alignr_epi8(Mg, M[(g - 1) & 3], 4);
+                M[(g + 1) & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(M[(g + 1) & 3], TMP), Mg);
+            }
+            MSG = _mm_shuffle_epi32(MSG, 0x0E);
+            STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+            if (g >= 1 && g <= 12) {
+                M[(g - 1) & 3] = _mm_sha256msg1_epu32(M[(g - 1) & 3], Mg);
+            }
+        }
+
+        STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+        STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+        data += SHA256_BLOCK_SIZE;
+    }
+
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);          // FEBA
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);       // DCHG
+    STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);    // DCBA
+    STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);       // HGFE
+
+    _mm_storeu_si128((__m128i*)&state[0], STATE0);
+    _mm_storeu_si128((__m128i*)&state[4], STATE1);
+}
+#endif
+
+static void sha256_compress_resolve(uint32_t state[8], const uint8_t* data, size_t nblocks);
+
+// 선택된 압축 함수 (첫 호출 시 resolve로 교체됨)
+static void (*g_compress)(uint32_t*, const uint8_t*, size_t) = sha256_compress_resolve;
+static Sha256Impl g_impl = SHA256_IMPL_PORTABLE;
+static bool g_dispatched = false;
+
+/**
+ * 런타임 디스패치
+ * 환경 변수 CRYPTO_TEST_SHA256_IMPL(portable/avx2/shani)로 하위 구현 강제 가능
+ */
+Sha256Impl sha256_native_dispatch(void) {
+    if (g_dispatched) {
+        return g_impl;
+    }
+
+    Sha256Impl impl = SHA256_IMPL_PORTABLE;
+    void (*fn)(uint32_t*, const uint8_t*, size_t) = sha256_compress_portable;
+
+#ifdef SHA256_NATIVE_X86
+    const CpuFeatures* cpu = get_cpu_features();
+    bool has_shani = cpu->sha && cpu->ssse3 && cpu->sse41;
+    bool has_avx2 = cpu->avx2 && cpu->bmi2;
+
+    const char* force = getenv("CRYPTO_TEST_SHA256_IMPL");
+    if (force != NULL) {
+        if (strcmp(force, "portable") == 0) {
+            has_shani = false;
+            has_avx2 = false;
+        } else if (strcmp(force, "avx2") == 0) {
+            has_shani = false;
+        }
+    }
+
+    if (has_shani) {
+        impl = SHA256_IMPL_SHANI;
+        fn = sha256_compress_shani;
+    } else if (has_avx2) {
+        impl = SHA256_IMPL_AVX2;
+        fn = sha256_compress_avx2;
+    }
+#endif
+
+    g_impl = impl;
+    g_compress = fn;
+    g_dispatched = true;
+    return impl;
+}
+
+const char* sha256_native_impl_name(void) {
+    switch (sha256_native_dispatch()) {
+        case SHA256_IMPL_SHANI:
+            return "SHA-NI";
+        case SHA256_IMPL_AVX2:
+            return "AVX2";
+        default:
+            return "Portable C";
+    }
+}
+
+static void sha256_compress_resolve(uint32_t state[8], const uint8_t* data, size_t nblocks) {
+    sha256_native_dispatch();
+    g_compress(state, data, nblocks);
+}
+
+void sha256_native_compress(uint32_t state[8], const uint8_t* blocks, size_t nblocks) {
+    g_compress(state, blocks, nblocks);
+}
+
+void sha256_native_ctx_init(Sha256NativeCtx* ctx) {
+    memcpy(ctx->state, sha256_h0, sizeof(sha256_h0));
+    ctx->total_len = 0;
+    ctx->buffer_len = 0;
+}
+
+void sha256_native_ctx_resume(Sha256NativeCtx* ctx, const uint32_t state[8], uint64_t total_len) {
+    memcpy(ctx->state, state, sizeof(ctx->state));
+    ctx->total_len = total_len;
+    ctx->buffer_len = 0;
+}
+
+void sha256_native_ctx_update(Sha256NativeCtx* ctx, const uint8_t* data, size_t len) {
+    ctx->total_len += len;
+
+    // 버퍼에 남은 부분 블록 먼저 채우기
+    if (ctx->buffer_len > 0) {
+        size_t fill = SHA256_BLOCK_SIZE - ctx->buffer_len;
+        if (len < fill) {
+            memcpy(ctx->buffer + ctx->buffer_len, data, len);
+            ctx->buffer_len += len;
+            return;
+        }
+        memcpy(ctx->buffer + ctx->buffer_len, data, fill);
+        g_compress(ctx->state, ctx->buffer, 1);
+        data += fill;
+        len -= fill;
+        ctx->buffer_len = 0;
+    }
+
+    // 완전한 블록은 입력에서 바로 압축 (복사 없음)
+    size_t nblocks = len / SHA256_BLOCK_SIZE;
+    if (nblocks > 0) {
+        g_compress(ctx->state, data, nblocks);
+        data += nblocks * SHA256_BLOCK_SIZE;
+        len -= nblocks * SHA256_BLOCK_SIZE;
+    }
+
+    if (len > 0) {
+        memcpy(ctx->buffer, data, len);
+        ctx->buffer_len = len;
+    }
+}
+
+void sha256_native_ctx_final(Sha256NativeCtx* ctx, uint8_t digest[SHA256_DIGEST_LENGTH]) {
+    uint64_t bit_len = ctx->total_len * 8;
+    size_t n = ctx->buffer_len;
+
+    // 패딩: 0x80, 0 채움, 64비트 빅엔디안 길이
+    ctx->buffer[n++] = 0x80;
+    if (n > SHA256_BLOCK_SIZE - 8) {
+        memset(ctx->buffer + n, 0, SHA256_BLOCK_SIZE - n);
+        g_compress(ctx->state, ctx->buffer, 1);
+        n = 0;
+    }
+    memset(ctx->buffer + n, 0, SHA256_BLOCK_SIZE - 8 - n);
+    store_be32(ctx->buffer + 56, (uint32_t)(bit_len >> 32));
+    store_be32(ctx->buffer + 60, (uint32_t)bit_len);
+    g_compress(ctx->state, ctx->buffer, 1);
+
+    for (int i = 0; i < 8; i++) {
+        store_be32(digest + i * 4, ctx->state[i]);
+    }
+}
+
+/**
+ * SHA-256 해시 계산 (네이티브 엔진, 힙 할당 없음)
+ */
+int sha256_native_hash(const uint8_t* message, size_t message_len, uint8_t* digest) {
+    if ((message == NULL && message_len > 0) || digest == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+
+    Sha256NativeCtx ctx;
+    sha256_native_ctx_init(&ctx);
+    sha256_native_ctx_update(&ctx, message, message_len);
+    sha256_native_ctx_final(&ctx, digest);
+    return SUCCESS;
+}
+
+// 초기화 함수 (슬롯 인터페이스상 컨텍스트 하나만 할당)
+int sha256_native_init(void** ctx) {
+    Sha256NativeCtx* nctx = (Sha256NativeCtx*)malloc(sizeof(Sha256NativeCtx));
+    if (!nctx) {
+        return ERR_SHA256_INIT;
+    }
+
+    sha256_native_ctx_init(nctx);
+    *ctx = nctx;
+    return SUCCESS;
+}
+
+// 업데이트 함수
+int sha256_native_update(void* ctx, const unsigned char* data, size_t data_len) {
+    if (ctx == NULL || (data == NULL && data_len > 0)) {
+        return ERR_SHA256_UPDATE;
+    }
+
+    sha256_native_ctx_update((Sha256NativeCtx*)ctx, data, data_len);
+    return SUCCESS;
+}
+
+// 마무리 함수
+int sha256_native_final(void* ctx, unsigned char* digest) {
+    if (ctx == NULL) {
+        return ERR_SHA256_FINAL;
+    }
+
+    sha256_native_ctx_final((Sha256NativeCtx*)ctx, digest);
+    free(ctx);
+    return SUCCESS;
+}
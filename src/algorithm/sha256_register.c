@@ -1,19 +1,49 @@
 #include "../../include/common/algorithm_registry.h"
 #include "../../include/algorithm/sha256.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/algorithm/sha256_mb.h"
 #include <string.h>
+#include <stdio.h>
+
+// 다중 레인 배치 해시 (다이제스트를 연속 배열로 기록)
+static int sha256_native_hash_batch(const unsigned char* const inputs[], const size_t input_lens[],
+                                    unsigned char* outputs, size_t count) {
+    return sha256_hash_many(inputs, input_lens, (uint8_t (*)[SHA256_DIGEST_LENGTH])outputs, count);
+}
 
 // SHA-256 알고리즘 등록 함수
 void register_sha256_algorithm(void) {
-    REGISTER_HASH_ALGO(
+    REGISTER_HASH_ALGO_EX(
         "SHA-256",                    // 알고리즘 이름
         "보안 해시 알고리즘 256비트", // 설명
         sha256_hash,                  // 해시 함수
         sha256_init,                  // 초기화 함수
         sha256_update,                // 업데이트 함수
         sha256_final,                 // 마무리 함수
+        NULL,                         // 배치 해시 함수 (없음: 메시지별 호출)
+        SHA256_DIGEST_LENGTH,         // 출력 길이
+        "./test_vectors/SHA_256",     // 테스트 벡터 경로
+        "ShortMsg",                   // 테스트 유형들...
+        "LongMsg",
+        "Monte"
+    );
+
+    // 네이티브 엔진 백엔드 (CPUID로 SHA-NI/AVX2/이식성 C 구현 선택)
+    char native_desc[MAX_ALGO_DESC / 2];
+    snprintf(native_desc, sizeof(native_desc), "SHA-256 네이티브 엔진 (%s)", sha256_native_impl_name());
+
+    REGISTER_HASH_ALGO_EX(
+        "SHA-256-NATIVE",             // 알고리즘 이름
+        native_desc,                  // 설명
+        sha256_native_hash,           // 해시 함수
+        sha256_native_init,           // 초기화 함수
+        sha256_native_update,         // 업데이트 함수
+        sha256_native_final,          // 마무리 함수
+        sha256_native_hash_batch,     // 배치 해시 함수 (SIMD 다중 레인)
+        SHA256_DIGEST_LENGTH,         // 출력 길이
         "./test_vectors/SHA_256",     // 테스트 벡터 경로
         "ShortMsg",                   // 테스트 유형들...
         "LongMsg",
         "Monte"
     );
-} 
\ No newline at end of file
+}
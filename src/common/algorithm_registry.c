@@ -49,7 +49,8 @@ int get_algorithm_count(void) {
 // 헤더 파일에서 선언한 함수(각 알고리즘 모듈에서 구현됨)
 extern void register_sha256_algorithm(void);
 // extern void register_aes128_algorithm(void);
-// extern void register_cmac128_algorithm(void);
+extern void register_cmac128_algorithm(void);
+extern void register_hmac_sha256_algorithm(void);
 // 추가 알고리즘 등록 함수들...
 
 // 모든 알고리즘 등록
@@ -57,7 +58,8 @@ void register_all_algorithms(void) {
     // 알고리즘 모듈별 등록 함수 호출
     register_sha256_algorithm();
     // register_aes128_algorithm();
-    // register_cmac128_algorithm();
+    register_cmac128_algorithm();
+    register_hmac_sha256_algorithm();
     // ... 다른 알고리즘 등록
     
     printf("총 %d개 알고리즘 등록됨\n", g_algorithm_count);
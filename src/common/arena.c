@@ -0,0 +1,82 @@
+#include "../../include/common/arena.h"
+#include "../../include/common/common.h"
+
+// 정렬 단위로 올림
+static size_t align_up(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+// 헤더와 데이터를 한 번에 할당
+static ArenaBlock* block_new(size_t size) {
+    uint8_t* raw = (uint8_t*)malloc(sizeof(ArenaBlock) + size + ARENA_ALIGN);
+    if (raw == NULL) {
+        return NULL;
+    }
+
+    ArenaBlock* block = (ArenaBlock*)raw;
+    uintptr_t data = (uintptr_t)(raw + sizeof(ArenaBlock));
+    block->data = (uint8_t*)((data + ARENA_ALIGN - 1) & ~(uintptr_t)(ARENA_ALIGN - 1));
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+void arena_init(Arena* arena, size_t block_size) {
+    arena->head = NULL;
+    arena->block_size = align_up(block_size > 0 ? block_size : 4096);
+    arena->total = 0;
+}
+
+void arena_free(Arena* arena) {
+    ArenaBlock* block = arena->head;
+    while (block != NULL) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->total = 0;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    size_t need = align_up(size);
+    ArenaBlock* block = arena->head;
+
+    if (block == NULL || block->size - block->used < need) {
+        size_t block_size = need > arena->block_size ? need : arena->block_size;
+        ArenaBlock* fresh = block_new(block_size);
+        if (fresh == NULL) {
+            return NULL;
+        }
+        fresh->next = block;
+        arena->head = fresh;
+        arena->total += block_size;
+        block = fresh;
+    }
+
+    void* ptr = block->data + block->used;
+    block->used += need;
+    return ptr;
+}
+
+void arena_reset(Arena* arena) {
+    if (arena->head == NULL) {
+        return;
+    }
+
+    if (arena->head->next == NULL) {
+        arena->head->used = 0;
+        return;
+    }
+
+    // 여러 블록을 하나로 합침 (실패하면 빈 상태로 두고 다음 할당에서 다시 시도)
+    size_t total = arena->total;
+    arena_free(arena);
+
+    ArenaBlock* merged = block_new(total);
+    if (merged != NULL) {
+        arena->head = merged;
+        arena->total = total;
+    }
+}
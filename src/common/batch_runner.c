@@ -0,0 +1,559 @@
+#include "../../include/common/batch_runner.h"
+#include "../../include/common/algorithm_registry.h"
+#include "../../include/common/dynamic_menu.h"
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/pipeline.h"
+#include "../../include/common/result_compare.h"
+#include "../../include/common/record_index.h"
+#include "../../include/common/result_cache.h"
+#include "../../include/common/vector_cache.h"
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/perf_history.h"
+#include "../../include/common/common.h"
+#include "../../include/common/error.h"
+#include <dirent.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+// 파일 하나에 대한 배치 작업
+typedef struct {
+    int algo_id;
+    char label[MAX_PATH_LENGTH];          // 출력용 "디렉토리/파일"
+    char input_path[MAX_PATH_LENGTH];
+    char output_path[MAX_PATH_LENGTH];
+    char expected_path[MAX_PATH_LENGTH];
+    int result;                           // 실행 결과 코드
+    int compare;                          // 비교 결과 코드 (-1이면 정답 파일 없음)
+    CompareReport report;                 // 레코드별 비교 결과
+    size_t selected;                      // 선택자로 뽑은 레코드 수
+    bool partial_expected;                // 정답 일부만 비교 (결과의 나머지 레코드는 무시)
+    bool cached;                          // 결과 캐시에서 가져옴
+    double elapsed_sec;
+    bool done;
+} BatchJob;
+
+// 작업 큐 (작업 스레드가 인덱스를 하나씩 가져감)
+typedef struct {
+    const BatchOptions* options;
+    const RecordSelector* selector;       // 레코드 선택자 (NULL이면 파일 전체)
+    BatchJob* jobs;
+    size_t count;
+    size_t next;
+    pthread_mutex_t lock;
+    pthread_cond_t done_cond;
+} BatchQueue;
+
+// 이름 목록 (정렬된 복사본)
+typedef struct {
+    char** names;
+    size_t count;
+} NameList;
+
+void batch_options_init(BatchOptions* options) {
+    options->request_root = "test_vectors/request";
+    options->response_root = "test_vectors/response";
+    options->expected_root = "test_vectors/expected";
+    options->algo_filter = NULL;
+    options->jobs = 0;
+    options->verify_only = false;
+    options->file_filter = NULL;
+    options->records = NULL;
+    options->force = false;
+}
+
+// 경로 문자열 생성 (버퍼를 넘으면 false)
+static bool format_path(char* buf, size_t size, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, size, fmt, args);
+    va_end(args);
+    return n >= 0 && (size_t)n < size;
+}
+
+static int compare_names(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+static void name_list_free(NameList* list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->names[i]);
+    }
+    free(list->names);
+    list->names = NULL;
+    list->count = 0;
+}
+
+/**
+ * 디렉토리 항목을 이름순으로 나열
+ * @param want_dirs true면 하위 디렉토리만, false면 suffix로 끝나는 일반 파일만
+ *                  (압축 확장자 .gz/.zst는 떼고 비교)
+ */
+static int list_entries(const char* dir_path, bool want_dirs, const char* suffix, NameList* list) {
+    list->names = NULL;
+    list->count = 0;
+
+    DIR* dir = opendir(dir_path);
+    if (dir == NULL) {
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    size_t capacity = 0;
+    struct dirent* entry;
+    int ret = SUCCESS;
+
+    while ((entry = readdir(dir)) != NULL) {
+        const char* name = entry->d_name;
+        if (name[0] == '.') continue;
+
+        char path[MAX_PATH_LENGTH];
+        struct stat st;
+        if (!format_path(path, sizeof(path), "%s/%s", dir_path, name) || stat(path, &st) != 0) {
+            continue;
+        }
+
+        if (want_dirs) {
+            if (!S_ISDIR(st.st_mode)) continue;
+        } else {
+            size_t name_len = strlen(name) - strlen(compression_suffix(compression_kind_for_path(name)));
+            size_t suffix_len = strlen(suffix);
+            if (!S_ISREG(st.st_mode) || name_len <= suffix_len ||
+                strncmp(name + name_len - suffix_len, suffix, suffix_len) != 0) {
+                continue;
+            }
+        }
+
+        if (list->count == capacity) {
+            size_t new_capacity = capacity ? capacity * 2 : 16;
+            char** grown = (char**)realloc(list->names, new_capacity * sizeof(char*));
+            if (grown == NULL) {
+                ret = ERR_MEMORY_ALLOC;
+                break;
+            }
+            list->names = grown;
+            capacity = new_capacity;
+        }
+
+        list->names[list->count] = (char*)malloc(strlen(name) + 1);
+        if (list->names[list->count] == NULL) {
+            ret = ERR_MEMORY_ALLOC;
+            break;
+        }
+        strcpy(list->names[list->count], name);
+        list->count++;
+    }
+    closedir(dir);
+
+    if (ret != SUCCESS) {
+        name_list_free(list);
+        return ret;
+    }
+
+    if (list->count > 1) {
+        qsort(list->names, list->count, sizeof(char*), compare_names);
+    }
+    return SUCCESS;
+}
+
+// 작업 배열 끝에 추가
+static BatchJob* push_job(BatchJob** jobs, size_t* count, size_t* capacity) {
+    if (*count == *capacity) {
+        size_t new_capacity = *capacity ? *capacity * 2 : 32;
+        BatchJob* grown = (BatchJob*)realloc(*jobs, new_capacity * sizeof(BatchJob));
+        if (grown == NULL) {
+            return NULL;
+        }
+        *jobs = grown;
+        *capacity = new_capacity;
+    }
+
+    BatchJob* job = &(*jobs)[(*count)++];
+    memset(job, 0, sizeof(*job));
+    job->compare = -1;
+    return job;
+}
+
+/**
+ * 정답 파일 경로 결정
+ * <줄기>.rsp, .rsp.gz, .rsp.zst 순서로 있는 파일을 쓰고, 모두 없으면 <줄기>.rsp
+ */
+static bool format_expected_path(char* buf, size_t size, const char* dir, size_t stem_len, const char* stem) {
+    static const CompressionKind kinds[] = { COMPRESSION_NONE, COMPRESSION_GZIP, COMPRESSION_ZSTD };
+
+    for (size_t i = 0; i < sizeof(kinds) / sizeof(kinds[0]); i++) {
+        if (!format_path(buf, size, "%s/%.*s.rsp%s", dir, (int)stem_len, stem, compression_suffix(kinds[i]))) {
+            return false;
+        }
+        if (file_exists(buf)) {
+            return true;
+        }
+    }
+    return format_path(buf, size, "%s/%.*s.rsp", dir, (int)stem_len, stem);
+}
+
+/**
+ * 요청 디렉토리 하나에 해당하는 작업 생성
+ * 알고리즘의 test_vector_path 마지막 구성 요소가 디렉토리 이름과 같으면 대상
+ */
+static int collect_dir_jobs(const BatchOptions* options, const char* dir_name,
+                            BatchJob** jobs, size_t* count, size_t* capacity) {
+    char request_dir[MAX_PATH_LENGTH];
+    if (!format_path(request_dir, sizeof(request_dir), "%s/%s", options->request_root, dir_name)) {
+        printf("[건너뜀] %s: 경로가 너무 김\n", dir_name);
+        return SUCCESS;
+    }
+
+    NameList files;
+    int ret = list_entries(request_dir, false, ".req", &files);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    int primary = -1;
+    for (int algo_id = 0; algo_id < get_algorithm_count() && ret == SUCCESS; algo_id++) {
+        AlgorithmConfig* algo = get_algorithm_by_id(algo_id);
+        if (strcmp(get_filename_from_path(algo->test_vector_path), dir_name) != 0) continue;
+
+        if (primary < 0) primary = algo_id;
+        if (options->algo_filter && strcmp(options->algo_filter, algo->name) != 0) continue;
+
+        // 같은 디렉토리를 쓰는 두 번째 알고리즘부터는 하위 디렉토리에 기록
+        char output_dir[MAX_PATH_LENGTH];
+        bool ok = (algo_id == primary) ?
+            format_path(output_dir, sizeof(output_dir), "%s/%s", options->response_root, dir_name) :
+            format_path(output_dir, sizeof(output_dir), "%s/%s/%s", options->response_root, dir_name, algo->name);
+        if (!ok || create_directory(output_dir) != SUCCESS) {
+            printf("[건너뜀] %s: 응답 디렉토리를 만들 수 없음\n", algo->name);
+            continue;
+        }
+
+        char expected_dir[MAX_PATH_LENGTH];
+        for (size_t i = 0; i < files.count; i++) {
+            // 응답은 요청과 같은 형식으로 압축해 기록 (X.req.gz → X.rsp.gz)
+            const char* file = files.names[i];
+            const char* compressed = compression_suffix(compression_kind_for_path(file));
+            size_t stem_len = strlen(file) - strlen(compressed) - 4;  // ".req" 제외
+
+            BatchJob* job = push_job(jobs, count, capacity);
+            if (job == NULL) {
+                ret = ERR_MEMORY_ALLOC;
+                break;
+            }
+
+            job->algo_id = algo_id;
+            if (!format_path(job->label, sizeof(job->label), "%s/%s", dir_name, file) ||
+                !format_path(job->input_path, sizeof(job->input_path), "%s/%s", request_dir, file) ||
+                !format_path(job->output_path, sizeof(job->output_path), "%s/%.*s.rsp%s",
+                             output_dir, (int)stem_len, file, compressed) ||
+                !format_path(expected_dir, sizeof(expected_dir), "%s/%s", options->expected_root, dir_name) ||
+                !format_expected_path(job->expected_path, sizeof(job->expected_path),
+                                      expected_dir, stem_len, file)) {
+                printf("[건너뜀] %s/%s: 경로가 너무 김\n", dir_name, file);
+                (*count)--;
+            } else if (options->file_filter && strstr(job->label, options->file_filter) == NULL) {
+                (*count)--;
+            }
+        }
+    }
+
+    if (primary < 0) {
+        printf("[건너뜀] %s: 등록된 알고리즘 없음\n", dir_name);
+    }
+
+    name_list_free(&files);
+    return ret;
+}
+
+/**
+ * 선택한 레코드만 실행할 경로로 바꿈
+ * 요청/정답 파일에서 선택한 레코드를 응답 디렉토리의 <이름>.sel.req, <이름>.sel.exp.rsp로 뽑고
+ * 응답은 <이름>.sel.rsp에 기록
+ * 요청 레코드가 하나뿐인 파일(몬테 카를로 Seed 등)은 요청 전체를 실행하고 정답에서만 골라 비교
+ */
+static int prepare_selection(const BatchQueue* queue, BatchJob* job) {
+    char input[MAX_PATH_LENGTH], expected[MAX_PATH_LENGTH], output[MAX_PATH_LENGTH];
+    const char* compressed = compression_suffix(compression_kind_for_path(job->output_path));
+    size_t stem_len = strlen(job->output_path) - strlen(compressed) - 4;  // ".rsp" 제외
+
+    if (!format_path(input, sizeof(input), "%.*s.sel.req", (int)stem_len, job->output_path) ||
+        !format_path(expected, sizeof(expected), "%.*s.sel.exp.rsp", (int)stem_len, job->output_path) ||
+        !format_path(output, sizeof(output), "%.*s.sel.rsp", (int)stem_len, job->output_path)) {
+        return ERR_INVALID_INPUT;
+    }
+    strcpy(job->output_path, output);
+
+    size_t total = 0;
+    int ret = record_index_extract(job->input_path, input, queue->selector, &job->selected, &total);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    job->partial_expected = (total == 1);
+    if (!job->partial_expected) {
+        strcpy(job->input_path, input);
+    }
+
+    if (file_exists(job->expected_path)) {
+        size_t expected_count = 0;
+        ret = record_index_extract(job->expected_path, expected, queue->selector, &expected_count, NULL);
+        strcpy(job->expected_path, expected);
+        if (job->partial_expected) {
+            job->selected = expected_count;
+        }
+    }
+    return ret;
+}
+
+// 작업 하나 실행 (응답 생성 후 정답 파일이 있으면 비교)
+static void run_job(const BatchQueue* queue, BatchJob* job) {
+    const BatchOptions* options = queue->options;
+    double start = get_time_seconds();
+
+    job->result = queue->selector ? prepare_selection(queue, job) : SUCCESS;
+    if (job->result != SUCCESS || (queue->selector && job->selected == 0)) {
+        job->elapsed_sec = get_time_seconds() - start;
+        return;
+    }
+
+    // 같은 요청/정답/백엔드/빌드의 통과 결과가 있으면 재사용
+    char backend[MAX_LINE_LENGTH];
+    ResultCacheKey key;
+    bool use_cache = !options->force && !options->verify_only && queue->selector == NULL &&
+                     vector_cache_dir() != NULL &&
+                     describe_algorithm_backend(job->algo_id, backend, sizeof(backend)) == SUCCESS &&
+                     result_cache_key(job->input_path, job->expected_path, backend, &key) == SUCCESS;
+    if (use_cache) {
+        ResultCacheVerdict verdict = result_cache_lookup(&key, job->output_path);
+        if (verdict != RESULT_CACHE_MISS) {
+            job->cached = true;
+            job->result = SUCCESS;
+            job->compare = (verdict == RESULT_CACHE_PASSED) ? SUCCESS : -1;
+            job->elapsed_sec = get_time_seconds() - start;
+            return;
+        }
+    }
+
+    if (options->verify_only) {
+        job->result = file_exists(job->output_path) ? SUCCESS : ERR_FILE_NOT_FOUND;
+    } else {
+        job->result = run_vector_file(job->algo_id, job->input_path, job->output_path);
+    }
+    if (job->result == SUCCESS && file_exists(job->expected_path)) {
+        job->compare = compare_vector_files_ex(job->output_path, job->expected_path, job->partial_expected,
+                                               &job->report);
+    }
+
+    if (use_cache && job->result == SUCCESS) {
+        if (job->compare < 0) {
+            result_cache_store(&key, job->output_path, RESULT_CACHE_GENERATED);
+        } else if (job->compare == SUCCESS && compare_report_failures(&job->report) == 0) {
+            result_cache_store(&key, job->output_path, RESULT_CACHE_PASSED);
+        }
+    }
+
+    job->elapsed_sec = get_time_seconds() - start;
+}
+
+static void* batch_worker(void* arg) {
+    BatchQueue* queue = (BatchQueue*)arg;
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&queue->next, 1, __ATOMIC_RELAXED);
+        if (i >= queue->count) break;
+
+        // 계측 빌드에서는 파일마다 단계 시간을 따로 모음
+        PHASE_SCOPE_OPEN(scope, get_algorithm_by_id(queue->jobs[i].algo_id)->name, queue->jobs[i].label);
+        run_job(queue, &queue->jobs[i]);
+        PHASE_SCOPE_CLOSE(scope);
+
+        pthread_mutex_lock(&queue->lock);
+        queue->jobs[i].done = true;
+        pthread_cond_broadcast(&queue->done_cond);
+        pthread_mutex_unlock(&queue->lock);
+    }
+
+    evp_cache_thread_cleanup();
+    return NULL;
+}
+
+/**
+ * 작업 결과 한 줄 출력
+ * @return 통과(또는 정답 없이 생성 성공)면 true
+ */
+static bool print_job_result(const BatchJob* job, bool selection) {
+    const char* algo_name = get_algorithm_by_id(job->algo_id)->name;
+
+    if (job->result != SUCCESS) {
+        printf("[오류] %-16s %s: %s\n", algo_name, job->label, get_error_message(job->result));
+        return false;
+    }
+    if (selection && job->selected == 0) {
+        printf("[건너뜀] %-16s %s: 선택된 레코드 없음\n", algo_name, job->label);
+        return true;
+    }
+    if (job->compare < 0) {
+        printf("[생성] %-16s %s (정답 파일 없음%s, %.3f초)\n", algo_name, job->label,
+               job->cached ? ", 캐시" : "", job->elapsed_sec);
+        return true;
+    }
+    if (job->compare == SUCCESS && compare_report_failures(&job->report) == 0) {
+        if (selection) {
+            printf("[통과] %-16s %s (레코드 %zu개, %.3f초)\n", algo_name, job->label, job->selected, job->elapsed_sec);
+        } else if (job->cached) {
+            printf("[통과] %-16s %s (캐시, %.3f초)\n", algo_name, job->label, job->elapsed_sec);
+        } else {
+            printf("[통과] %-16s %s (%.3f초)\n", algo_name, job->label, job->elapsed_sec);
+        }
+        return true;
+    }
+    if (job->compare != SUCCESS) {
+        printf("[실패] %-16s %s: %s\n", algo_name, job->label, get_error_message(job->compare));
+        return false;
+    }
+
+    const CompareReport* report = &job->report;
+    printf("[실패] %-16s %s: 레코드 %zu개 중 불일치 %zu개, 누락 %zu개, 추가 %zu개\n",
+           algo_name, job->label, report->records, report->mismatched, report->missing, report->extra);
+    if (report->diff != NULL) {
+        fputs(report->diff, stdout);
+    }
+    return false;
+}
+
+/**
+ * 실제로 실행한 작업의 처리량(요청 파일 크기 / 실행 시간)을 성능 기록에 덧붙임
+ * 캐시에서 가져온 작업, 검증 전용 실행, 레코드 선택 실행은 기록하지 않음
+ */
+static void record_history(const BatchOptions* options, const BatchJob* jobs, size_t count, bool selection) {
+    if (options->verify_only || selection || perf_history_path() == NULL) {
+        return;
+    }
+
+    PerfHistoryRecord* records = (PerfHistoryRecord*)malloc((count + 1) * sizeof(PerfHistoryRecord));
+    if (records == NULL) {
+        return;
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        const BatchJob* job = &jobs[i];
+        struct stat st;
+        if (job->cached || job->result != SUCCESS || job->elapsed_sec <= 0 ||
+            stat(job->input_path, &st) != 0 || st.st_size <= 0) {
+            continue;
+        }
+
+        PerfHistoryRecord* record = &records[n++];
+        perf_history_record_init(record, "batch");
+        snprintf(record->algorithm, sizeof(record->algorithm), "%s", get_algorithm_by_id(job->algo_id)->name);
+        if (describe_algorithm_backend(job->algo_id, record->backend, sizeof(record->backend)) != SUCCESS) {
+            record->backend[0] = '\0';
+        }
+        snprintf(record->path, sizeof(record->path), "%s", job->label);
+        record->size = (uint64_t)st.st_size;
+        record->mb_per_sec = (double)st.st_size / job->elapsed_sec * 1e-6;
+        record->trials = 1;
+    }
+
+    int ret = perf_history_append(records, n);
+    if (ret != SUCCESS) {
+        printf("경고: 성능 기록 실패 (%s)\n", get_error_message(ret));
+    }
+    free(records);
+}
+
+int run_batch(const BatchOptions* options) {
+    RecordSelector parsed_selector;
+    const RecordSelector* selector = NULL;
+    if (options->records != NULL) {
+        if (record_selector_parse(options->records, &parsed_selector) != SUCCESS) {
+            printf("잘못된 레코드 선택자: %s\n", options->records);
+            return ERR_INVALID_INPUT;
+        }
+        selector = &parsed_selector;
+    }
+
+    NameList dirs;
+    if (list_entries(options->request_root, true, NULL, &dirs) != SUCCESS) {
+        print_error(ERR_FILE_NOT_FOUND);
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    BatchJob* jobs = NULL;
+    size_t job_count = 0, job_capacity = 0;
+    int ret = SUCCESS;
+
+    for (size_t i = 0; i < dirs.count && ret == SUCCESS; i++) {
+        ret = collect_dir_jobs(options, dirs.names[i], &jobs, &job_count, &job_capacity);
+    }
+    name_list_free(&dirs);
+
+    if (ret != SUCCESS) {
+        free(jobs);
+        print_error(ret);
+        return ret;
+    }
+
+    int cpus = get_cpu_count();
+    int thread_count = options->jobs > 0 ? options->jobs : cpus;
+    if ((size_t)thread_count > job_count) thread_count = job_count > 0 ? (int)job_count : 1;
+
+    // 파일 단위 스레드가 코어를 나눠 쓰므로 파일 내부 파이프라인은 남는 코어만 사용
+    int per_file = cpus / thread_count;
+    pipeline_set_default_workers(per_file > 1 ? per_file - 1 : 0);
+
+    printf("%s: 작업 %zu개, 작업 스레드 %d개\n", options->verify_only ? "응답 검증" : "배치 실행",
+           job_count, thread_count);
+
+    prepare_algorithms_for_threads();
+
+    BatchQueue queue = { options, selector, jobs, job_count, 0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER };
+    pthread_t* threads = (pthread_t*)calloc((size_t)thread_count, sizeof(pthread_t));
+    if (threads == NULL) {
+        free(jobs);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    double start = get_time_seconds();
+    int started = 0;
+    for (; started < thread_count; started++) {
+        if (pthread_create(&threads[started], NULL, batch_worker, &queue) != 0) break;
+    }
+
+    // 스레드를 하나도 못 만들면 현재 스레드에서 실행
+    if (started == 0) {
+        batch_worker(&queue);
+    }
+
+    // 완료 순서와 관계없이 작업 순서대로 출력
+    size_t passed = 0, failed = 0;
+    for (size_t i = 0; i < job_count; i++) {
+        pthread_mutex_lock(&queue.lock);
+        while (!jobs[i].done) {
+            pthread_cond_wait(&queue.done_cond, &queue.lock);
+        }
+        pthread_mutex_unlock(&queue.lock);
+
+        if (print_job_result(&jobs[i], selector != NULL)) {
+            passed++;
+        } else {
+            failed++;
+        }
+        compare_report_free(&jobs[i].report);
+        fflush(stdout);
+    }
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    printf("배치 완료: 통과 %zu개, 실패 %zu개 (%.3f초)\n", passed, failed, get_time_seconds() - start);
+    record_history(options, jobs, job_count, selector != NULL);
+
+    pthread_mutex_destroy(&queue.lock);
+    pthread_cond_destroy(&queue.done_cond);
+    free(threads);
+    free(jobs);
+    return failed == 0 ? SUCCESS : ERR_TEST_FAILED;
+}
@@ -0,0 +1,653 @@
+#ifndef _WIN32
+#define _GNU_SOURCE  // sched_setaffinity, sched_getcpu
+#endif
+
+#include "../../include/common/bench.h"
+#include "../../include/common/algorithm_registry.h"
+#include "../../include/common/dynamic_menu.h"
+#include "../../include/common/cycle_timer.h"
+#include "../../include/common/perf_counters.h"
+#include "../../include/common/perf_history.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+
+// 기본 크기: 16B부터 16MB까지 4배씩
+#define BENCH_DEFAULT_MIN_SIZE 16
+#define BENCH_DEFAULT_MAX_SIZE (16u * 1024 * 1024)
+
+// hash_many가 없거나 출력 길이를 모를 때의 출력 간격
+#define BENCH_MAX_DIGEST 64
+
+// 크기 목록 한 항목 상한
+#define BENCH_MAX_SIZE (1024u * 1024 * 1024)
+
+// MAC 경로에서 쓸 수 있는 최대 키 길이
+#define BENCH_MAC_MAX_KEY 64
+
+// 측정 한 건의 입력
+typedef struct {
+    const AlgorithmConfig* algo;
+    BenchPath path;
+    const uint8_t* data;
+    size_t size;
+    size_t batch;
+    const unsigned char* inputs[BENCH_BATCH_MAX_MSGS];
+    size_t lens[BENCH_BATCH_MAX_MSGS];
+    unsigned char* outputs;      // batch * BENCH_MAX_DIGEST
+    // MAC 경로
+    const uint8_t* mac_keys;     // BENCH_MAC_ROTATE_KEYS개 키 (첫 키가 고정 키)
+    size_t key_len;
+    size_t tag_len;
+    size_t next_key;             // 키 교체 경로에서 다음에 쓸 키
+    const unsigned char* keys[BENCH_BATCH_MAX_MSGS];
+    size_t key_lens[BENCH_BATCH_MAX_MSGS];
+    const unsigned char* tags[BENCH_BATCH_MAX_MSGS];
+    size_t tag_lens[BENCH_BATCH_MAX_MSGS];
+    int verdicts[BENCH_BATCH_MAX_MSGS];
+    unsigned char* expected;     // 검증 경로 정답 태그 (batch * BENCH_MAX_DIGEST)
+} BenchCase;
+
+void bench_options_init(BenchOptions* options) {
+    options->algo_filter = NULL;
+    options->sizes = NULL;
+    options->json_path = NULL;
+    options->cpu = -1;
+    options->min_time = 0.1;
+    options->trials = 5;
+}
+
+const char* bench_path_name(BenchPath path) {
+    switch (path) {
+        case BENCH_PATH_ONESHOT: return "oneshot";
+        case BENCH_PATH_STREAM: return "stream";
+        case BENCH_PATH_BATCH: return "batch";
+        case BENCH_PATH_MAC: return "mac";
+        case BENCH_PATH_MAC_ROTATE: return "mac-rotate";
+        case BENCH_PATH_VERIFY_MANY: return "verify-many";
+        default: return "?";
+    }
+}
+
+// TSC 값 (TSC가 없으면 0이므로 cycles/B도 0)
+static inline uint64_t read_tsc(void) {
+#ifdef CYCLE_TIMER_TSC
+    return cycle_timer_now();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * 실행 스레드를 CPU 하나에 고정 (주파수/캐시 상태가 측정 사이에 바뀌지 않도록)
+ * @return 고정한 CPU 번호, 고정하지 않았으면 -1
+ */
+static int pin_cpu(int cpu) {
+    if (cpu < -1) {
+        return -1;
+    }
+#ifdef _WIN32
+    if (cpu == -1) cpu = (int)GetCurrentProcessorNumber();
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0 ? cpu : -1;
+#elif defined(__linux__)
+    if (cpu == -1) cpu = sched_getcpu();
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return -1;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0 ? cpu : -1;
+#else
+    return -1;
+#endif
+}
+
+// "64", "4K", "16M" 해석 (0이면 오류)
+static size_t parse_size(const char* str, const char** end) {
+    char* tail;
+    unsigned long long value = strtoull(str, &tail, 10);
+    if (tail == str) {
+        return 0;
+    }
+
+    switch (*tail) {
+        case 'k': case 'K': value <<= 10; tail++; break;
+        case 'm': case 'M': value <<= 20; tail++; break;
+        case 'g': case 'G': value <<= 30; tail++; break;
+        default: break;
+    }
+    if (*tail == 'B' || *tail == 'b') tail++;
+
+    *end = tail;
+    return value > 0 && value <= BENCH_MAX_SIZE ? (size_t)value : 0;
+}
+
+static int parse_sizes(const char* spec, size_t sizes[BENCH_MAX_SIZES], size_t* count) {
+    *count = 0;
+    if (spec == NULL) {
+        for (size_t s = BENCH_DEFAULT_MIN_SIZE; s <= BENCH_DEFAULT_MAX_SIZE; s *= 4) {
+            sizes[(*count)++] = s;
+        }
+        return SUCCESS;
+    }
+
+    const char* p = spec;
+    while (*p != '\0') {
+        const char* end;
+        size_t size = parse_size(p, &end);
+        if (size == 0 || *count == BENCH_MAX_SIZES || (*end != ',' && *end != '\0')) {
+            return ERR_INVALID_INPUT;
+        }
+        sizes[(*count)++] = size;
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return *count > 0 ? SUCCESS : ERR_INVALID_INPUT;
+}
+
+// 크기별 배치 메시지 수 (배치 하나가 BENCH_BATCH_BYTES를 넘지 않도록)
+static size_t batch_count(size_t size) {
+    size_t n = BENCH_BATCH_BYTES / size;
+    if (n < 1) n = 1;
+    return n < BENCH_BATCH_MAX_MSGS ? n : BENCH_BATCH_MAX_MSGS;
+}
+
+// 재현 가능한 의사 난수 입력
+static void fill_pattern(uint8_t* data, size_t size) {
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < size; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        data[i] = (uint8_t)x;
+    }
+}
+
+// 스트리밍 경로 한 번: init → BENCH_STREAM_CHUNK 단위 update → final
+static int run_stream(const AlgorithmConfig* algo, const uint8_t* data, size_t size, unsigned char* digest) {
+    void* ctx = NULL;
+    if (algo->ops.hash.hash_init(&ctx) != SUCCESS) {
+        return ERR_CRYPTO_OPERATION;
+    }
+
+    for (size_t off = 0; off < size; off += BENCH_STREAM_CHUNK) {
+        size_t n = size - off < BENCH_STREAM_CHUNK ? size - off : BENCH_STREAM_CHUNK;
+        if (algo->ops.hash.hash_update(ctx, data + off, n) != SUCCESS) {
+            algo->ops.hash.hash_final(ctx, digest);
+            return ERR_CRYPTO_OPERATION;
+        }
+    }
+    return algo->ops.hash.hash_final(ctx, digest) == SUCCESS ? SUCCESS : ERR_CRYPTO_OPERATION;
+}
+
+// 알고리즘 종류에 맞는 측정 경로인지
+static bool path_applies(const AlgorithmConfig* algo, BenchPath path) {
+    bool mac_path = path == BENCH_PATH_MAC || path == BENCH_PATH_MAC_ROTATE || path == BENCH_PATH_VERIFY_MANY;
+    return algo->type == ALGO_TYPE_MAC ? mac_path : !mac_path;
+}
+
+// 검증 경로 한 번: 레코드 batch개를 한 번에 (배치 함수가 없으면 레코드별로) 검증
+static int run_verify(BenchCase* c) {
+    const AlgorithmConfig* algo = c->algo;
+
+    if (algo->ops.mac.mac_verify_many != NULL) {
+        if (algo->ops.mac.mac_verify_many(c->keys, c->key_lens, c->inputs, c->lens, c->tags, c->tag_lens,
+                                          c->verdicts, c->batch) != SUCCESS) {
+            return ERR_CRYPTO_OPERATION;
+        }
+    } else {
+        for (size_t i = 0; i < c->batch; i++) {
+            c->verdicts[i] = algo->ops.mac.mac_verify(c->keys[i], c->key_lens[i], c->inputs[i], c->lens[i],
+                                                      c->tags[i], c->tag_lens[i]);
+        }
+    }
+
+    // 정답 태그이므로 모두 통과해야 함
+    for (size_t i = 0; i < c->batch; i++) {
+        if (c->verdicts[i] != SUCCESS) {
+            return ERR_CRYPTO_OPERATION;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * 검증 경로 준비: 고정 키로 메시지마다 정답 태그 계산
+ * 측정 시간에는 포함하지 않음
+ */
+static int prepare_verify(BenchCase* c) {
+    for (size_t i = 0; i < c->batch; i++) {
+        unsigned char* tag = c->expected + i * BENCH_MAX_DIGEST;
+        if (c->algo->ops.mac.mac_function(c->mac_keys, c->key_len, c->inputs[i], c->lens[i], tag,
+                                          c->tag_len) != SUCCESS) {
+            return ERR_CRYPTO_OPERATION;
+        }
+        c->keys[i] = c->mac_keys;
+        c->key_lens[i] = c->key_len;
+        c->tags[i] = tag;
+        c->tag_lens[i] = c->tag_len;
+    }
+    return SUCCESS;
+}
+
+// 측정 대상 호출 한 번
+static int run_case(BenchCase* c) {
+    const AlgorithmConfig* algo = c->algo;
+    const uint8_t* key;
+
+    switch (c->path) {
+        case BENCH_PATH_ONESHOT:
+            return algo->ops.hash.hash_function(c->data, c->size, c->outputs) == SUCCESS ?
+                   SUCCESS : ERR_CRYPTO_OPERATION;
+        case BENCH_PATH_STREAM:
+            return run_stream(algo, c->data, c->size, c->outputs);
+        case BENCH_PATH_BATCH:
+            if (algo->ops.hash.hash_many != NULL && algo->ops.hash.digest_len <= BENCH_MAX_DIGEST) {
+                return algo->ops.hash.hash_many(c->inputs, c->lens, c->outputs, c->batch) == SUCCESS ?
+                       SUCCESS : ERR_CRYPTO_OPERATION;
+            }
+            // 배치 함수가 없는 백엔드는 배치 실행기와 같이 메시지별로 호출
+            for (size_t i = 0; i < c->batch; i++) {
+                if (algo->ops.hash.hash_function(c->inputs[i], c->lens[i],
+                                                 c->outputs + i * BENCH_MAX_DIGEST) != SUCCESS) {
+                    return ERR_CRYPTO_OPERATION;
+                }
+            }
+            return SUCCESS;
+        case BENCH_PATH_MAC:
+        case BENCH_PATH_MAC_ROTATE:
+            key = c->mac_keys;
+            if (c->path == BENCH_PATH_MAC_ROTATE) {
+                key += c->next_key * c->key_len;
+                c->next_key = (c->next_key + 1) % BENCH_MAC_ROTATE_KEYS;
+            }
+            return algo->ops.mac.mac_function(key, c->key_len, c->data, c->size, c->outputs, c->tag_len) == SUCCESS ?
+                   SUCCESS : ERR_CRYPTO_OPERATION;
+        case BENCH_PATH_VERIFY_MANY:
+            return run_verify(c);
+        default:
+            return ERR_INVALID_INPUT;
+    }
+}
+
+static int time_iterations(BenchCase* c, size_t iterations, double* seconds, uint64_t* ticks) {
+    double start = get_time_seconds();
+    uint64_t t0 = read_tsc();
+
+    for (size_t i = 0; i < iterations; i++) {
+        int ret = run_case(c);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+    }
+
+    *ticks = read_tsc() - t0;
+    *seconds = get_time_seconds() - start;
+    return SUCCESS;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double* values, size_t n) {
+    qsort(values, n, sizeof(double), compare_doubles);
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+// 중앙값 절대 편차 (values 순서가 바뀜)
+static double median_abs_deviation(double* values, size_t n) {
+    double center = median(values, n);
+    for (size_t i = 0; i < n; i++) {
+        values[i] = values[i] > center ? values[i] - center : center - values[i];
+    }
+    return median(values, n);
+}
+
+/**
+ * 측정 한 건
+ * 워밍업으로 반복 수를 늘려 가며 한 번 실행 시간을 재고(캐시, 분기 예측, 클럭 안정화),
+ * min_time을 채우는 반복 수로 trials번 측정해 중앙값을 사용
+ */
+static int measure_case(BenchCase* c, const BenchOptions* options, BenchResult* result) {
+    size_t iterations = 1;
+    double elapsed = 0;
+    uint64_t ticks = 0;
+    double warmup = options->min_time / 4;
+
+    for (;;) {
+        int ret = time_iterations(c, iterations, &elapsed, &ticks);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+        if (elapsed >= warmup || iterations >= ((size_t)1 << 30)) break;
+        iterations *= (elapsed < warmup / 10) ? 10 : 2;
+    }
+
+    double per_iteration = elapsed / (double)iterations;
+    double target = per_iteration > 0 ? options->min_time / per_iteration : (double)iterations;
+    iterations = target < 1 ? 1 : (size_t)target;
+
+    int trials = options->trials > 0 ? options->trials : 1;
+    double* ns = (double*)malloc(sizeof(double) * 3 * (size_t)trials);
+    if (ns == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+    double* cpb = ns + trials;
+    double* mbs = cpb + trials;
+
+    double bytes = (double)c->size * (double)c->batch * (double)iterations;
+    for (int t = 0; t < trials; t++) {
+        int ret = time_iterations(c, iterations, &elapsed, &ticks);
+        if (ret != SUCCESS) {
+            free(ns);
+            return ret;
+        }
+        ns[t] = elapsed * 1e9 / ((double)iterations * (double)c->batch);
+        cpb[t] = (double)ticks / bytes;
+        mbs[t] = ns[t] > 0 ? (double)c->size / ns[t] * 1e3 : 0;
+    }
+
+    // --perf: 시간 측정과 따로 한 번 더 실행해 하드웨어 카운터를 "알고리즘/경로" 이름으로 누적
+    if (g_perf_profile_enabled) {
+        char label[64];
+        PerfMark perf;
+        snprintf(label, sizeof(label), "%s/%s", c->algo->name, bench_path_name(c->path));
+        perf_profile_set_label(label);
+        perf_profile_begin(&perf);
+        int ret = time_iterations(c, iterations, &elapsed, &ticks);
+        perf_profile_end(&perf, c->size * c->batch * iterations, c->batch * iterations);
+        perf_profile_set_label(NULL);
+        if (ret != SUCCESS) {
+            free(ns);
+            return ret;
+        }
+    }
+
+    result->size = c->size;
+    result->batch = c->batch;
+    result->ns_per_op = median(ns, (size_t)trials);
+    result->mb_per_sec = result->ns_per_op > 0 ? (double)c->size / result->ns_per_op * 1e3 : 0;
+    result->cycles_per_byte = median(cpb, (size_t)trials);
+    result->mb_per_sec_mad = median_abs_deviation(mbs, (size_t)trials);
+    free(ns);
+    return SUCCESS;
+}
+
+static BenchResult* push_result(BenchReport* report) {
+    if (report->count == report->capacity) {
+        size_t capacity = report->capacity ? report->capacity * 2 : 64;
+        BenchResult* grown = (BenchResult*)realloc(report->results, capacity * sizeof(BenchResult));
+        if (grown == NULL) {
+            return NULL;
+        }
+        report->results = grown;
+        report->capacity = capacity;
+    }
+
+    BenchResult* result = &report->results[report->count++];
+    memset(result, 0, sizeof(*result));
+    return result;
+}
+
+int bench_run(const BenchOptions* options, BenchReport* report) {
+    memset(report, 0, sizeof(*report));
+
+    size_t sizes[BENCH_MAX_SIZES], size_count;
+    if (parse_sizes(options->sizes, sizes, &size_count) != SUCCESS) {
+        return ERR_INVALID_INPUT;
+    }
+
+    // 입력 버퍼: 가장 큰 배치 하나 크기
+    size_t buffer_size = 0;
+    for (size_t i = 0; i < size_count; i++) {
+        size_t need = sizes[i] * batch_count(sizes[i]);
+        if (need > buffer_size) buffer_size = need;
+    }
+
+    BenchCase c;
+    memset(&c, 0, sizeof(c));
+    uint8_t* data = (uint8_t*)malloc(buffer_size);
+    uint8_t mac_keys[BENCH_MAC_ROTATE_KEYS * BENCH_MAC_MAX_KEY];
+    c.outputs = (unsigned char*)malloc(BENCH_BATCH_MAX_MSGS * BENCH_MAX_DIGEST);
+    c.expected = (unsigned char*)malloc(BENCH_BATCH_MAX_MSGS * BENCH_MAX_DIGEST);
+    if (data == NULL || c.outputs == NULL || c.expected == NULL) {
+        free(data);
+        free(c.outputs);
+        free(c.expected);
+        return ERR_MEMORY_ALLOC;
+    }
+    fill_pattern(data, buffer_size);
+    fill_pattern(mac_keys, sizeof(mac_keys));
+    c.mac_keys = mac_keys;
+
+    get_cpu_model(report->cpu_model, sizeof(report->cpu_model));
+    report->cpu = pin_cpu(options->cpu);
+#ifdef CYCLE_TIMER_TSC
+    report->tsc_ghz = cycle_timer_ticks_per_ns();
+#endif
+
+    int ret = SUCCESS;
+    for (int algo_id = 0; algo_id < get_algorithm_count() && ret == SUCCESS; algo_id++) {
+        const AlgorithmConfig* algo = get_algorithm_by_id(algo_id);
+        if (options->algo_filter && strcmp(options->algo_filter, algo->name) != 0) continue;
+        if (algo->type != ALGO_TYPE_HASH && algo->type != ALGO_TYPE_MAC) {
+            printf("[건너뜀] %s: 해시/MAC 알고리즘만 측정\n", algo->name);
+            continue;
+        }
+        if (algo->type == ALGO_TYPE_MAC) {
+            // 키 길이가 가변이면 BENCH_MAC_KEY_LEN 바이트 키, 태그는 최대 길이
+            c.key_len = algo->ops.mac.key_len ? algo->ops.mac.key_len : BENCH_MAC_KEY_LEN;
+            c.tag_len = algo->ops.mac.max_tag_len;
+            if (c.key_len > BENCH_MAC_MAX_KEY || c.tag_len == 0 || c.tag_len > BENCH_MAX_DIGEST) {
+                printf("[건너뜀] %s: 지원하지 않는 키/태그 길이\n", algo->name);
+                continue;
+            }
+        }
+
+        c.algo = algo;
+        bool failed = false;
+        for (size_t s = 0; s < size_count && !failed; s++) {
+            for (int path = 0; path < BENCH_PATH_COUNT && !failed; path++) {
+                if (!path_applies(algo, (BenchPath)path)) continue;
+
+                c.path = (BenchPath)path;
+                c.data = data;
+                c.size = sizes[s];
+                c.batch = (path == BENCH_PATH_BATCH || path == BENCH_PATH_VERIFY_MANY) ? batch_count(sizes[s]) : 1;
+                c.next_key = 0;
+                for (size_t i = 0; i < c.batch; i++) {
+                    c.inputs[i] = data + i * sizes[s];
+                    c.lens[i] = sizes[s];
+                }
+
+                int status = path == BENCH_PATH_VERIFY_MANY ? prepare_verify(&c) : SUCCESS;
+                if (status != SUCCESS) {
+                    printf("[오류] %s %s %zuB: %s\n", algo->name, bench_path_name(c.path), c.size,
+                           get_error_message(status));
+                    failed = true;
+                    break;
+                }
+
+                BenchResult* result = push_result(report);
+                if (result == NULL) {
+                    ret = ERR_MEMORY_ALLOC;
+                    failed = true;
+                    break;
+                }
+                result->algo_id = algo_id;
+                result->path = c.path;
+
+                status = measure_case(&c, options, result);
+                if (status != SUCCESS) {
+                    // 실패한 알고리즘은 나머지 크기를 건너뜀
+                    printf("[오류] %s %s %zuB: %s\n", algo->name, bench_path_name(c.path), c.size,
+                           get_error_message(status));
+                    report->count--;
+                    if (status == ERR_MEMORY_ALLOC) ret = status;
+                    failed = true;
+                }
+            }
+        }
+    }
+
+    free(data);
+    free(c.outputs);
+    free(c.expected);
+    return ret;
+}
+
+// 16B, 4KB, 16MB 형식
+static void format_size(char* buf, size_t size, size_t bytes) {
+    if (bytes >= (1u << 20) && bytes % (1u << 20) == 0) {
+        snprintf(buf, size, "%zuMB", bytes >> 20);
+    } else if (bytes >= 1024 && bytes % 1024 == 0) {
+        snprintf(buf, size, "%zuKB", bytes >> 10);
+    } else {
+        snprintf(buf, size, "%zuB", bytes);
+    }
+}
+
+void bench_report_print(const BenchReport* report) {
+    printf("CPU: %s", report->cpu_model);
+    if (report->cpu >= 0) printf(" (CPU %d 고정)", report->cpu);
+    if (report->tsc_ghz > 0) printf(", TSC %.2fGHz", report->tsc_ghz);
+    printf("\n\n");
+
+    // 한글 제목은 printf 폭 계산이 맞지 않으므로 공백으로 맞춤
+    printf("알고리즘           경로            크기   배치          ns/op         MB/s   cycles/B\n");
+
+    int last_algo = -1;
+    for (size_t i = 0; i < report->count; i++) {
+        const BenchResult* r = &report->results[i];
+        if (last_algo >= 0 && r->algo_id != last_algo) printf("\n");
+        last_algo = r->algo_id;
+
+        char size_label[24];
+        format_size(size_label, sizeof(size_label), r->size);
+        printf("%-18s %-11s %8s %6zu %14.1f %12.1f ", get_algorithm_by_id(r->algo_id)->name,
+               bench_path_name(r->path), size_label, r->batch, r->ns_per_op, r->mb_per_sec);
+        if (r->cycles_per_byte > 0) {
+            printf("%10.2f\n", r->cycles_per_byte);
+        } else {
+            printf("%10s\n", "-");
+        }
+    }
+}
+
+// JSON 문자열 (따옴표, 역슬래시, 제어 문자 이스케이프)
+static void json_string(FILE* fp, const char* str) {
+    fputc('"', fp);
+    for (const unsigned char* p = (const unsigned char*)str; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fprintf(fp, "\\%c", *p);
+        } else if (*p < 0x20) {
+            fprintf(fp, "\\u%04x", *p);
+        } else {
+            fputc(*p, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+int bench_report_write_json(const BenchReport* report, const char* path) {
+    FILE* fp = fopen(path, "w");
+    if (fp == NULL) {
+        return ERR_FILE_CREATE;
+    }
+
+    fprintf(fp, "{\n  \"cpu_model\": ");
+    json_string(fp, report->cpu_model);
+    fprintf(fp, ",\n  \"pinned_cpu\": %d,\n  \"tsc_ghz\": %.3f,\n  \"results\": [\n", report->cpu, report->tsc_ghz);
+
+    for (size_t i = 0; i < report->count; i++) {
+        const BenchResult* r = &report->results[i];
+        char backend[MAX_LINE_LENGTH];
+        if (describe_algorithm_backend(r->algo_id, backend, sizeof(backend)) != SUCCESS) {
+            backend[0] = '\0';
+        }
+
+        fprintf(fp, "    {\"algorithm\": ");
+        json_string(fp, get_algorithm_by_id(r->algo_id)->name);
+        fprintf(fp, ", \"backend\": ");
+        json_string(fp, backend);
+        fprintf(fp, ", \"path\": \"%s\", \"size\": %zu, \"batch\": %zu, "
+                    "\"ns_per_op\": %.3f, \"mb_per_sec\": %.3f, \"cycles_per_byte\": %.4f}%s\n",
+                bench_path_name(r->path), r->size, r->batch, r->ns_per_op, r->mb_per_sec,
+                r->cycles_per_byte, i + 1 < report->count ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n}\n");
+    return fclose(fp) == 0 ? SUCCESS : ERR_FILE_WRITE;
+}
+
+int bench_report_record_history(const BenchReport* report, int trials) {
+    if (report->count == 0) {
+        return SUCCESS;
+    }
+
+    PerfHistoryRecord* records = (PerfHistoryRecord*)malloc(report->count * sizeof(PerfHistoryRecord));
+    if (records == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    for (size_t i = 0; i < report->count; i++) {
+        const BenchResult* r = &report->results[i];
+        PerfHistoryRecord* record = &records[i];
+        perf_history_record_init(record, "bench");
+        snprintf(record->algorithm, sizeof(record->algorithm), "%s", get_algorithm_by_id(r->algo_id)->name);
+        if (describe_algorithm_backend(r->algo_id, record->backend, sizeof(record->backend)) != SUCCESS) {
+            record->backend[0] = '\0';
+        }
+        snprintf(record->path, sizeof(record->path), "%s", bench_path_name(r->path));
+        record->size = r->size;
+        record->mb_per_sec = r->mb_per_sec;
+        record->mad = r->mb_per_sec_mad;
+        record->trials = trials;
+    }
+
+    int ret = perf_history_append(records, report->count);
+    free(records);
+    return ret;
+}
+
+void bench_report_free(BenchReport* report) {
+    free(report->results);
+    memset(report, 0, sizeof(*report));
+}
+
+int run_bench(const BenchOptions* options) {
+    BenchReport report;
+    int ret = bench_run(options, &report);
+    if (ret != SUCCESS) {
+        print_error(ret);
+        bench_report_free(&report);
+        return ret;
+    }
+
+    bench_report_print(&report);
+    perf_profile_report();
+
+    // 성능 기록은 실패해도 측정 결과에는 영향 없음
+    int history = bench_report_record_history(&report, options->trials > 0 ? options->trials : 1);
+    if (history != SUCCESS) {
+        printf("경고: 성능 기록 실패 (%s)\n", get_error_message(history));
+    }
+    if (options->json_path != NULL) {
+        ret = bench_report_write_json(&report, options->json_path);
+        if (ret != SUCCESS) {
+            print_error(ret);
+        } else {
+            printf("\nJSON 결과: %s\n", options->json_path);
+        }
+    }
+
+    bench_report_free(&report);
+    return ret;
+}
@@ -1,13 +1,27 @@
 #include "../include/common/common.h"
 #include "../include/common/error.h"
-#include <direct.h> // Windows _mkdir 함수용
+#include "../include/common/hex_codec.h"
+#include "../include/common/vector_reader.h"
+#include "../include/common/result_compare.h"
 #include <string.h>
 #include <sys/stat.h>
 #include <ctype.h>
 #include <errno.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <direct.h> // Windows _mkdir 함수용
+#define PATH_SEP '\\'
+#define make_dir(path) _mkdir(path)
+#else
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#define PATH_SEP '/'
+#define make_dir(path) mkdir((path), 0755)
+#endif
 
 /**
- * 16진수 문자열을 바이트 배열로 변환
+ * 16진수 문자열을 바이트 배열로 변환 (hex_decode 래퍼)
  * @param hex_string 16진수 문자열
  * @param bytes 출력 바이트 배열
  * @param max_len 최대 바이트 길이
@@ -18,64 +32,12 @@ int hex_to_bytes_ex(const char* hex_string, uint8_t* bytes, size_t max_len, size
     if (hex_string == NULL) {
         return ERR_INVALID_INPUT;
     }
-    
-    // 문자열에 유효하지 않은 문자가 있는지 확인
-    for (size_t i = 0; i < strlen(hex_string); i++) {
-        char ch = hex_string[i];
-        if (!((ch >= '0' && ch <= '9') || 
-              (ch >= 'a' && ch <= 'f') || 
-              (ch >= 'A' && ch <= 'F'))) {
-            return ERR_INVALID_FORMAT;
-        }
-    }
-    
-    size_t hex_len = strlen(hex_string);
-    size_t byte_len = hex_len / 2;
-    
-    // 홀수 길이 처리
-    if (hex_len % 2 != 0) {
-        char* padded_hex = (char*)malloc(hex_len + 2);
-        if (!padded_hex) {
-            return ERR_MEMORY_ALLOC;
-        }
-        padded_hex[0] = '0';
-        strcpy(padded_hex + 1, hex_string);
-        
-        int result = hex_to_bytes_ex(padded_hex, bytes, max_len, bytes_converted);
-        free(padded_hex);
-        return result;
-    }
-    
-    if (byte_len > max_len) {
+
+    int result = hex_decode(hex_string, strlen(hex_string), bytes, max_len, bytes_converted);
+    if (result == ERR_HEX_BUFFER_OVERFLOW) {
         return ERR_INVALID_INPUT;
     }
-    
-    // 2자리 16진수씩 처리
-    for (size_t i = 0; i < byte_len; i++) {
-        char high = hex_string[i*2];
-        char low = hex_string[i*2 + 1];
-        
-        uint8_t high_val = 0, low_val = 0;
-        
-        // 상위 4비트
-        if (high >= '0' && high <= '9') high_val = high - '0';
-        else if (high >= 'a' && high <= 'f') high_val = high - 'a' + 10;
-        else if (high >= 'A' && high <= 'F') high_val = high - 'A' + 10;
-        
-        // 하위 4비트
-        if (low >= '0' && low <= '9') low_val = low - '0';
-        else if (low >= 'a' && low <= 'f') low_val = low - 'a' + 10;
-        else if (low >= 'A' && low <= 'F') low_val = low - 'A' + 10;
-        
-        bytes[i] = (high_val << 4) | low_val;
-    }
-    
-    // 변환된 바이트 수 반환
-    if (bytes_converted != NULL) {
-        *bytes_converted = byte_len;
-    }
-    
-    return SUCCESS;
+    return result;
 }
 
 // 기존 함수는 호환성을 위해 유지하되, 새 함수를 호출하도록 수정
@@ -91,12 +53,11 @@ int hex_to_bytes(const char* hex_string, uint8_t* bytes, size_t max_len) {
 }
 
 /**
- * 바이트 배열을 16진수 문자열로 변환
+ * 바이트 배열을 16진수 문자열로 변환 (hex_encode 래퍼, NUL 종료)
  */
 void bytes_to_hex(const unsigned char* bytes, size_t len, char* hex_string) {
-    for (size_t i = 0; i < len; i++) {
-        sprintf(hex_string + (i * 2), "%02x", bytes[i]);
-    }
+    hex_encode(bytes, len, hex_string);
+    hex_string[len * 2] = '\0';
 }
 
 /**
@@ -136,9 +97,9 @@ int create_directory(const char* path) {
         tmp[len - 1] = '\0';
     }
     
-    // 경로를 '\'로 표준화
+    // 경로 구분자를 플랫폼 기준으로 표준화
     for (p = tmp; *p; p++) {
-        if (*p == '/') *p = '\\';
+        if (*p == '/' || *p == '\\') *p = PATH_SEP;
     }
     
     // 경로가 이미 존재하는지 확인
@@ -148,23 +109,23 @@ int create_directory(const char* path) {
     
     // 부모 디렉토리 생성
     for (p = tmp + 1; *p; p++) {
-        if (*p == '\\') {
+        if (*p == PATH_SEP) {
             *p = '\0';  // 현재 위치까지의 경로 분리
             
             if (!file_exists(tmp)) {
-                int result = _mkdir(tmp);
+                int result = make_dir(tmp);
                 if (result != 0 && errno != EEXIST) {
                     return ERR_FILE_WRITE;
                 }
             }
             
-            *p = '\\';  // 원래 문자로 복원
+            *p = PATH_SEP;  // 원래 문자로 복원
         }
     }
     
     // 최종 디렉토리 생성
     if (!file_exists(tmp)) {
-        int result = _mkdir(tmp);
+        int result = make_dir(tmp);
         if (result != 0 && errno != EEXIST) {
             return ERR_FILE_WRITE;
         }
@@ -210,83 +171,75 @@ int extract_md_values(const char* filename, char md_values[][MAX_LINE_LENGTH], i
 }
 
 /**
- * 두 파일의 MD 값만 비교
- * @return 일치하면 0, 불일치하면 불일치 개수, 오류 발생 시 정의된 오류 코드
+ * 결과 파일과 정답 파일을 레코드 단위로 비교하고 다른 레코드를 출력
+ * @return 일치하면 0, 불일치하면 다른 레코드 수, 오류 발생 시 정의된 오류 코드
  */
 int compare_test_results(const char* output_file, const char* expected_file) {
-    FILE* out_file = fopen(output_file, "r");
-    if (out_file == NULL) {
-        return ERR_FILE_OPEN;
+    CompareReport report;
+    int ret = compare_vector_files(output_file, expected_file, &report);
+    if (ret != SUCCESS) {
+        return ret;
     }
-    
-    FILE* exp_file = fopen(expected_file, "r");
-    if (exp_file == NULL) {
-        fclose(out_file);
-        return ERR_FILE_OPEN;
+
+    int failures = (int)compare_report_failures(&report);
+    if (report.diff != NULL) {
+        fputs(report.diff, stdout);
     }
-    
-    char out_line[MAX_LINE_LENGTH];
-    char exp_line[MAX_LINE_LENGTH];
-    int md_count = 0;
-    int mismatch_count = 0;
-    
-    // 각 파일에서 라인별로 읽어가며 MD 값 비교
-    while (fgets(out_line, sizeof(out_line), out_file) != NULL) {
-        // 줄바꿈 문자 제거
-        size_t len = strlen(out_line);
-        if (len > 0 && out_line[len - 1] == '\n') {
-            out_line[len - 1] = '\0';
-        }
-        
-        // MD 값이 있는 줄만 처리
-        if (strncmp(out_line, "MD =", 4) == 0 || strncmp(out_line, "MD=", 3) == 0) {
-            // 정답 파일에서 다음 MD 값 찾기
-            bool found_md = false;
-            while (fgets(exp_line, sizeof(exp_line), exp_file) != NULL) {
-                // 줄바꿈 문자 제거
-                len = strlen(exp_line);
-                if (len > 0 && exp_line[len - 1] == '\n') {
-                    exp_line[len - 1] = '\0';
-                }
-                
-                if (strncmp(exp_line, "MD =", 4) == 0 || strncmp(exp_line, "MD=", 3) == 0) {
-                    found_md = true;
-                    break;
-                }
-            }
-            
-            if (!found_md) {
-                mismatch_count++;
-                break;
-            }
-            
-            md_count++;
-            
-            // MD 값 비교
-            if (strcmp(out_line, exp_line) != 0) {
-                mismatch_count++;
-            }
-        }
+    compare_report_free(&report);
+    return failures;
+}
+
+/**
+ * 단조 증가 시계 기준 현재 시간 (초)
+ */
+double get_time_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+int get_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+void get_cpu_model(char* buf, size_t size) {
+    snprintf(buf, size, "unknown");
+#ifdef _WIN32
+    const char* id = getenv("PROCESSOR_IDENTIFIER");
+    if (id != NULL) snprintf(buf, size, "%s", id);
+#else
+    FILE* fp = fopen("/proc/cpuinfo", "r");
+    if (fp == NULL) {
+        return;
     }
-    
-    // 정답 파일에 더 많은 MD 값이 있는지 확인
-    bool more_md = false;
-    while (fgets(exp_line, sizeof(exp_line), exp_file) != NULL) {
-        if (strncmp(exp_line, "MD =", 4) == 0 || strncmp(exp_line, "MD=", 3) == 0) {
-            more_md = true;
-            mismatch_count++;
+
+    char line[MAX_LINE_LENGTH];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        char* colon = strchr(line, ':');
+        if (strncmp(line, "model name", 10) == 0 && colon != NULL) {
+            colon++;
+            while (*colon == ' ') colon++;
+            colon[strcspn(colon, "\n")] = '\0';
+            snprintf(buf, size, "%s", colon);
             break;
         }
     }
-    
-    fclose(out_file);
-    fclose(exp_file);
-    
-    if (md_count == 0) {
-        return ERR_INVALID_FORMAT; // MD 값을 찾을 수 없음
-    }
-    
-    return mismatch_count; // 성공 시 불일치 개수 반환 (0이면 완전 일치)
+    fclose(fp);
+#endif
 }
 
 const char* get_filename_from_path(const char* path) {
@@ -0,0 +1,513 @@
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/vector_reader.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <pthread.h>
+#include <zlib.h>
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+/**
+ * 해제 버퍼로 예약하는 주소 공간 (해제한 내용의 크기 상한)
+ * 예약만 하고 실제 메모리는 조각 단위로 사용 준비하므로 멤버 수나 형식의 크기 정보와 무관하게
+ * 버퍼가 커질 수 있고, 주소가 바뀌지 않아 토큰 뷰가 계속 유효함
+ */
+#if SIZE_MAX > 0xFFFFFFFFu
+#define DECOMPRESS_RESERVE ((size_t)1 << 40)
+#else
+#define DECOMPRESS_RESERVE ((size_t)1 << 30)
+#endif
+
+// zlib 입력 한 번에 넘기는 최대 크기 (uInt 범위)
+#define ZLIB_MAX_INPUT (1u << 30)
+
+struct DecompressStream {
+    CompressionKind kind;
+    VectorReader input;          // 압축 파일 매핑
+    char* buf;                   // 예약한 해제 버퍼 (주소 고정)
+    size_t capacity;
+    size_t committed;            // 사용 준비한 앞부분 크기 (해제 스레드만 접근)
+    size_t input_dropped;        // 메모리를 반환한 압축 입력 앞부분 크기 (해제 스레드만 접근)
+    size_t available;            // 해제된 바이트 수 (lock 보호)
+    size_t released;             // 읽는 쪽이 놓아준 앞부분 크기 (lock 보호, 조각 단위)
+    size_t wanted;               // 읽는 쪽이 기다리는 크기 (lock 보호)
+    bool windowed;               // 읽는 쪽이 내용을 놓아주기 시작했는지 (lock 보호)
+    bool done;                   // 해제 종료 (lock 보호)
+    int error;
+    int stop;                    // 닫기 요청 (원자적 접근)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t thread;
+};
+
+CompressionKind compression_kind_for_path(const char* path) {
+    size_t len = path ? strlen(path) : 0;
+
+    if (len >= 3 && strcmp(path + len - 3, ".gz") == 0) {
+        return COMPRESSION_GZIP;
+    }
+    if (len >= 4 && strcmp(path + len - 4, ".zst") == 0) {
+        return COMPRESSION_ZSTD;
+    }
+    return COMPRESSION_NONE;
+}
+
+const char* compression_suffix(CompressionKind kind) {
+    switch (kind) {
+        case COMPRESSION_GZIP: return ".gz";
+        case COMPRESSION_ZSTD: return ".zst";
+        default: return "";
+    }
+}
+
+bool compression_supported(CompressionKind kind) {
+#ifdef HAVE_ZSTD
+    (void)kind;
+    return true;
+#else
+    return kind != COMPRESSION_ZSTD;
+#endif
+}
+
+/**
+ * 해제 버퍼 주소 공간 예약 (접근 불가 상태로 예약만 하므로 메모리를 차지하지 않음)
+ * 주소가 바뀌지 않아 읽는 쪽의 토큰 뷰가 해제 도중에도 유효함
+ */
+static char* reserve_buffer(size_t capacity) {
+#ifdef _WIN32
+    return (char*)VirtualAlloc(NULL, capacity, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* base = mmap(NULL, capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return base == MAP_FAILED ? NULL : (char*)base;
+#endif
+}
+
+// 예약 영역 중 [offset, offset + len) 사용 준비 (offset은 조각 단위)
+static bool commit_buffer(DecompressStream* s, size_t offset, size_t len) {
+#ifdef _WIN32
+    return VirtualAlloc(s->buf + offset, len, MEM_COMMIT, PAGE_READWRITE) != NULL;
+#else
+    return mprotect(s->buf + offset, len, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+// 다 읽은 [offset, offset + len)의 메모리 반환 (주소 공간은 그대로 두어 다시 쓰지 않음)
+static void discard_buffer(DecompressStream* s, size_t offset, size_t len) {
+#ifdef _WIN32
+    VirtualFree(s->buf + offset, len, MEM_DECOMMIT);
+#else
+    madvise(s->buf + offset, len, MADV_DONTNEED);
+#endif
+}
+
+static void release_buffer(char* buf, size_t capacity) {
+#ifdef _WIN32
+    (void)capacity;
+    VirtualFree(buf, 0, MEM_RELEASE);
+#else
+    munmap(buf, capacity);
+#endif
+}
+
+// 해제 진행 상황 공개
+static void publish(DecompressStream* s, size_t available, bool done) {
+    pthread_mutex_lock(&s->lock);
+    s->available = available;
+    s->done = done;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static bool stop_requested(DecompressStream* s) {
+    return __atomic_load_n(&s->stop, __ATOMIC_ACQUIRE) != 0;
+}
+
+// 다 읽은 압축 입력의 페이지 반환 (읽기 전용 파일 매핑이므로 다시 접근해도 파일에서 읽힘)
+static void release_input(DecompressStream* s, size_t consumed) {
+    size_t upto = consumed / DECOMPRESS_CHUNK * DECOMPRESS_CHUNK;
+    if (upto > s->input_dropped) {
+#ifndef _WIN32
+        madvise((void*)(s->input.data + s->input_dropped), upto - s->input_dropped, MADV_DONTNEED);
+#endif
+        s->input_dropped = upto;
+    }
+}
+
+/**
+ * 읽는 쪽이 내용을 놓아주기 시작했으면 놓아준 위치보다 DECOMPRESS_WINDOW 이상 앞서지 않도록 대기
+ * 읽는 쪽이 아직 풀리지 않은 내용을 기다리면 창과 관계없이 진행 (창보다 긴 줄도 막히지 않음)
+ */
+static void wait_for_window(DecompressStream* s, size_t produced) {
+    pthread_mutex_lock(&s->lock);
+    while (s->windowed && produced - s->released >= DECOMPRESS_WINDOW && s->wanted <= produced &&
+           !stop_requested(s)) {
+        pthread_cond_wait(&s->cond, &s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+// 다음 출력 조각 크기 (예약 영역이 가득 차면 0)
+static size_t next_chunk(DecompressStream* s, size_t produced) {
+    wait_for_window(s, produced);
+
+    size_t room = s->capacity - produced;
+    size_t n = room < DECOMPRESS_CHUNK ? room : DECOMPRESS_CHUNK;
+    while (n > 0 && s->committed < produced + n) {
+        if (!commit_buffer(s, s->committed, DECOMPRESS_CHUNK)) {
+            return 0;
+        }
+        s->committed += DECOMPRESS_CHUNK;
+    }
+    return n;
+}
+
+/**
+ * gzip 해제 (여러 멤버를 이어 붙인 파일 포함)
+ * @return SUCCESS 또는 ERR_FILE_READ(손상, 잘림, 크기 초과)
+ */
+static int inflate_gzip(DecompressStream* s) {
+    const uint8_t* in = (const uint8_t*)s->input.data;
+    size_t in_size = s->input.size;
+    size_t in_pos = 0;
+    size_t produced = 0;
+
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    if (inflateInit2(&z, 15 + 32) != Z_OK) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    int ret = SUCCESS;
+    while (!stop_requested(s)) {
+        if (z.avail_in == 0 && in_pos < in_size) {
+            size_t n = in_size - in_pos < ZLIB_MAX_INPUT ? in_size - in_pos : ZLIB_MAX_INPUT;
+            z.next_in = (Bytef*)(in + in_pos);
+            z.avail_in = (uInt)n;
+            in_pos += n;
+        }
+
+        size_t chunk = next_chunk(s, produced);
+        if (chunk == 0) {
+            ret = ERR_FILE_READ;
+            break;
+        }
+
+        z.next_out = (Bytef*)(s->buf + produced);
+        z.avail_out = (uInt)chunk;
+        int zr = inflate(&z, Z_NO_FLUSH);
+        produced += chunk - z.avail_out;
+        publish(s, produced, false);
+        release_input(s, in_pos - z.avail_in);
+
+        bool input_left = z.avail_in > 0 || in_pos < in_size;
+        if (zr == Z_STREAM_END) {
+            if (!input_left) break;
+            inflateReset(&z);
+        } else if (zr != Z_OK && !(zr == Z_BUF_ERROR && input_left)) {
+            ret = ERR_FILE_READ;
+            break;
+        }
+    }
+
+    inflateEnd(&z);
+    return ret;
+}
+
+#ifdef HAVE_ZSTD
+static int inflate_zstd(DecompressStream* s) {
+    ZSTD_DStream* d = ZSTD_createDStream();
+    if (d == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    ZSTD_inBuffer in = { s->input.data, s->input.size, 0 };
+    size_t produced = 0;
+    int ret = SUCCESS;
+
+    while (!stop_requested(s)) {
+        size_t chunk = next_chunk(s, produced);
+        if (chunk == 0) {
+            ret = ERR_FILE_READ;
+            break;
+        }
+
+        ZSTD_outBuffer out = { s->buf + produced, chunk, 0 };
+        size_t zr = ZSTD_decompressStream(d, &out, &in);
+        produced += out.pos;
+        publish(s, produced, false);
+        release_input(s, in.pos);
+
+        if (ZSTD_isError(zr)) {
+            ret = ERR_FILE_READ;
+            break;
+        }
+        if (in.pos == in.size && out.pos < chunk) {
+            // 입력을 다 썼는데 프레임이 끝나지 않았으면 잘린 파일
+            ret = zr == 0 ? SUCCESS : ERR_FILE_READ;
+            break;
+        }
+    }
+
+    ZSTD_freeDStream(d);
+    return ret;
+}
+#endif
+
+static void* decompress_main(void* arg) {
+    DecompressStream* s = (DecompressStream*)arg;
+    int ret = ERR_NOT_IMPLEMENTED;
+
+    if (s->kind == COMPRESSION_GZIP) {
+        ret = inflate_gzip(s);
+    }
+#ifdef HAVE_ZSTD
+    if (s->kind == COMPRESSION_ZSTD) {
+        ret = inflate_zstd(s);
+    }
+#endif
+
+    pthread_mutex_lock(&s->lock);
+    s->error = ret;
+    s->done = true;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+int decompress_stream_start(DecompressStream** stream, const char* path, CompressionKind kind) {
+    *stream = NULL;
+    if (kind == COMPRESSION_NONE || !compression_supported(kind)) {
+        return ERR_NOT_IMPLEMENTED;
+    }
+
+    DecompressStream* s = (DecompressStream*)calloc(1, sizeof(DecompressStream));
+    if (s == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+    s->kind = kind;
+
+    int ret = vector_reader_open_raw(&s->input, path);
+    if (ret != SUCCESS) {
+        free(s);
+        return ret;
+    }
+
+    s->capacity = DECOMPRESS_RESERVE;
+    s->buf = reserve_buffer(s->capacity);
+    if (s->buf == NULL) {
+        vector_reader_close(&s->input);
+        free(s);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->cond, NULL);
+    if (pthread_create(&s->thread, NULL, decompress_main, s) != 0) {
+        pthread_cond_destroy(&s->cond);
+        pthread_mutex_destroy(&s->lock);
+        release_buffer(s->buf, s->capacity);
+        vector_reader_close(&s->input);
+        free(s);
+        return ERR_SYSTEM_MEMORY;
+    }
+
+    *stream = s;
+    return SUCCESS;
+}
+
+const char* decompress_stream_data(const DecompressStream* stream) {
+    return stream->buf;
+}
+
+size_t decompress_stream_wait(DecompressStream* stream, size_t min_available, bool* done) {
+    pthread_mutex_lock(&stream->lock);
+    if (min_available > stream->wanted) {
+        stream->wanted = min_available;
+        pthread_cond_broadcast(&stream->cond);
+    }
+    while (!stream->done && stream->available < min_available) {
+        pthread_cond_wait(&stream->cond, &stream->lock);
+    }
+    size_t available = stream->available;
+    *done = stream->done;
+    pthread_mutex_unlock(&stream->lock);
+    return available;
+}
+
+void decompress_stream_release(DecompressStream* stream, size_t offset) {
+    pthread_mutex_lock(&stream->lock);
+    if (offset > stream->available) {
+        offset = stream->available;
+    }
+    size_t upto = offset / DECOMPRESS_CHUNK * DECOMPRESS_CHUNK;
+    if (upto > stream->released) {
+        discard_buffer(stream, stream->released, upto - stream->released);
+        stream->released = upto;
+        stream->windowed = true;
+        pthread_cond_broadcast(&stream->cond);
+    }
+    pthread_mutex_unlock(&stream->lock);
+}
+
+int decompress_stream_error(DecompressStream* stream) {
+    pthread_mutex_lock(&stream->lock);
+    int error = stream->done ? stream->error : SUCCESS;
+    pthread_mutex_unlock(&stream->lock);
+    return error;
+}
+
+void decompress_stream_close(DecompressStream* stream) {
+    if (stream == NULL) {
+        return;
+    }
+
+    // 창이 차서 기다리는 해제 스레드도 깨움
+    pthread_mutex_lock(&stream->lock);
+    __atomic_store_n(&stream->stop, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&stream->cond);
+    pthread_mutex_unlock(&stream->lock);
+    pthread_join(stream->thread, NULL);
+    pthread_cond_destroy(&stream->cond);
+    pthread_mutex_destroy(&stream->lock);
+    release_buffer(stream->buf, stream->capacity);
+    vector_reader_close(&stream->input);
+    free(stream);
+}
+
+/**
+ * 압축기 초기화
+ * 출력이 계산 단계를 막지 않도록 gzip은 가장 빠른 단계를 사용
+ */
+int compress_sink_init(CompressSink* sink, CompressionKind kind) {
+    memset(sink, 0, sizeof(*sink));
+    if (kind == COMPRESSION_NONE || !compression_supported(kind)) {
+        return ERR_NOT_IMPLEMENTED;
+    }
+
+    sink->kind = kind;
+    sink->out = (uint8_t*)malloc(COMPRESS_OUT_SIZE);
+    if (sink->out == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    if (kind == COMPRESSION_GZIP) {
+        z_stream* z = (z_stream*)calloc(1, sizeof(z_stream));
+        if (z == NULL || deflateInit2(z, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            free(z);
+            compress_sink_free(sink);
+            return ERR_MEMORY_ALLOC;
+        }
+        sink->state = z;
+    }
+#ifdef HAVE_ZSTD
+    if (kind == COMPRESSION_ZSTD) {
+        ZSTD_CStream* c = ZSTD_createCStream();
+        if (c == NULL || ZSTD_isError(ZSTD_initCStream(c, ZSTD_CLEVEL_DEFAULT))) {
+            ZSTD_freeCStream(c);
+            compress_sink_free(sink);
+            return ERR_MEMORY_ALLOC;
+        }
+        sink->state = c;
+    }
+#endif
+    return SUCCESS;
+}
+
+static int deflate_write(CompressSink* sink, const void* data, size_t len, bool finish,
+                         CompressEmitFn emit, void* ctx) {
+    z_stream* z = (z_stream*)sink->state;
+    const uint8_t* in = (const uint8_t*)data;
+
+    for (;;) {
+        size_t n = len < ZLIB_MAX_INPUT ? len : ZLIB_MAX_INPUT;
+        z->next_in = (Bytef*)in;
+        z->avail_in = (uInt)n;
+        in += n;
+        len -= n;
+
+        int flush = finish && len == 0 ? Z_FINISH : Z_NO_FLUSH;
+        int zr;
+        do {
+            z->next_out = sink->out;
+            z->avail_out = COMPRESS_OUT_SIZE;
+            zr = deflate(z, flush);
+            if (zr == Z_STREAM_ERROR) {
+                return ERR_FILE_WRITE;
+            }
+
+            size_t produced = COMPRESS_OUT_SIZE - z->avail_out;
+            int ret = produced > 0 ? emit(ctx, sink->out, produced) : SUCCESS;
+            if (ret != SUCCESS) {
+                return ret;
+            }
+        } while (z->avail_out == 0 || (flush == Z_FINISH && zr != Z_STREAM_END));
+
+        if (len == 0) {
+            return SUCCESS;
+        }
+    }
+}
+
+#ifdef HAVE_ZSTD
+static int zstd_write(CompressSink* sink, const void* data, size_t len, bool finish,
+                      CompressEmitFn emit, void* ctx) {
+    ZSTD_inBuffer in = { data, len, 0 };
+    ZSTD_EndDirective mode = finish ? ZSTD_e_end : ZSTD_e_continue;
+
+    for (;;) {
+        ZSTD_outBuffer out = { sink->out, COMPRESS_OUT_SIZE, 0 };
+        size_t remaining = ZSTD_compressStream2((ZSTD_CStream*)sink->state, &out, &in, mode);
+        if (ZSTD_isError(remaining)) {
+            return ERR_FILE_WRITE;
+        }
+
+        int ret = out.pos > 0 ? emit(ctx, sink->out, out.pos) : SUCCESS;
+        if (ret != SUCCESS) {
+            return ret;
+        }
+        if (in.pos == in.size && (finish ? remaining == 0 : out.pos < out.size)) {
+            return SUCCESS;
+        }
+    }
+}
+#endif
+
+int compress_sink_write(CompressSink* sink, const void* data, size_t len, bool finish,
+                        CompressEmitFn emit, void* ctx) {
+    if (sink->kind == COMPRESSION_GZIP) {
+        return deflate_write(sink, data, len, finish, emit, ctx);
+    }
+#ifdef HAVE_ZSTD
+    if (sink->kind == COMPRESSION_ZSTD) {
+        return zstd_write(sink, data, len, finish, emit, ctx);
+    }
+#endif
+    return ERR_NOT_IMPLEMENTED;
+}
+
+void compress_sink_free(CompressSink* sink) {
+    if (sink == NULL) {
+        return;
+    }
+
+    if (sink->kind == COMPRESSION_GZIP && sink->state != NULL) {
+        deflateEnd((z_stream*)sink->state);
+        free(sink->state);
+    }
+#ifdef HAVE_ZSTD
+    if (sink->kind == COMPRESSION_ZSTD) {
+        ZSTD_freeCStream((ZSTD_CStream*)sink->state);
+    }
+#endif
+
+    free(sink->out);
+    memset(sink, 0, sizeof(*sink));
+}
@@ -0,0 +1,59 @@
+#include "../../include/common/cpu_features.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define CPU_FEATURES_X86 1
+#endif
+
+static CpuFeatures g_features;
+static bool g_detected = false;
+
+#ifdef CPU_FEATURES_X86
+static unsigned int read_xcr0(void) {
+    unsigned int lo, hi;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return lo;
+}
+#endif
+
+/**
+ * CPUID 검사
+ * AVX2/AVX-512는 OS가 YMM/ZMM 상태를 저장하는지(XGETBV)까지 확인
+ */
+static void detect_cpu_features(CpuFeatures* f) {
+    memset(f, 0, sizeof(*f));
+
+#ifdef CPU_FEATURES_X86
+    unsigned int eax, ebx, ecx, edx;
+    bool osxsave = false;
+    unsigned int xcr0 = 0;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        f->ssse3 = (ecx & bit_SSSE3) != 0;
+        f->sse41 = (ecx & bit_SSE4_1) != 0;
+        f->aesni = (ecx & bit_AES) != 0;
+        f->pclmul = (ecx & bit_PCLMUL) != 0;
+        osxsave = (ecx & bit_OSXSAVE) != 0;
+    }
+
+    if (osxsave) {
+        xcr0 = read_xcr0();
+    }
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        f->sha = (ebx & bit_SHA) != 0;
+        f->bmi2 = (ebx & bit_BMI2) != 0;
+        f->avx2 = (ebx & bit_AVX2) != 0 && (xcr0 & 0x6) == 0x6;
+        f->avx512f = (ebx & bit_AVX512F) != 0 && (xcr0 & 0xE6) == 0xE6;
+    }
+#endif
+}
+
+const CpuFeatures* get_cpu_features(void) {
+    if (!g_detected) {
+        detect_cpu_features(&g_features);
+        g_detected = true;
+    }
+    return &g_features;
+}
@@ -0,0 +1,32 @@
+#include "../../include/common/cycle_timer.h"
+#include "../../include/common/common.h"
+
+// 보정 구간 (초)
+#define CYCLE_TIMER_CALIBRATION 0.02
+
+static double g_ticks_per_ns = 0;
+
+double cycle_timer_ticks_per_ns(void) {
+    double cached;
+    __atomic_load(&g_ticks_per_ns, &cached, __ATOMIC_ACQUIRE);
+    if (cached > 0) {
+        return cached;
+    }
+
+#ifdef CYCLE_TIMER_TSC
+    double start = get_time_seconds();
+    uint64_t t0 = cycle_timer_now();
+    double elapsed;
+    do {
+        elapsed = get_time_seconds() - start;
+    } while (elapsed < CYCLE_TIMER_CALIBRATION);
+    uint64_t t1 = cycle_timer_now();
+    double ratio = (double)(t1 - t0) / (elapsed * 1e9);
+#else
+    double ratio = 1.0;
+#endif
+
+    // 여러 스레드가 동시에 보정해도 결과는 거의 같으므로 마지막 값을 사용
+    __atomic_store(&g_ticks_per_ns, &ratio, __ATOMIC_RELEASE);
+    return ratio;
+}
@@ -3,6 +3,17 @@
 #include "../../include/common/common.h"
 #include "../../include/common/error.h"
 #include "../../include/algorithm/sha256.h"
+#include "../../include/algorithm/sha256_native.h"
+#include "../../include/algorithm/sha256_mb.h"
+#include "../../include/algorithm/cmac_128.h"
+#include "../../include/algorithm/cmac_128_native.h"
+#include "../../include/algorithm/hmac_sha256.h"
+#include "../../include/algorithm/hmac_sha256_native.h"
+#include "../../include/common/cpu_features.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/perf_counters.h"
+#include "../../include/common/compressed_io.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -64,10 +75,28 @@ int run_auto_test(int algo_id, int test_type_id) {
            algo->name, algo->test_types[test_type_id]);
     
     // 알고리즘별 적절한 함수 호출
-    if (strcmp(algo->name, "SHA-256") == 0) {
+    // SHA-256 계열 (EVP, 네이티브 백엔드)
+    if (strncmp(algo->name, "SHA-256", 7) == 0) {
+        sha256_set_backend(algo->ops.hash.hash_function, algo->ops.hash.hash_init,
+                           algo->ops.hash.hash_update, algo->ops.hash.hash_final);
+        perf_profile_set_label(algo->name);
         return sha256_run_auto_test(test_type_id);
     }
     
+    // CMAC-AES128 계열 (EVP, 네이티브 백엔드)
+    if (strncmp(algo->name, "CMAC-AES128", 11) == 0) {
+        cmac128_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return cmac128_run_auto_test(test_type_id);
+    }
+    
+    // HMAC-SHA256 계열 (EVP, 네이티브 백엔드)
+    if (strncmp(algo->name, "HMAC-SHA256", 11) == 0) {
+        hmac_sha256_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return hmac_sha256_run_auto_test(test_type_id);
+    }
+    
     return ERR_NOT_IMPLEMENTED;
 }
 
@@ -80,9 +109,146 @@ int run_manual_test(int algo_id, int input_type_id) {
            algo->name, algo->input_types[input_type_id]);
     
     // 알고리즘별 적절한 함수 호출
-    if (strcmp(algo->name, "SHA-256") == 0) {
+    if (strncmp(algo->name, "SHA-256", 7) == 0) {
+        sha256_set_backend(algo->ops.hash.hash_function, algo->ops.hash.hash_init,
+                           algo->ops.hash.hash_update, algo->ops.hash.hash_final);
+        perf_profile_set_label(algo->name);
         return sha256_run_manual_test(input_type_id);
     }
     
+    if (strncmp(algo->name, "CMAC-AES128", 11) == 0) {
+        cmac128_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return cmac128_run_manual_test(input_type_id);
+    }
+    
+    if (strncmp(algo->name, "HMAC-SHA256", 11) == 0) {
+        hmac_sha256_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return hmac_sha256_run_manual_test(input_type_id);
+    }
+    
+    return ERR_NOT_IMPLEMENTED;
+} 
+
+/**
+ * 요청 파일 하나를 실행해 응답 파일 생성 (배치 실행용)
+ * 백엔드 설정이 스레드별이므로 여러 작업 스레드에서 동시에 호출 가능
+ */
+int run_vector_file(int algo_id, const char* input_path, const char* output_path) {
+    AlgorithmConfig* algo = get_algorithm_by_id(algo_id);
+    if (!algo) return ERR_INVALID_ALGORITHM;
+    
+    if (strncmp(algo->name, "SHA-256", 7) == 0) {
+        sha256_set_backend(algo->ops.hash.hash_function, algo->ops.hash.hash_init,
+                           algo->ops.hash.hash_update, algo->ops.hash.hash_final);
+        perf_profile_set_label(algo->name);
+        if (sha256_detect_test_type(get_filename_from_path(input_path)) == TEST_MONTE_CARLO) {
+            return sha256_monte(input_path, output_path);
+        }
+        return sha256_test(input_path, output_path);
+    }
+    
+    // CMACGen/CMACVer는 레코드에 Mac이 있는지로 구분하므로 같은 실행 함수 사용
+    if (strncmp(algo->name, "CMAC-AES128", 11) == 0) {
+        cmac128_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return cmac128_test(input_path, output_path);
+    }
+    
+    if (strncmp(algo->name, "HMAC-SHA256", 11) == 0) {
+        hmac_sha256_set_backend(algo->ops.mac.mac_function, algo->ops.mac.mac_verify);
+        perf_profile_set_label(algo->name);
+        return hmac_sha256_test(input_path, output_path);
+    }
+    
     return ERR_NOT_IMPLEMENTED;
-} 
\ No newline at end of file
+}
+
+// 몬테 카를로 응답 경로: 확장자(.req와 압축 접미사)를 뗀 이름 + .rsp + 요청과 같은 압축 접미사
+static bool monte_output_path(const char* input_path, const char* output_dir, char* buf, size_t size) {
+    const char* name = get_filename_from_path(input_path);
+    const char* compressed = compression_suffix(compression_kind_for_path(input_path));
+    size_t stem_len = strlen(name) - strlen(compressed);
+    if (stem_len >= 4 && strncmp(name + stem_len - 4, ".req", 4) == 0) {
+        stem_len -= 4;
+    }
+
+    int dir_len = output_dir ? (int)strlen(output_dir) : (int)(name - input_path);
+    const char* dir = output_dir ? output_dir : input_path;
+    const char* sep = (output_dir && dir_len > 0 && output_dir[dir_len - 1] != '/') ? "/" : "";
+    int n = snprintf(buf, size, "%.*s%s%.*s.rsp%s", dir_len, dir, sep, (int)stem_len, name, compressed);
+    return n > 0 && (size_t)n < size;
+}
+
+int run_monte_files(const char* const input_paths[], size_t count, const char* output_dir) {
+    if (input_paths == NULL || count == 0) {
+        return ERR_INVALID_INPUT;
+    }
+
+    char (*paths)[MAX_PATH_LENGTH] = malloc(count * sizeof(*paths));
+    const char** outputs = (const char**)malloc(count * sizeof(const char*));
+    if (paths == NULL || outputs == NULL) {
+        free(paths);
+        free(outputs);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    int ret = SUCCESS;
+    for (size_t i = 0; i < count && ret == SUCCESS; i++) {
+        if (!monte_output_path(input_paths[i], output_dir, paths[i], sizeof(paths[i]))) {
+            ret = ERR_INVALID_INPUT;
+        }
+        outputs[i] = paths[i];
+    }
+    if (ret == SUCCESS && output_dir != NULL) {
+        create_directory(output_dir);
+    }
+
+    if (ret == SUCCESS) {
+        perf_profile_set_label("SHA-256-MONTE");
+        ret = sha256_monte_multi(input_paths, outputs, count);
+    }
+    if (ret == SUCCESS) {
+        for (size_t i = 0; i < count; i++) {
+            printf("%s -> %s\n", input_paths[i], outputs[i]);
+        }
+    }
+
+    free(paths);
+    free(outputs);
+    return ret;
+}
+
+int describe_algorithm_backend(int algo_id, char* buf, size_t size) {
+    AlgorithmConfig* algo = get_algorithm_by_id(algo_id);
+    if (!algo) return ERR_INVALID_ALGORITHM;
+
+    int n;
+    if (strncmp(algo->name, "SHA-256", 7) == 0) {
+        n = snprintf(buf, size, "%s native=%s mb=%s/%zu hex=%s", algo->name, sha256_native_impl_name(),
+                     sha256_mb_impl_name(), sha256_mb_lanes(), hex_codec_impl_name());
+    } else if (strncmp(algo->name, "CMAC-AES128", 11) == 0) {
+        n = snprintf(buf, size, "%s native=%s key_cache=%d lanes=%zu hex=%s", algo->name,
+                     cmac128_native_impl_name(), CMAC128_KEY_CACHE_SLOTS, cmac128_mb_lanes(), hex_codec_impl_name());
+    } else if (strncmp(algo->name, "HMAC-SHA256", 11) == 0) {
+        n = snprintf(buf, size, "%s native=%s key_cache=%d hex=%s", algo->name, sha256_native_impl_name(),
+                     HMAC_SHA256_KEY_CACHE_SLOTS, hex_codec_impl_name());
+    } else {
+        n = snprintf(buf, size, "%s", algo->name);
+    }
+    return (n > 0 && (size_t)n < size) ? SUCCESS : ERR_INVALID_INPUT;
+}
+
+// 작업 스레드 시작 전에 CPU 기능 감지와 구현 선택, EVP 객체 가져오기를 끝냄
+void prepare_algorithms_for_threads(void) {
+    get_cpu_features();
+    hex_codec_impl_name();
+    sha256_native_impl_name();
+    sha256_mb_lanes();
+    evp_cache_md(EVP_CACHE_MD_SHA256);
+    cmac128_native_impl_name();
+    cmac128_mb_lanes();
+    evp_cache_mac(EVP_CACHE_MAC_CMAC);
+    evp_cache_mac(EVP_CACHE_MAC_HMAC);
+}
@@ -59,6 +59,8 @@ const char* get_error_message(int error_code) {
             return "암호화 연산에 실패했습니다";
         case ERR_CRYPTO_INIT:
             return "암호화 라이브러리 초기화에 실패했습니다";
+        case ERR_MAC_VERIFY:
+            return "MAC 태그가 일치하지 않습니다";
             
         // SHA-256 관련 에러 (150번대)
         case ERR_SHA256_INIT:
@@ -87,6 +89,8 @@ const char* get_error_message(int error_code) {
             return "최대 지원 알고리즘 수를 초과했습니다";
         case ERR_NOT_IMPLEMENTED:
             return "아직 구현되지 않은 기능입니다";
+        case ERR_NOT_SUPPORTED:
+            return "이 환경에서 지원하지 않는 기능입니다";
             
         default:
             return "알 수 없는 오류가 발생했습니다";
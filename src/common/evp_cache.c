@@ -0,0 +1,200 @@
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/common.h"
+
+// 스레드별 풀 크기 (동시에 열어 두는 스트리밍 컨텍스트 수)
+#define EVP_CACHE_POOL_SIZE 4
+
+// 가져올 알고리즘 이름
+static const char* const MD_NAMES[EVP_CACHE_MD_COUNT] = { "SHA2-256" };
+static const char* const MAC_NAMES[EVP_CACHE_MAC_COUNT] = { "CMAC", "HMAC" };
+static const char* const CIPHER_NAMES[EVP_CACHE_CIPHER_COUNT] = { "AES-128-ECB", "AES-128-CBC" };
+
+// 전역 알고리즘 객체 (경쟁 시 먼저 저장한 쪽을 쓰고 나머지는 해제)
+static EVP_MD* g_mds[EVP_CACHE_MD_COUNT];
+static EVP_MAC* g_macs[EVP_CACHE_MAC_COUNT];
+static EVP_CIPHER* g_ciphers[EVP_CACHE_CIPHER_COUNT];
+
+// 스레드별 컨텍스트
+static THREAD_LOCAL EVP_MD_CTX* t_md_scratch;
+static THREAD_LOCAL EVP_MD_CTX* t_md_pool[EVP_CACHE_POOL_SIZE];
+static THREAD_LOCAL size_t t_md_pool_count;
+static THREAD_LOCAL EVP_MAC_CTX* t_mac_pool[EVP_CACHE_MAC_COUNT][EVP_CACHE_POOL_SIZE];
+static THREAD_LOCAL size_t t_mac_pool_count[EVP_CACHE_MAC_COUNT];
+static THREAD_LOCAL EVP_CIPHER_CTX* t_cipher_pool[EVP_CACHE_POOL_SIZE];
+static THREAD_LOCAL size_t t_cipher_pool_count;
+
+// 포인터 슬롯에 한 번만 저장 (이미 있으면 기존 값 반환)
+static void* publish_once(void** slot, void* fresh) {
+    void* expected = NULL;
+    if (__atomic_compare_exchange_n(slot, &expected, fresh, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return fresh;
+    }
+    return expected;
+}
+
+const EVP_MD* evp_cache_md(EvpCacheMdId id) {
+    if ((unsigned)id >= EVP_CACHE_MD_COUNT) {
+        return NULL;
+    }
+
+    EVP_MD* md = __atomic_load_n(&g_mds[id], __ATOMIC_ACQUIRE);
+    if (md != NULL) {
+        return md;
+    }
+
+    EVP_MD* fresh = EVP_MD_fetch(NULL, MD_NAMES[id], NULL);
+    if (fresh == NULL) {
+        return NULL;
+    }
+
+    md = (EVP_MD*)publish_once((void**)&g_mds[id], fresh);
+    if (md != fresh) {
+        EVP_MD_free(fresh);
+    }
+    return md;
+}
+
+EVP_MAC* evp_cache_mac(EvpCacheMacId id) {
+    if ((unsigned)id >= EVP_CACHE_MAC_COUNT) {
+        return NULL;
+    }
+
+    EVP_MAC* mac = __atomic_load_n(&g_macs[id], __ATOMIC_ACQUIRE);
+    if (mac != NULL) {
+        return mac;
+    }
+
+    EVP_MAC* fresh = EVP_MAC_fetch(NULL, MAC_NAMES[id], NULL);
+    if (fresh == NULL) {
+        return NULL;
+    }
+
+    mac = (EVP_MAC*)publish_once((void**)&g_macs[id], fresh);
+    if (mac != fresh) {
+        EVP_MAC_free(fresh);
+    }
+    return mac;
+}
+
+const EVP_CIPHER* evp_cache_cipher(EvpCacheCipherId id) {
+    if ((unsigned)id >= EVP_CACHE_CIPHER_COUNT) {
+        return NULL;
+    }
+
+    EVP_CIPHER* cipher = __atomic_load_n(&g_ciphers[id], __ATOMIC_ACQUIRE);
+    if (cipher != NULL) {
+        return cipher;
+    }
+
+    EVP_CIPHER* fresh = EVP_CIPHER_fetch(NULL, CIPHER_NAMES[id], NULL);
+    if (fresh == NULL) {
+        return NULL;
+    }
+
+    cipher = (EVP_CIPHER*)publish_once((void**)&g_ciphers[id], fresh);
+    if (cipher != fresh) {
+        EVP_CIPHER_free(fresh);
+    }
+    return cipher;
+}
+
+EVP_MD_CTX* evp_cache_md_ctx(void) {
+    if (t_md_scratch == NULL) {
+        t_md_scratch = EVP_MD_CTX_new();
+    }
+    return t_md_scratch;
+}
+
+EVP_MD_CTX* evp_cache_md_ctx_acquire(void) {
+    if (t_md_pool_count > 0) {
+        return t_md_pool[--t_md_pool_count];
+    }
+    return EVP_MD_CTX_new();
+}
+
+void evp_cache_md_ctx_release(EVP_MD_CTX* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+    if (t_md_pool_count < EVP_CACHE_POOL_SIZE) {
+        t_md_pool[t_md_pool_count++] = ctx;
+        return;
+    }
+    EVP_MD_CTX_free(ctx);
+}
+
+/**
+ * MAC 컨텍스트 빌리기
+ * 풀에서 꺼낸 컨텍스트는 이전 키가 남아 있으므로 호출자가 EVP_MAC_init으로 키를 다시 설정
+ */
+EVP_MAC_CTX* evp_cache_mac_ctx_acquire(EvpCacheMacId id) {
+    if ((unsigned)id >= EVP_CACHE_MAC_COUNT) {
+        return NULL;
+    }
+    if (t_mac_pool_count[id] > 0) {
+        return t_mac_pool[id][--t_mac_pool_count[id]];
+    }
+
+    EVP_MAC* mac = evp_cache_mac(id);
+    return mac ? EVP_MAC_CTX_new(mac) : NULL;
+}
+
+void evp_cache_mac_ctx_release(EvpCacheMacId id, EVP_MAC_CTX* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+    if ((unsigned)id < EVP_CACHE_MAC_COUNT && t_mac_pool_count[id] < EVP_CACHE_POOL_SIZE) {
+        t_mac_pool[id][t_mac_pool_count[id]++] = ctx;
+        return;
+    }
+    EVP_MAC_CTX_free(ctx);
+}
+
+EVP_CIPHER_CTX* evp_cache_cipher_ctx_acquire(void) {
+    if (t_cipher_pool_count > 0) {
+        return t_cipher_pool[--t_cipher_pool_count];
+    }
+    return EVP_CIPHER_CTX_new();
+}
+
+void evp_cache_cipher_ctx_release(EVP_CIPHER_CTX* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+    if (t_cipher_pool_count < EVP_CACHE_POOL_SIZE) {
+        t_cipher_pool[t_cipher_pool_count++] = ctx;
+        return;
+    }
+    EVP_CIPHER_CTX_free(ctx);
+}
+
+void evp_cache_thread_cleanup(void) {
+    EVP_MD_CTX_free(t_md_scratch);
+    t_md_scratch = NULL;
+
+    while (t_md_pool_count > 0) {
+        EVP_MD_CTX_free(t_md_pool[--t_md_pool_count]);
+    }
+    for (int id = 0; id < EVP_CACHE_MAC_COUNT; id++) {
+        while (t_mac_pool_count[id] > 0) {
+            EVP_MAC_CTX_free(t_mac_pool[id][--t_mac_pool_count[id]]);
+        }
+    }
+    while (t_cipher_pool_count > 0) {
+        EVP_CIPHER_CTX_free(t_cipher_pool[--t_cipher_pool_count]);
+    }
+}
+
+void evp_cache_cleanup(void) {
+    evp_cache_thread_cleanup();
+
+    for (int i = 0; i < EVP_CACHE_MD_COUNT; i++) {
+        EVP_MD_free(__atomic_exchange_n(&g_mds[i], NULL, __ATOMIC_ACQ_REL));
+    }
+    for (int i = 0; i < EVP_CACHE_MAC_COUNT; i++) {
+        EVP_MAC_free(__atomic_exchange_n(&g_macs[i], NULL, __ATOMIC_ACQ_REL));
+    }
+    for (int i = 0; i < EVP_CACHE_CIPHER_COUNT; i++) {
+        EVP_CIPHER_free(__atomic_exchange_n(&g_ciphers[i], NULL, __ATOMIC_ACQ_REL));
+    }
+}
@@ -0,0 +1,301 @@
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/cpu_features.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HEX_CODEC_X86 1
+#endif
+
+static const char HEX_DIGITS[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+// 문자 -> 니블 값 테이블 (잘못된 문자는 0xFF)
+static const uint8_t HEX_VALUE[256] = {
+    ['0'] = 0x00, ['1'] = 0x01, ['2'] = 0x02, ['3'] = 0x03, ['4'] = 0x04,
+    ['5'] = 0x05, ['6'] = 0x06, ['7'] = 0x07, ['8'] = 0x08, ['9'] = 0x09,
+    ['a'] = 0x0a, ['b'] = 0x0b, ['c'] = 0x0c, ['d'] = 0x0d, ['e'] = 0x0e, ['f'] = 0x0f,
+    ['A'] = 0x0a, ['B'] = 0x0b, ['C'] = 0x0c, ['D'] = 0x0d, ['E'] = 0x0e, ['F'] = 0x0f,
+};
+
+// '0'(값 0)과 미지정 항목(0)을 구분하기 위한 유효 문자 테이블
+static const uint8_t HEX_VALID[256] = {
+    ['0'] = 1, ['1'] = 1, ['2'] = 1, ['3'] = 1, ['4'] = 1, ['5'] = 1, ['6'] = 1, ['7'] = 1,
+    ['8'] = 1, ['9'] = 1, ['a'] = 1, ['b'] = 1, ['c'] = 1, ['d'] = 1, ['e'] = 1, ['f'] = 1,
+    ['A'] = 1, ['B'] = 1, ['C'] = 1, ['D'] = 1, ['E'] = 1, ['F'] = 1,
+};
+
+/**
+ * 짝수 길이 16진수 디코딩 (스칼라, 테이블 기반)
+ * @return 성공 시 true
+ */
+static bool decode_pairs_scalar(const char* hex, size_t pairs, uint8_t* out) {
+    const unsigned char* p = (const unsigned char*)hex;
+    uint8_t valid = 1;
+
+    for (size_t i = 0; i < pairs; i++) {
+        unsigned char hi = p[2 * i], lo = p[2 * i + 1];
+        valid &= HEX_VALID[hi] & HEX_VALID[lo];
+        out[i] = (uint8_t)((HEX_VALUE[hi] << 4) | HEX_VALUE[lo]);
+    }
+    return valid != 0;
+}
+
+static void encode_scalar(const uint8_t* bytes, size_t len, char* hex) {
+    for (size_t i = 0; i < len; i++) {
+        hex[2 * i] = HEX_DIGITS[bytes[i] >> 4];
+        hex[2 * i + 1] = HEX_DIGITS[bytes[i] & 0x0f];
+    }
+}
+
+#ifdef HEX_CODEC_X86
+/**
+ * SSSE3 디코딩: 16문자 -> 8바이트
+ * 숫자는 c-'0' <= 9, 영문자는 (c|0x20)-'a' <= 5로 검증하고
+ * maddubs로 (상위*16 + 하위) 쌍을 합친 뒤 packus로 바이트화
+ */
+__attribute__((target("ssse3,sse4.1")))
+static bool decode_pairs_ssse3(const char* hex, size_t pairs, uint8_t* out) {
+    const __m128i c0 = _mm_set1_epi8('0');
+    const __m128i ca = _mm_set1_epi8('a');
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i five = _mm_set1_epi8(5);
+    const __m128i ten = _mm_set1_epi8(10);
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+
+    for (; i + 8 <= pairs; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(hex + 2 * i));
+        __m128i digit = _mm_sub_epi8(v, c0);
+        __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, lower), ca);
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+        __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, five), alpha);
+
+        if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF) {
+            return false;
+        }
+
+        __m128i val = _mm_blendv_epi8(_mm_add_epi8(alpha, ten), digit, is_digit);
+        __m128i words = _mm_maddubs_epi16(val, weights);
+        _mm_storel_epi64((__m128i*)(out + i), _mm_packus_epi16(words, words));
+    }
+
+    return decode_pairs_scalar(hex + 2 * i, pairs - i, out + i);
+}
+
+/**
+ * AVX2 디코딩: 32문자 -> 16바이트
+ */
+__attribute__((target("avx2")))
+static bool decode_pairs_avx2(const char* hex, size_t pairs, uint8_t* out) {
+    const __m256i c0 = _mm256_set1_epi8('0');
+    const __m256i ca = _mm256_set1_epi8('a');
+    const __m256i lower = _mm256_set1_epi8(0x20);
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i five = _mm256_set1_epi8(5);
+    const __m256i ten = _mm256_set1_epi8(10);
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+
+    for (; i + 16 <= pairs; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(hex + 2 * i));
+        __m256i digit = _mm256_sub_epi8(v, c0);
+        __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(v, lower), ca);
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+        __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, five), alpha);
+
+        if ((uint32_t)_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != 0xFFFFFFFFu) {
+            return false;
+        }
+
+        __m256i val = _mm256_blendv_epi8(_mm256_add_epi8(alpha, ten), digit, is_digit);
+        __m256i words = _mm256_maddubs_epi16(val, weights);
+        // packus는 128비트 레인별로 동작하므로 0, 2번 쿼드워드를 모음
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(words, words), 0x08);
+        _mm_storeu_si128((__m128i*)(out + i), _mm256_castsi256_si128(packed));
+    }
+
+    return decode_pairs_ssse3(hex + 2 * i, pairs - i, out + i);
+}
+
+/**
+ * SSSE3 인코딩: 16바이트 -> 32문자
+ */
+__attribute__((target("ssse3")))
+static void encode_ssse3(const uint8_t* bytes, size_t len, char* hex) {
+    const __m128i lut = _mm_loadu_si128((const __m128i*)HEX_DIGITS);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(bytes + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        __m128i lo = _mm_and_si128(v, mask);
+        _mm_storeu_si128((__m128i*)(hex + 2 * i), _mm_shuffle_epi8(lut, _mm_unpacklo_epi8(hi, lo)));
+        _mm_storeu_si128((__m128i*)(hex + 2 * i + 16), _mm_shuffle_epi8(lut, _mm_unpackhi_epi8(hi, lo)));
+    }
+
+    encode_scalar(bytes + i, len - i, hex + 2 * i);
+}
+
+/**
+ * AVX2 인코딩: 32바이트 -> 64문자
+ */
+__attribute__((target("avx2")))
+static void encode_avx2(const uint8_t* bytes, size_t len, char* hex) {
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HEX_DIGITS));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(bytes + i));
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask);
+        __m256i lo = _mm256_and_si256(v, mask);
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);   // 바이트 0-7 | 16-23
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);   // 바이트 8-15 | 24-31
+        __m256i first = _mm256_permute2x128_si256(a, b, 0x20);
+        __m256i second = _mm256_permute2x128_si256(a, b, 0x31);
+        _mm256_storeu_si256((__m256i*)(hex + 2 * i), _mm256_shuffle_epi8(lut, first));
+        _mm256_storeu_si256((__m256i*)(hex + 2 * i + 32), _mm256_shuffle_epi8(lut, second));
+    }
+
+    encode_ssse3(bytes + i, len - i, hex + 2 * i);
+}
+#endif
+
+// 선택된 구현
+static bool (*g_decode_pairs)(const char*, size_t, uint8_t*) = NULL;
+static void (*g_encode)(const uint8_t*, size_t, char*) = NULL;
+static const char* g_impl_name = "Scalar";
+
+static void hex_codec_dispatch(void) {
+    bool (*dec)(const char*, size_t, uint8_t*) = decode_pairs_scalar;
+    void (*enc)(const uint8_t*, size_t, char*) = encode_scalar;
+    const char* name = "Scalar";
+
+#ifdef HEX_CODEC_X86
+    const CpuFeatures* cpu = get_cpu_features();
+    if (cpu->avx2) {
+        dec = decode_pairs_avx2;
+        enc = encode_avx2;
+        name = "AVX2";
+    } else if (cpu->ssse3 && cpu->sse41) {
+        dec = decode_pairs_ssse3;
+        enc = encode_ssse3;
+        name = "SSSE3";
+    }
+#endif
+
+    g_encode = enc;
+    g_impl_name = name;
+    g_decode_pairs = dec;
+}
+
+const char* hex_codec_impl_name(void) {
+    if (g_decode_pairs == NULL) {
+        hex_codec_dispatch();
+    }
+    return g_impl_name;
+}
+
+int hex_decode(const char* hex, size_t hex_len, uint8_t* out, size_t out_cap, size_t* out_len) {
+    if (hex == NULL || (out == NULL && hex_len > 0)) {
+        return ERR_HEX_NULL_INPUT;
+    }
+    if (g_decode_pairs == NULL) {
+        hex_codec_dispatch();
+    }
+
+    size_t byte_len = (hex_len + 1) / 2;
+    if (byte_len > out_cap) {
+        return ERR_HEX_BUFFER_OVERFLOW;
+    }
+
+    // 홀수 길이: 첫 문자를 단독 하위 니블로 처리 (앞에 '0'을 붙인 것과 동일)
+    if (hex_len % 2 != 0) {
+        unsigned char first = (unsigned char)hex[0];
+        if (!HEX_VALID[first]) {
+            return ERR_INVALID_FORMAT;
+        }
+        out[0] = HEX_VALUE[first];
+        hex++;
+        out++;
+    }
+
+    if (!g_decode_pairs(hex, hex_len / 2, out)) {
+        return ERR_INVALID_FORMAT;
+    }
+
+    if (out_len != NULL) {
+        *out_len = byte_len;
+    }
+    return SUCCESS;
+}
+
+void hex_encode(const uint8_t* bytes, size_t len, char* hex) {
+    if (g_encode == NULL) {
+        hex_codec_dispatch();
+    }
+    g_encode(bytes, len, hex);
+}
+
+void hex_stream_init(HexStreamState* st) {
+    st->pending = 0;
+    st->has_pending = false;
+}
+
+/**
+ * 16진수 청크를 바이트로 디코딩
+ * 청크가 홀수 자리에서 끊겨도 다음 청크와 이어서 처리
+ * 공백이 없는 청크는 벡터 디코더로, 그 외에는 스칼라로 처리
+ * @param out_len 디코딩된 바이트 수
+ * @return 성공 시 SUCCESS, 잘못된 문자가 있으면 ERR_INVALID_FORMAT
+ */
+int hex_stream_decode(HexStreamState* st, const char* hex, size_t hex_len, uint8_t* out, size_t* out_len) {
+    size_t n = 0;
+    size_t i = 0;
+
+    if (g_decode_pairs == NULL) {
+        hex_codec_dispatch();
+    }
+
+    // 대기 중인 니블이 있으면 먼저 한 문자로 바이트 완성
+    if (st->has_pending && hex_len > 0 && HEX_VALID[(unsigned char)hex[0]]) {
+        out[n++] = (uint8_t)((st->pending << 4) | HEX_VALUE[(unsigned char)hex[0]]);
+        st->has_pending = false;
+        i = 1;
+    }
+
+    // 빠른 경로: 나머지 짝수 구간을 한 번에 디코딩
+    if (!st->has_pending) {
+        size_t pairs = (hex_len - i) / 2;
+        if (g_decode_pairs(hex + i, pairs, out + n)) {
+            n += pairs;
+            i += pairs * 2;
+        }
+    }
+
+    // 느린 경로: 공백이 섞였거나 남은 한 문자
+    for (; i < hex_len; i++) {
+        unsigned char ch = (unsigned char)hex[i];
+
+        if (!HEX_VALID[ch]) {
+            if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n') continue;
+            return ERR_INVALID_FORMAT;
+        }
+
+        if (st->has_pending) {
+            out[n++] = (uint8_t)((st->pending << 4) | HEX_VALUE[ch]);
+            st->has_pending = false;
+        } else {
+            st->pending = HEX_VALUE[ch];
+            st->has_pending = true;
+        }
+    }
+
+    *out_len = n;
+    return SUCCESS;
+}
@@ -0,0 +1,121 @@
+#include "../../include/common/lf_queue.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <time.h>
+#endif
+
+int lf_queue_init(LfQueue* queue, size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) size <<= 1;
+
+    memset(queue, 0, sizeof(*queue));
+    queue->cells = (LfQueueCell*)malloc(size * sizeof(LfQueueCell));
+    if (queue->cells == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        queue->cells[i].seq = i;
+        queue->cells[i].item = NULL;
+    }
+    queue->mask = size - 1;
+    return SUCCESS;
+}
+
+void lf_queue_free(LfQueue* queue) {
+    free(queue->cells);
+    queue->cells = NULL;
+}
+
+/**
+ * 넣기: 칸의 seq가 위치와 같으면 비어 있음
+ * 위치를 CAS로 선점한 뒤 항목을 쓰고 seq를 위치+1로 공개
+ */
+bool lf_queue_try_push(LfQueue* queue, void* item) {
+    size_t pos = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+
+    for (;;) {
+        LfQueueCell* cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->head, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                cell->item = item;
+                __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // 가득 참
+        } else {
+            pos = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * 꺼내기: 칸의 seq가 위치+1이면 채워져 있음
+ * 꺼낸 뒤 seq를 위치+용량으로 바꿔 다음 바퀴의 생산자에게 넘김
+ */
+bool lf_queue_try_pop(LfQueue* queue, void** item) {
+    size_t pos = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+    for (;;) {
+        LfQueueCell* cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->tail, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *item = cell->item;
+                __atomic_store_n(&cell->seq, pos + queue->mask + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // 비어 있음
+        } else {
+            pos = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+void lf_backoff(unsigned spins) {
+    if (spins < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    } else if (spins < 256) {
+#ifdef _WIN32
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    } else {
+#ifdef _WIN32
+        Sleep(0);
+#else
+        struct timespec ts = { 0, 50000 };  // 50us
+        nanosleep(&ts, NULL);
+#endif
+    }
+}
+
+void lf_queue_push(LfQueue* queue, void* item) {
+    for (unsigned spins = 0; !lf_queue_try_push(queue, item); spins++) {
+        lf_backoff(spins);
+    }
+}
+
+void* lf_queue_pop(LfQueue* queue) {
+    void* item = NULL;
+    for (unsigned spins = 0; !lf_queue_try_pop(queue, &item); spins++) {
+        lf_backoff(spins);
+    }
+    return item;
+}
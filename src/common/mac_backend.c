@@ -0,0 +1,111 @@
+#include <openssl/core_names.h>
+#include <openssl/crypto.h>
+#include "../../include/common/mac_backend.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include "../../include/common/hex_codec.h"
+
+void mac_backend_set(MacBackend* backend, MacFunction mac_function, MacVerifyFunction mac_verify,
+                     const MacBackend* fallback) {
+    backend->mac_function = mac_function ? mac_function : fallback->mac_function;
+    backend->mac_verify = mac_verify ? mac_verify : fallback->mac_verify;
+}
+
+// 빈 키가 가리킬 자리 (EVP_MAC_init은 키가 NULL이면 이전 키를 재사용하므로)
+static const uint8_t EMPTY_KEY[1] = { 0 };
+
+int mac_backend_evp(EvpCacheMacId id, const char* param_name, const char* param_value,
+                    const unsigned char* key, size_t key_len, const unsigned char* message, size_t message_len,
+                    unsigned char* tag, size_t tag_len, size_t full_len) {
+    EVP_MAC_CTX* ctx = evp_cache_mac_ctx_acquire(id);
+    if (ctx == NULL) {
+        return ERR_CRYPTO_INIT;
+    }
+
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(param_name, (char*)param_value, 0),
+        OSSL_PARAM_construct_end()
+    };
+    uint8_t full[MAC_BACKEND_MAX_TAG];
+    size_t out_len = 0;
+    int ret = SUCCESS;
+
+    if (full_len > sizeof(full) || EVP_MAC_init(ctx, key != NULL ? key : EMPTY_KEY, key_len, params) != 1) {
+        ret = ERR_CRYPTO_INIT;
+    } else if (EVP_MAC_update(ctx, message, message_len) != 1 ||
+               EVP_MAC_final(ctx, full, &out_len, sizeof(full)) != 1 || out_len != full_len) {
+        ret = ERR_CRYPTO_OPERATION;
+    }
+    evp_cache_mac_ctx_release(id, ctx);
+
+    if (ret == SUCCESS) {
+        memcpy(tag, full, tag_len);
+    }
+    return ret;
+}
+
+int mac_backend_verify(MacFunction mac_function, const unsigned char* key, size_t key_len,
+                       const unsigned char* message, size_t message_len, const unsigned char* tag, size_t tag_len) {
+    uint8_t expected[MAC_BACKEND_MAX_TAG];
+    if (tag_len > sizeof(expected)) {
+        return ERR_INVALID_INPUT;
+    }
+
+    int ret = mac_function(key, key_len, message, message_len, expected, tag_len);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return CRYPTO_memcmp(expected, tag, tag_len) == 0 ? SUCCESS : ERR_MAC_VERIFY;
+}
+
+// 한 줄 입력 (개행 제거, 길이 반환)
+static int read_line(char* buf, size_t size, size_t* len) {
+    if (fgets(buf, (int)size, stdin) == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+    *len = strlen(buf);
+    while (*len > 0 && (buf[*len - 1] == '\n' || buf[*len - 1] == '\r')) {
+        buf[--*len] = '\0';
+    }
+    return SUCCESS;
+}
+
+int mac_backend_read_hex(const char* prompt, uint8_t* buf, size_t size, size_t* len) {
+    char line[MAX_LINE_LENGTH];
+    size_t line_len = 0;
+
+    printf("\n%s\n", prompt);
+    *len = 0;
+    int result = read_line(line, sizeof(line), &line_len);
+    if (result == SUCCESS && line_len > 0) {
+        result = hex_decode(line, line_len, buf, size, len);
+    }
+    return result == SUCCESS ? SUCCESS : ERR_INVALID_INPUT;
+}
+
+int mac_backend_read_message(int input_type_id, uint8_t* message, size_t size, size_t* len) {
+    if (input_type_id != 0) { // 16진수 입력
+        return mac_backend_read_hex("메시지를 16진수로 입력하세요 (빈 줄이면 빈 메시지):", message, size, len);
+    }
+
+    // 텍스트 입력
+    char line[MAX_LINE_LENGTH];
+    size_t line_len = 0;
+    size_t limit = size < sizeof(line) - 1 ? size : sizeof(line) - 1;
+
+    printf("\n메시지를 입력하세요 (최대 %zu 바이트):\n", limit);
+    int result = read_line(line, limit + 1, &line_len);
+    if (result == SUCCESS) {
+        memcpy(message, line, line_len);
+        *len = line_len;
+    }
+    return result;
+}
+
+void mac_backend_print_tag(const char* label, const uint8_t* tag, size_t tag_len) {
+    printf("[%s 태그]\n", label);
+    for (size_t i = 0; i < tag_len; i++) {
+        printf("%02x", tag[i]);
+    }
+    printf("\n");
+}
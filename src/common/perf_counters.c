@@ -0,0 +1,421 @@
+#include "../../include/common/perf_counters.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+bool g_perf_profile_enabled = false;
+
+const char* perf_event_name(PerfEvent event) {
+    static const char* names[PERF_EV_COUNT] = {
+        "cycles", "instructions", "branch-misses", "L1D-read-misses", "LLC-read-misses",
+        "frontend-stalls", "task-clock"
+    };
+    return (unsigned)event < PERF_EV_COUNT ? names[event] : "?";
+}
+
+#ifdef __linux__
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <pthread.h>
+
+// 스레드 표 하나에 모으는 (알고리즘, 크기 구간) 항목 수 (넘치면 전역 표에 합침)
+#define PERF_THREAD_ENTRIES 32
+#define PERF_LABEL_LENGTH 48
+
+// (알고리즘, 크기 구간) 하나의 누적값
+typedef struct {
+    char label[PERF_LABEL_LENGTH];
+    int bucket;
+    uint64_t calls;              // 감싼 커널 호출 수
+    uint64_t ops;                // 처리한 메시지 수
+    uint64_t bytes;
+    uint64_t values[PERF_EV_COUNT];
+} PerfEntry;
+
+// 스레드별 카운터 그룹과 누적 표
+typedef struct {
+    bool opened;                 // 그룹 열기를 시도했는지
+    int leader;                  // 그룹 대표 fd (-1이면 사용 불가)
+    int fds[PERF_EV_COUNT];
+    int slot[PERF_EV_COUNT];     // 그룹 읽기 결과에서 이벤트 위치 (-1이면 열지 못함)
+    int nr;
+    const char* label;
+    size_t entry_count;
+    PerfEntry entries[PERF_THREAD_ENTRIES];
+} PerfThread;
+
+// 그룹에 넣는 순서 (하드웨어 카운터가 모자라면 뒤에서부터 뺌)
+static const PerfEvent k_priority[PERF_EV_COUNT] = {
+    PERF_EV_CYCLES, PERF_EV_INSTRUCTIONS, PERF_EV_TASK_CLOCK, PERF_EV_BRANCH_MISSES,
+    PERF_EV_L1D_MISSES, PERF_EV_LLC_MISSES, PERF_EV_FRONTEND_STALLS
+};
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_key;
+static PerfEntry* g_entries = NULL;
+static size_t g_entry_count = 0;
+static size_t g_entry_capacity = 0;
+static uint32_t g_available = 0;     // 어느 스레드에서든 열린 이벤트 (비트마스크)
+static THREAD_LOCAL PerfThread g_thread;
+
+static void event_attr(PerfEvent event, struct perf_event_attr* attr) {
+    memset(attr, 0, sizeof(*attr));
+    attr->size = sizeof(*attr);
+    attr->read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr->exclude_kernel = 1;
+    attr->exclude_hv = 1;
+
+    const uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+    switch (event) {
+        case PERF_EV_CYCLES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_EV_INSTRUCTIONS:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_EV_BRANCH_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PERF_EV_L1D_MISSES:
+            attr->type = PERF_TYPE_HW_CACHE;
+            attr->config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+            break;
+        case PERF_EV_LLC_MISSES:
+            attr->type = PERF_TYPE_HW_CACHE;
+            attr->config = PERF_COUNT_HW_CACHE_LL | read_miss;
+            break;
+        case PERF_EV_FRONTEND_STALLS:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_STALLED_CYCLES_FRONTEND;
+            break;
+        default:
+            attr->type = PERF_TYPE_SOFTWARE;
+            attr->config = PERF_COUNT_SW_TASK_CLOCK;
+            break;
+    }
+}
+
+// 그룹 전체 읽기: nr, time_enabled, time_running, 값...
+static bool read_group(PerfThread* t, uint64_t* time_enabled, uint64_t* time_running,
+                       uint64_t values[PERF_EV_COUNT]) {
+    uint64_t buf[3 + PERF_EV_COUNT];
+    ssize_t n = read(t->leader, buf, sizeof(uint64_t) * (size_t)(3 + t->nr));
+    if (n != (ssize_t)(sizeof(uint64_t) * (size_t)(3 + t->nr))) {
+        return false;
+    }
+
+    *time_enabled = buf[1];
+    *time_running = buf[2];
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        values[e] = t->slot[e] >= 0 ? buf[3 + t->slot[e]] : 0;
+    }
+    return true;
+}
+
+static void close_group(PerfThread* t) {
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        if (t->fds[e] >= 0) close(t->fds[e]);
+        t->fds[e] = -1;
+        t->slot[e] = -1;
+    }
+    t->leader = -1;
+    t->nr = 0;
+}
+
+// 우선순위 앞쪽 limit개 이벤트로 그룹 열기
+static void open_group(PerfThread* t, int limit) {
+    for (int i = 0; i < limit; i++) {
+        PerfEvent event = k_priority[i];
+        struct perf_event_attr attr;
+        event_attr(event, &attr);
+
+        // 해당 하드웨어가 없으면 (ENOENT, EOPNOTSUPP) 그 이벤트만 빠짐
+        int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, t->leader, 0);
+        if (fd < 0) continue;
+
+        if (t->leader < 0) t->leader = fd;
+        t->fds[event] = fd;
+        t->slot[event] = t->nr++;
+    }
+}
+
+// 그룹이 실제로 실행되는지 확인 (카운터 수가 하드웨어보다 많으면 time_running이 늘지 않음)
+static bool group_scheduled(PerfThread* t) {
+    uint64_t enabled, running, values[PERF_EV_COUNT];
+    volatile uint64_t spin = 0;
+    for (int i = 0; i < 100000; i++) spin += (uint64_t)i;
+    return read_group(t, &enabled, &running, values) && running > 0;
+}
+
+static void flush_thread(PerfThread* t);
+
+// 스레드 종료 시 누적값을 합치고 카운터 닫기
+static void thread_destructor(void* arg) {
+    PerfThread* t = (PerfThread*)arg;
+    flush_thread(t);
+    close_group(t);
+}
+
+static void create_key(void) {
+    pthread_key_create(&g_key, thread_destructor);
+}
+
+static void open_thread(PerfThread* t) {
+    t->opened = true;
+    t->leader = -1;
+    t->nr = 0;
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        t->fds[e] = -1;
+        t->slot[e] = -1;
+    }
+
+    for (int limit = PERF_EV_COUNT; limit > 0; limit--) {
+        open_group(t, limit);
+        if (t->leader < 0 || group_scheduled(t)) break;
+        close_group(t);
+    }
+    if (t->leader < 0) {
+        return;
+    }
+
+    uint32_t mask = 0;
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        if (t->slot[e] >= 0) mask |= 1u << e;
+    }
+    __atomic_fetch_or(&g_available, mask, __ATOMIC_RELAXED);
+
+    pthread_once(&g_key_once, create_key);
+    pthread_setspecific(g_key, t);
+}
+
+int perf_profile_enable(void) {
+    if (!g_thread.opened) {
+        open_thread(&g_thread);
+    }
+    if (g_thread.leader < 0) {
+        return ERR_NOT_SUPPORTED;
+    }
+    g_perf_profile_enabled = true;
+    return SUCCESS;
+}
+
+void perf_profile_set_label(const char* label) {
+    g_thread.label = label;
+}
+
+const char* perf_profile_label(void) {
+    return g_thread.label;
+}
+
+void perf_profile_start(PerfMark* mark) {
+    PerfThread* t = &g_thread;
+    if (!t->opened) {
+        open_thread(t);
+    }
+    mark->active = t->leader >= 0 &&
+                   read_group(t, &mark->time_enabled, &mark->time_running, mark->values);
+}
+
+// 메시지당 평균 크기로 구간 선택
+static int size_bucket(size_t bytes, size_t ops) {
+    uint64_t avg = ops > 0 ? bytes / ops : bytes;
+    uint64_t limit = 64;
+    int bucket = 0;
+    while (avg >= limit && bucket < PERF_SIZE_BUCKETS - 1) {
+        bucket++;
+        limit *= 4;
+    }
+    return bucket;
+}
+
+static void add_entry(PerfEntry* dst, const PerfEntry* src) {
+    dst->calls += src->calls;
+    dst->ops += src->ops;
+    dst->bytes += src->bytes;
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        dst->values[e] += src->values[e];
+    }
+}
+
+// 전역 표에 합침 (g_lock을 잡은 상태에서 호출)
+static void merge_global(const PerfEntry* src) {
+    for (size_t i = 0; i < g_entry_count; i++) {
+        if (g_entries[i].bucket == src->bucket && strcmp(g_entries[i].label, src->label) == 0) {
+            add_entry(&g_entries[i], src);
+            return;
+        }
+    }
+
+    if (g_entry_count == g_entry_capacity) {
+        size_t capacity = g_entry_capacity ? g_entry_capacity * 2 : 64;
+        PerfEntry* grown = (PerfEntry*)realloc(g_entries, capacity * sizeof(PerfEntry));
+        if (grown == NULL) {
+            return;
+        }
+        g_entries = grown;
+        g_entry_capacity = capacity;
+    }
+    g_entries[g_entry_count++] = *src;
+}
+
+static void flush_thread(PerfThread* t) {
+    if (t->entry_count == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    for (size_t i = 0; i < t->entry_count; i++) {
+        merge_global(&t->entries[i]);
+    }
+    pthread_mutex_unlock(&g_lock);
+    t->entry_count = 0;
+}
+
+static PerfEntry* thread_entry(PerfThread* t, const char* label, int bucket) {
+    for (size_t i = 0; i < t->entry_count; i++) {
+        if (t->entries[i].bucket == bucket && strcmp(t->entries[i].label, label) == 0) {
+            return &t->entries[i];
+        }
+    }
+
+    if (t->entry_count == PERF_THREAD_ENTRIES) {
+        flush_thread(t);
+    }
+    PerfEntry* entry = &t->entries[t->entry_count++];
+    memset(entry, 0, sizeof(*entry));
+    snprintf(entry->label, sizeof(entry->label), "%s", label);
+    entry->bucket = bucket;
+    return entry;
+}
+
+void perf_profile_stop(PerfMark* mark, size_t bytes, size_t ops) {
+    PerfThread* t = &g_thread;
+    uint64_t time_enabled, time_running, values[PERF_EV_COUNT];
+    if (!read_group(t, &time_enabled, &time_running, values)) {
+        return;
+    }
+
+    // 다중화로 그룹이 일부 시간만 실행됐으면 실행 비율로 보정
+    uint64_t enabled = time_enabled - mark->time_enabled;
+    uint64_t running = time_running - mark->time_running;
+    double scale = (running > 0 && running < enabled) ? (double)enabled / (double)running : 1.0;
+
+    PerfEntry* entry = thread_entry(t, t->label ? t->label : "(기타)", size_bucket(bytes, ops));
+    entry->calls++;
+    entry->ops += ops;
+    entry->bytes += bytes;
+    if (running == 0) {
+        return;
+    }
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        entry->values[e] += (uint64_t)((double)(values[e] - mark->values[e]) * scale);
+    }
+}
+
+static void format_bucket(char* buf, size_t size, int bucket) {
+    static const char* bounds[PERF_SIZE_BUCKETS + 1] = {
+        "0B", "64B", "256B", "1KB", "4KB", "16KB", "64KB", "256KB", "1MB", NULL
+    };
+    if (bucket == PERF_SIZE_BUCKETS - 1) {
+        snprintf(buf, size, ">=%s", bounds[bucket]);
+    } else {
+        snprintf(buf, size, "%s-%s", bounds[bucket], bounds[bucket + 1]);
+    }
+}
+
+// 계산에 필요한 카운터가 모두 있으면 값, 아니면 "-"
+static void print_metric(bool ok, double value, int width, int precision) {
+    if (ok) {
+        printf(" %*.*f", width, precision, value);
+    } else {
+        printf(" %*s", width, "-");
+    }
+}
+
+static int compare_entries(const void* a, const void* b) {
+    const PerfEntry* x = (const PerfEntry*)a;
+    const PerfEntry* y = (const PerfEntry*)b;
+    int c = strcmp(x->label, y->label);
+    return c != 0 ? c : x->bucket - y->bucket;
+}
+
+void perf_profile_report(void) {
+    if (!g_perf_profile_enabled) {
+        return;
+    }
+    flush_thread(&g_thread);
+
+    pthread_mutex_lock(&g_lock);
+    uint32_t available = __atomic_load_n(&g_available, __ATOMIC_RELAXED);
+    qsort(g_entries, g_entry_count, sizeof(PerfEntry), compare_entries);
+#define HAS(event) ((available & (1u << (event))) != 0)
+
+    printf("\n[하드웨어 카운터] 사용자 공간, 다중화된 구간은 실행 비율로 보정\n");
+    bool first = true;
+    for (int e = 0; e < PERF_EV_COUNT; e++) {
+        if (HAS(e)) continue;
+        printf("%s%s", first ? "사용할 수 없는 카운터: " : ", ", perf_event_name((PerfEvent)e));
+        first = false;
+    }
+    if (!first) printf("\n");
+
+    // 한글 제목은 printf 폭 계산이 맞지 않으므로 공백으로 맞춤
+    printf("알고리즘                 크기 구간         호출    평균(B)     ns/B cycles/B    IPC"
+           " 분기미스/KB L1D미스/KB LLC미스/KB FE정체%%\n");
+    for (size_t i = 0; i < g_entry_count; i++) {
+        const PerfEntry* entry = &g_entries[i];
+        const uint64_t* v = entry->values;
+        double bytes = entry->bytes > 0 ? (double)entry->bytes : 1.0;
+        double cycles = v[PERF_EV_CYCLES] > 0 ? (double)v[PERF_EV_CYCLES] : 1.0;
+
+        char bucket[24];
+        format_bucket(bucket, sizeof(bucket), entry->bucket);
+        printf("%-24s %-14s %10llu %10.0f", entry->label, bucket, (unsigned long long)entry->calls,
+               entry->ops > 0 ? (double)entry->bytes / (double)entry->ops : 0.0);
+        print_metric(HAS(PERF_EV_TASK_CLOCK), (double)v[PERF_EV_TASK_CLOCK] / bytes, 8, 3);
+        print_metric(HAS(PERF_EV_CYCLES), (double)v[PERF_EV_CYCLES] / bytes, 8, 2);
+        print_metric(HAS(PERF_EV_CYCLES) && HAS(PERF_EV_INSTRUCTIONS), (double)v[PERF_EV_INSTRUCTIONS] / cycles, 6, 2);
+        print_metric(HAS(PERF_EV_BRANCH_MISSES), (double)v[PERF_EV_BRANCH_MISSES] * 1024 / bytes, 11, 2);
+        print_metric(HAS(PERF_EV_L1D_MISSES), (double)v[PERF_EV_L1D_MISSES] * 1024 / bytes, 10, 2);
+        print_metric(HAS(PERF_EV_LLC_MISSES), (double)v[PERF_EV_LLC_MISSES] * 1024 / bytes, 10, 3);
+        print_metric(HAS(PERF_EV_CYCLES) && HAS(PERF_EV_FRONTEND_STALLS),
+                     100.0 * (double)v[PERF_EV_FRONTEND_STALLS] / cycles, 7, 1);
+        printf("\n");
+    }
+#undef HAS
+    pthread_mutex_unlock(&g_lock);
+}
+
+#else
+
+int perf_profile_enable(void) {
+    return ERR_NOT_SUPPORTED;
+}
+
+void perf_profile_set_label(const char* label) {
+    (void)label;
+}
+
+const char* perf_profile_label(void) {
+    return NULL;
+}
+
+void perf_profile_start(PerfMark* mark) {
+    mark->active = false;
+}
+
+void perf_profile_stop(PerfMark* mark, size_t bytes, size_t ops) {
+    (void)mark;
+    (void)bytes;
+    (void)ops;
+}
+
+void perf_profile_report(void) {
+}
+
+#endif // __linux__
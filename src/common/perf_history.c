@@ -0,0 +1,402 @@
+#include "../../include/common/perf_history.h"
+#include "../../include/common/algorithm_registry.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <time.h>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// 빌드 시 Makefile이 넣는 커밋 (CRYPTO_TEST_COMMIT 환경 변수가 있으면 우선)
+#ifndef CRYPTO_TEST_COMMIT
+#define CRYPTO_TEST_COMMIT "unknown"
+#endif
+
+// 기록 한 줄의 필드 수 (버전 포함, v1은 실행 ID가 없어 하나 적음)
+#define PERF_HISTORY_FIELDS 14
+#define PERF_HISTORY_FIELDS_V1 13
+
+// 정규분포에서 MAD를 표준편차로 바꾸는 배수
+#define MAD_TO_SIGMA 1.4826
+
+static const char* g_path_override = NULL;
+
+const char* perf_history_path(void) {
+    if (g_path_override != NULL) {
+        return g_path_override;
+    }
+    const char* env = getenv("CRYPTO_TEST_PERF_HISTORY");
+    if (env != NULL && *env != '\0') {
+        return strcmp(env, "off") == 0 ? NULL : env;
+    }
+    return PERF_HISTORY_DEFAULT_PATH;
+}
+
+void perf_history_set_path(const char* path) {
+    g_path_override = path;
+}
+
+void perf_history_record_init(PerfHistoryRecord* record, const char* mode) {
+    // 실행 정보는 처음 한 번만 구해 이후 기록에 복사
+    static PerfHistoryRecord stamp;
+    static bool stamped = false;
+
+    if (!stamped) {
+        memset(&stamp, 0, sizeof(stamp));
+        stamp.timestamp = (long long)time(NULL);
+        snprintf(stamp.run_id, sizeof(stamp.run_id), "%lld-%ld", stamp.timestamp, (long)getpid());
+
+        const char* commit = getenv("CRYPTO_TEST_COMMIT");
+        snprintf(stamp.commit, sizeof(stamp.commit), "%s",
+                 commit != NULL && *commit != '\0' ? commit : CRYPTO_TEST_COMMIT);
+        if (gethostname(stamp.host, sizeof(stamp.host)) != 0) {
+            snprintf(stamp.host, sizeof(stamp.host), "unknown");
+        }
+        stamp.host[sizeof(stamp.host) - 1] = '\0';
+        get_cpu_model(stamp.cpu_model, sizeof(stamp.cpu_model));
+        stamped = true;
+    }
+
+    *record = stamp;
+    snprintf(record->mode, sizeof(record->mode), "%s", mode);
+}
+
+// 탭과 줄바꿈은 필드 구분자이므로 공백으로 바꿔 출력
+static void write_field(FILE* fp, const char* value) {
+    fputc('\t', fp);
+    for (const char* p = value; *p; p++) {
+        fputc((*p == '\t' || *p == '\n' || *p == '\r') ? ' ' : *p, fp);
+    }
+}
+
+int perf_history_append(const PerfHistoryRecord* records, size_t count) {
+    const char* path = perf_history_path();
+    if (path == NULL || count == 0) {
+        return SUCCESS;
+    }
+
+    FILE* fp = fopen(path, "a");
+    if (fp == NULL) {
+        return ERR_FILE_CREATE;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const PerfHistoryRecord* r = &records[i];
+        fprintf(fp, "%s\t%lld", PERF_HISTORY_VERSION, r->timestamp);
+        write_field(fp, r->run_id);
+        write_field(fp, r->commit);
+        write_field(fp, r->host);
+        write_field(fp, r->cpu_model);
+        write_field(fp, r->mode);
+        write_field(fp, r->algorithm);
+        write_field(fp, r->backend);
+        write_field(fp, r->path);
+        fprintf(fp, "\t%llu\t%.6g\t%.6g\t%d\n", (unsigned long long)r->size, r->mb_per_sec, r->mad, r->trials);
+    }
+
+    return fclose(fp) == 0 ? SUCCESS : ERR_FILE_WRITE;
+}
+
+// 탭 기준으로 줄 나누기 (줄 내용이 바뀜)
+static int split_fields(char* line, char* fields[PERF_HISTORY_FIELDS]) {
+    int n = 0;
+    char* p = line;
+    while (n < PERF_HISTORY_FIELDS) {
+        fields[n++] = p;
+        p = strchr(p, '\t');
+        if (p == NULL) break;
+        *p++ = '\0';
+    }
+    return (p == NULL) ? n : -1;
+}
+
+static bool parse_record(char* line, PerfHistoryRecord* r) {
+    line[strcspn(line, "\r\n")] = '\0';
+
+    char* f[PERF_HISTORY_FIELDS];
+    int n = split_fields(line, f);
+    bool v1 = (n == PERF_HISTORY_FIELDS_V1 && strcmp(f[0], "v1") == 0);
+    if (!v1 && (n != PERF_HISTORY_FIELDS || strcmp(f[0], PERF_HISTORY_VERSION) != 0)) {
+        return false;
+    }
+
+    memset(r, 0, sizeof(*r));
+    r->timestamp = strtoll(f[1], NULL, 10);
+
+    // v1 기록은 실행 ID가 없으므로 시각을 실행 ID로 사용 (이후 필드는 한 칸씩 앞)
+    int o = v1 ? 2 : 3;
+    snprintf(r->run_id, sizeof(r->run_id), "%s", v1 ? f[1] : f[2]);
+    snprintf(r->commit, sizeof(r->commit), "%s", f[o]);
+    snprintf(r->host, sizeof(r->host), "%s", f[o + 1]);
+    snprintf(r->cpu_model, sizeof(r->cpu_model), "%s", f[o + 2]);
+    snprintf(r->mode, sizeof(r->mode), "%s", f[o + 3]);
+    snprintf(r->algorithm, sizeof(r->algorithm), "%s", f[o + 4]);
+    snprintf(r->backend, sizeof(r->backend), "%s", f[o + 5]);
+    snprintf(r->path, sizeof(r->path), "%s", f[o + 6]);
+    r->size = strtoull(f[o + 7], NULL, 10);
+    r->mb_per_sec = atof(f[o + 8]);
+    r->mad = atof(f[o + 9]);
+    r->trials = atoi(f[o + 10]);
+    return r->mb_per_sec > 0;
+}
+
+int perf_history_load(const char* path, PerfHistoryRecord** records, size_t* count) {
+    *records = NULL;
+    *count = 0;
+
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL) {
+        return ERR_FILE_OPEN;
+    }
+
+    size_t capacity = 0;
+    char line[MAX_LINE_LENGTH];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        PerfHistoryRecord record;
+        if (!parse_record(line, &record)) continue;
+
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            PerfHistoryRecord* grown = (PerfHistoryRecord*)realloc(*records, capacity * sizeof(PerfHistoryRecord));
+            if (grown == NULL) {
+                free(*records);
+                *records = NULL;
+                *count = 0;
+                fclose(fp);
+                return ERR_MEMORY_ALLOC;
+            }
+            *records = grown;
+        }
+        (*records)[(*count)++] = record;
+    }
+
+    fclose(fp);
+    return SUCCESS;
+}
+
+// 모드별 최근 실행 ID (bench, batch 순서, 기록이 없으면 NULL)
+// 시각이 가장 늦은 기록의 실행이고, 같은 초면 파일에서 나중에 덧붙인 실행
+static void latest_runs(const PerfHistoryRecord* records, size_t count, const char* latest[2]) {
+    long long latest_time[2] = { -1, -1 };
+    latest[0] = latest[1] = NULL;
+    for (size_t i = 0; i < count; i++) {
+        int m = strcmp(records[i].mode, "bench") == 0 ? 0 : 1;
+        if (records[i].timestamp >= latest_time[m]) {
+            latest_time[m] = records[i].timestamp;
+            latest[m] = records[i].run_id;
+        }
+    }
+}
+
+static bool in_latest_run(const PerfHistoryRecord* record, const char* const latest[2]) {
+    const char* run_id = latest[strcmp(record->mode, "bench") == 0 ? 0 : 1];
+    return run_id != NULL && strcmp(record->run_id, run_id) == 0;
+}
+
+int perf_history_save_baseline(const char* baseline_path) {
+    const char* path = perf_history_path();
+    if (path == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+
+    PerfHistoryRecord* records;
+    size_t count;
+    int ret = perf_history_load(path, &records, &count);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    const char* latest[2];
+    latest_runs(records, count, latest);
+
+    // 모드별 최근 실행의 커밋 (같은 빌드로 반복한 실행을 모두 기준에 넣어 실행 간 잡음을 반영)
+    // (앞으로 당기며 덮어쓰므로 복사해 둠)
+    char commits[2][sizeof(records->commit)] = { "", "" };
+    for (size_t i = 0; i < count; i++) {
+        if (in_latest_run(&records[i], latest)) {
+            snprintf(commits[strcmp(records[i].mode, "bench") == 0 ? 0 : 1], sizeof(commits[0]), "%s",
+                     records[i].commit);
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(records[i].commit, commits[strcmp(records[i].mode, "bench") == 0 ? 0 : 1]) == 0) {
+            records[kept++] = records[i];
+        }
+    }
+
+    // 덮어쓰기: 빈 파일을 만든 뒤 덧붙임
+    FILE* fp = fopen(baseline_path, "w");
+    if (fp == NULL || fclose(fp) != 0) {
+        free(records);
+        return ERR_FILE_CREATE;
+    }
+    const char* saved = g_path_override;
+    g_path_override = baseline_path;
+    ret = perf_history_append(records, kept);
+    g_path_override = saved;
+
+    if (ret == SUCCESS) {
+        printf("기준 저장: %s (기록 %zu개)\n", baseline_path, kept);
+    }
+    free(records);
+    return ret;
+}
+
+static bool same_key(const PerfHistoryRecord* a, const PerfHistoryRecord* b) {
+    return a->size == b->size && strcmp(a->mode, b->mode) == 0 && strcmp(a->algorithm, b->algorithm) == 0 &&
+           strcmp(a->path, b->path) == 0 && strcmp(a->backend, b->backend) == 0 &&
+           strcmp(a->cpu_model, b->cpu_model) == 0;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double* values, size_t n) {
+    qsort(values, n, sizeof(double), compare_doubles);
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+// 중앙값 절대 편차 (values 순서가 바뀜)
+static double median_abs_deviation(double* values, size_t n, double center) {
+    for (size_t i = 0; i < n; i++) {
+        values[i] = values[i] > center ? values[i] - center : center - values[i];
+    }
+    return median(values, n);
+}
+
+// 같은 키의 기준 기록 요약
+typedef struct {
+    size_t runs;
+    double median;      // 실행별 처리량의 중앙값
+    double noise;       // 실행 간 MAD와 실행 내 MAD 중앙값 중 큰 값
+    bool estimated;     // 잡음을 추정할 수 있었는지 (실행 수가 충분하거나 반복 측정이 있음)
+    char commit[48];
+} BaselineStat;
+
+static bool baseline_stat(const PerfHistoryRecord* base, size_t base_count, const PerfHistoryRecord* key,
+                          double* scratch, double* scratch_mad, BaselineStat* stat) {
+    size_t n = 0;
+    for (size_t i = 0; i < base_count; i++) {
+        if (!same_key(&base[i], key)) continue;
+        scratch[n] = base[i].mb_per_sec;
+        scratch_mad[n] = base[i].mad;
+        if (n == 0) snprintf(stat->commit, sizeof(stat->commit), "%s", base[i].commit);
+        n++;
+    }
+    if (n == 0) {
+        return false;
+    }
+
+    stat->runs = n;
+    stat->median = median(scratch, n);
+    double between = n >= PERF_HISTORY_MIN_RUNS ? median_abs_deviation(scratch, n, stat->median) : 0;
+    double within = median(scratch_mad, n);
+    stat->noise = between > within ? between : within;
+    stat->estimated = n >= PERF_HISTORY_MIN_RUNS || within > 0;
+    return true;
+}
+
+int run_perf_compare(const char* baseline_path, double threshold) {
+    const char* path = perf_history_path();
+    if (path == NULL) {
+        printf("성능 기록이 꺼져 있습니다 (CRYPTO_TEST_PERF_HISTORY=off)\n");
+        return ERR_INVALID_INPUT;
+    }
+
+    PerfHistoryRecord* base = NULL;
+    PerfHistoryRecord* current = NULL;
+    size_t base_count = 0, current_count = 0;
+    int ret = perf_history_load(baseline_path, &base, &base_count);
+    if (ret == SUCCESS) {
+        ret = perf_history_load(path, &current, &current_count);
+    }
+    double* scratch = (ret == SUCCESS) ? (double*)malloc(sizeof(double) * 2 * (base_count + 1)) : NULL;
+    if (ret != SUCCESS || scratch == NULL) {
+        free(base);
+        free(current);
+        return ret != SUCCESS ? ret : ERR_MEMORY_ALLOC;
+    }
+
+    const char* latest[2];
+    latest_runs(current, current_count, latest);
+
+    printf("기준: %s (기록 %zu개), 현재: %s (최근 실행)\n", baseline_path, base_count, path);
+    // 한글 제목과 판정은 printf 폭 계산이 맞지 않으므로 공백으로 맞춤
+    printf("판정   알고리즘         모드  경로                             크기    기준 MB/s    현재 MB/s    변화  잡음 MB/s\n");
+
+    size_t regressions = 0, improvements = 0, unchanged = 0, missing = 0, unestimated = 0;
+    for (size_t i = 0; i < current_count; i++) {
+        const PerfHistoryRecord* r = &current[i];
+        if (!in_latest_run(r, latest)) continue;
+
+        BaselineStat stat;
+        if (!baseline_stat(base, base_count, r, scratch, scratch + base_count + 1, &stat)) {
+            printf("[없음] %-16s %-5s %-28s %10llu %12s %12.3f\n", r->algorithm, r->mode, r->path,
+                   (unsigned long long)r->size, "-", r->mb_per_sec);
+            missing++;
+            continue;
+        }
+
+        // 잡음은 기준과 현재 측정 중 큰 쪽을 표준편차로 환산
+        double noise = stat.noise > r->mad ? stat.noise : r->mad;
+        double diff = r->mb_per_sec - stat.median;
+        double change = diff / stat.median;
+        bool significant = (diff < 0 ? -diff : diff) > PERF_HISTORY_NOISE_SIGMAS * MAD_TO_SIGMA * noise;
+
+        // 잡음 추정이 없으면 (기준 실행이 적고 반복 측정도 없음) 차이가 커도 의미를 판단할 수 없음
+        if (!stat.estimated && r->mad <= 0) {
+            printf("[보류] %-16s %-5s %-28s %10llu %12.3f %12.3f %+6.1f%% %10s\n", r->algorithm, r->mode,
+                   r->path, (unsigned long long)r->size, stat.median, r->mb_per_sec, change * 100.0, "-");
+            unestimated++;
+            continue;
+        }
+
+        const char* verdict = "[유지]";
+        if (significant && change <= -threshold) {
+            verdict = "[회귀]";
+            regressions++;
+        } else if (significant && change >= threshold) {
+            verdict = "[개선]";
+            improvements++;
+        } else {
+            unchanged++;
+        }
+
+        printf("%s %-16s %-5s %-28s %10llu %12.3f %12.3f %+6.1f%% %10.3f\n", verdict, r->algorithm, r->mode,
+               r->path, (unsigned long long)r->size, stat.median, r->mb_per_sec, change * 100.0,
+               MAD_TO_SIGMA * noise);
+    }
+
+    // 등록된 알고리즘 중 최근 실행에 기록이 없는 것
+    for (int algo_id = 0; algo_id < get_algorithm_count(); algo_id++) {
+        const char* name = get_algorithm_by_id(algo_id)->name;
+        bool found = false;
+        for (size_t i = 0; i < current_count && !found; i++) {
+            found = in_latest_run(&current[i], latest) && strcmp(current[i].algorithm, name) == 0;
+        }
+        if (!found) {
+            printf("[기록 없음] %s: 최근 실행에 측정값이 없음\n", name);
+        }
+    }
+
+    printf("\n비교 완료: 회귀 %zu개, 개선 %zu개, 유지 %zu개, 보류 %zu개, 기준 없음 %zu개 (임계값 %.1f%%)\n",
+           regressions, improvements, unchanged, unestimated, missing, threshold * 100.0);
+    if (unestimated > 0) {
+        printf("보류: 기준 실행이 %d회 미만이고 반복 측정이 없어 잡음을 추정할 수 없음 "
+               "(같은 빌드로 %d회 이상 실행한 뒤 --save-baseline)\n", PERF_HISTORY_MIN_RUNS, PERF_HISTORY_MIN_RUNS);
+    }
+
+    free(scratch);
+    free(base);
+    free(current);
+    return regressions == 0 ? SUCCESS : ERR_TEST_FAILED;
+}
@@ -0,0 +1,198 @@
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/cycle_timer.h"
+#include "../../include/common/common.h"
+
+const char* phase_name(Phase phase) {
+    static const char* names[PHASE_COUNT] = {
+        "파싱", "16진수", "암호 연산", "출력 형식", "파일 쓰기", "비교", "배치 대기"
+    };
+    return (unsigned)phase < PHASE_COUNT ? names[phase] : "?";
+}
+
+#ifdef CRYPTO_TEST_PHASES
+
+#include <pthread.h>
+
+// 파일 단위 범위
+typedef struct PhaseScope {
+    char label[MAX_PATH_LENGTH * 2];
+    PhaseCounter phases[PHASE_COUNT];
+    struct PhaseScope* next;
+} PhaseScope;
+
+// 스레드별 누적값 (범위를 바꾸거나 스레드가 끝날 때 범위에 합침)
+typedef struct {
+    PhaseScope* scope;
+    uint64_t child;              // 지금까지 끝난 구간 시간 합 (상위 구간의 자기 시간 계산용)
+    PhaseCounter phases[PHASE_COUNT];
+} PhaseThread;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static PhaseScope g_root = { "(파일 밖)", { { 0, 0, { 0 } } }, NULL };
+static PhaseScope* g_scopes = NULL;
+static PhaseScope** g_scopes_tail = &g_scopes;
+static THREAD_LOCAL PhaseThread g_thread;
+
+PhaseMark phase_begin(void) {
+    PhaseMark mark = { cycle_timer_now(), g_thread.child };
+    return mark;
+}
+
+static inline unsigned bucket_of(uint64_t ticks) {
+    unsigned b = ticks > 1 ? 63u - (unsigned)__builtin_clzll(ticks) : 0;
+    return b < PHASE_HIST_BUCKETS ? b : PHASE_HIST_BUCKETS - 1;
+}
+
+void phase_end(const PhaseMark* mark, Phase phase) {
+    uint64_t elapsed = cycle_timer_now() - mark->start;
+    uint64_t nested = g_thread.child - mark->child;
+    uint64_t self = elapsed > nested ? elapsed - nested : 0;
+
+    PhaseCounter* c = &g_thread.phases[phase];
+    c->count++;
+    c->ticks += self;
+    c->hist[bucket_of(self)]++;
+
+    // 상위 구간에는 이 구간 전체가 하위 시간으로 보임
+    g_thread.child = mark->child + elapsed;
+}
+
+static void add_counter(PhaseCounter* dst, const PhaseCounter* src) {
+    dst->count += src->count;
+    dst->ticks += src->ticks;
+    for (int b = 0; b < PHASE_HIST_BUCKETS; b++) {
+        dst->hist[b] += src->hist[b];
+    }
+}
+
+// 현재 스레드 누적값을 범위에 합치고 비움
+static void flush_thread(void) {
+    PhaseScope* target = g_thread.scope ? g_thread.scope : &g_root;
+
+    pthread_mutex_lock(&g_lock);
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        add_counter(&target->phases[p], &g_thread.phases[p]);
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    memset(g_thread.phases, 0, sizeof(g_thread.phases));
+}
+
+void* phase_scope_open(const char* algo_name, const char* label) {
+    PhaseScope* scope = (PhaseScope*)calloc(1, sizeof(PhaseScope));
+    flush_thread();
+    if (scope == NULL) {
+        return NULL;
+    }
+
+    snprintf(scope->label, sizeof(scope->label), "%s %s", algo_name, label);
+    pthread_mutex_lock(&g_lock);
+    *g_scopes_tail = scope;
+    g_scopes_tail = &scope->next;
+    pthread_mutex_unlock(&g_lock);
+
+    g_thread.scope = scope;
+    return scope;
+}
+
+void phase_scope_close(void* scope) {
+    (void)scope;
+    flush_thread();
+    g_thread.scope = NULL;
+}
+
+void* phase_scope_current(void) {
+    return g_thread.scope;
+}
+
+void phase_thread_attach(void* scope) {
+    flush_thread();
+    g_thread.scope = (PhaseScope*)scope;
+}
+
+void phase_thread_detach(void) {
+    flush_thread();
+    g_thread.scope = NULL;
+}
+
+/**
+ * 출력 폭에 맞춰 문자열 출력
+ * 한글(UTF-8 3바이트)은 화면에서 두 칸을 차지하므로 printf 폭 대신 직접 계산
+ */
+static void print_padded(const char* str, int width) {
+    int columns = 0;
+    for (const unsigned char* p = (const unsigned char*)str; *p; p++) {
+        if ((*p & 0xC0) != 0x80) columns += (*p >= 0xE0) ? 2 : 1;
+    }
+    fputs(str, stdout);
+    for (; columns < width; columns++) {
+        putchar(' ');
+    }
+}
+
+// 히스토그램에서 분위수가 속한 구간의 상한 (ns)
+static double hist_quantile_ns(const PhaseCounter* c, double q, double ticks_per_ns) {
+    uint64_t target = (uint64_t)((double)c->count * q);
+    uint64_t seen = 0;
+    for (int b = 0; b < PHASE_HIST_BUCKETS; b++) {
+        seen += c->hist[b];
+        if (seen > target || b == PHASE_HIST_BUCKETS - 1) {
+            return (double)(2ull << b) / ticks_per_ns;
+        }
+    }
+    return 0;
+}
+
+void phase_stats_report(void) {
+    flush_thread();
+    double ticks_per_ns = cycle_timer_ticks_per_ns();
+
+    PhaseCounter total[PHASE_COUNT];
+    memcpy(total, g_root.phases, sizeof(total));
+    for (PhaseScope* s = g_scopes; s != NULL; s = s->next) {
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            add_counter(&total[p], &s->phases[p]);
+        }
+    }
+
+    uint64_t all_ticks = 0;
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        all_ticks += total[p].ticks;
+    }
+    if (all_ticks == 0) {
+        return;
+    }
+
+    printf("\n[단계별 시간] 모든 스레드 합계, 중첩 구간 제외한 자기 시간\n");
+    printf("단계          횟수        합계(ms)   비율    평균(ns)    p50(ns)    p99(ns)\n");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        const PhaseCounter* c = &total[p];
+        if (c->count == 0) continue;
+
+        print_padded(phase_name((Phase)p), 10);
+        printf(" %10llu %14.3f %5.1f%% %11.0f %10.0f %10.0f\n", (unsigned long long)c->count,
+               (double)c->ticks / ticks_per_ns * 1e-6, 100.0 * (double)c->ticks / (double)all_ticks,
+               (double)c->ticks / ticks_per_ns / (double)c->count,
+               hist_quantile_ns(c, 0.5, ticks_per_ns), hist_quantile_ns(c, 0.99, ticks_per_ns));
+    }
+
+    if (g_scopes == NULL) {
+        return;
+    }
+
+    printf("\n[파일별 단계 시간 (ms)]\n");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        print_padded(phase_name((Phase)p), 10);
+        putchar(' ');
+    }
+    printf("파일\n");
+
+    for (PhaseScope* s = g_scopes; s != NULL; s = s->next) {
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            printf("%10.2f ", (double)s->phases[p].ticks / ticks_per_ns * 1e-6);
+        }
+        printf("%s\n", s->label);
+    }
+}
+
+#endif // CRYPTO_TEST_PHASES
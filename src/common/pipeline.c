@@ -0,0 +1,216 @@
+#include "../../include/common/pipeline.h"
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/perf_counters.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+static int g_default_workers = -1;
+
+int pipeline_default_workers(void) {
+    const char* env = getenv("CRYPTO_TEST_PIPELINE_WORKERS");
+    if (env != NULL && *env != '\0') {
+        int n = atoi(env);
+        return n > 0 ? n : 0;
+    }
+    if (g_default_workers >= 0) {
+        return g_default_workers;
+    }
+
+    // 읽기/출력 스레드 몫으로 코어 하나를 남김
+    int cpus = get_cpu_count();
+    return cpus > 1 ? cpus - 1 : 0;
+}
+
+void pipeline_set_default_workers(int workers) {
+    g_default_workers = workers;
+}
+
+// 첫 번째 오류만 기록
+static void set_status(Pipeline* pipe, int status) {
+    int expected = SUCCESS;
+    if (status != SUCCESS) {
+        __atomic_compare_exchange_n(&pipe->status, &expected, status, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+}
+
+bool pipeline_failed(Pipeline* pipe) {
+    return __atomic_load_n(&pipe->status, __ATOMIC_ACQUIRE) != SUCCESS;
+}
+
+static void* worker_main(void* arg) {
+    Pipeline* pipe = (Pipeline*)arg;
+    PHASE_THREAD_ATTACH(pipe->phase_scope);
+    perf_profile_set_label(pipe->perf_label);
+
+    for (;;) {
+        PipelineBatch* batch = (PipelineBatch*)lf_queue_pop(&pipe->work_queue);
+        if (batch == NULL) break;
+
+        if (!pipeline_failed(pipe) && batch->records.count > 0) {
+            set_status(pipe, pipe->config.compute(pipe->config.user, &batch->records, batch->results));
+        }
+        lf_queue_push(&pipe->done_queue, batch);
+    }
+
+    PHASE_THREAD_DETACH();
+    evp_cache_thread_cleanup();
+    return NULL;
+}
+
+/**
+ * 출력 스레드
+ * 완료 순서대로 도착한 배치를 seq 위치에 두고, 다음 순번이 채워지면 이어서 출력
+ */
+static void* writer_main(void* arg) {
+    Pipeline* pipe = (Pipeline*)arg;
+    size_t next = 0;
+    unsigned spins = 0;
+    PHASE_THREAD_ATTACH(pipe->phase_scope);
+
+    for (;;) {
+        void* item = NULL;
+        if (lf_queue_try_pop(&pipe->done_queue, &item)) {
+            PipelineBatch* batch = (PipelineBatch*)item;
+            pipe->reorder[batch->seq % pipe->pool_size] = batch;
+            spins = 0;
+
+            for (;;) {
+                PipelineBatch* ready = pipe->reorder[next % pipe->pool_size];
+                if (ready == NULL || ready->seq != next) break;
+
+                pipe->reorder[next % pipe->pool_size] = NULL;
+                if (!pipeline_failed(pipe) && ready->records.count > 0) {
+                    set_status(pipe, pipe->config.emit(pipe->config.user, &ready->records, ready->results));
+                }
+                record_batch_reset(&ready->records);
+                lf_queue_push(&pipe->free_queue, ready);
+                next++;
+            }
+            continue;
+        }
+
+        if (__atomic_load_n(&pipe->closed, __ATOMIC_ACQUIRE) &&
+            next == __atomic_load_n(&pipe->submitted, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+        lf_backoff(spins++);
+    }
+
+    PHASE_THREAD_DETACH();
+    return NULL;
+}
+
+static void free_pool(Pipeline* pipe) {
+    if (pipe->pool != NULL) {
+        for (size_t i = 0; i < pipe->pool_size; i++) {
+            record_batch_free(&pipe->pool[i].records);
+            free(pipe->pool[i].results);
+        }
+    }
+    free(pipe->pool);
+    free(pipe->reorder);
+    free(pipe->threads);
+    lf_queue_free(&pipe->free_queue);
+    lf_queue_free(&pipe->work_queue);
+    lf_queue_free(&pipe->done_queue);
+    pipe->pool = NULL;
+    pipe->reorder = NULL;
+    pipe->threads = NULL;
+}
+
+int pipeline_start(Pipeline* pipe, const PipelineConfig* config, int workers) {
+    memset(pipe, 0, sizeof(*pipe));
+    pipe->config = *config;
+    pipe->workers = workers > 0 ? workers : 0;
+    pipe->pool_size = pipe->workers > 0 ? (size_t)pipe->workers * 2 + 2 : 1;
+    pipe->status = SUCCESS;
+    pipe->perf_label = perf_profile_label();
+#ifdef CRYPTO_TEST_PHASES
+    pipe->phase_scope = phase_scope_current();
+#endif
+
+    pipe->pool = (PipelineBatch*)calloc(pipe->pool_size, sizeof(PipelineBatch));
+    pipe->reorder = (PipelineBatch**)calloc(pipe->pool_size, sizeof(PipelineBatch*));
+    pipe->threads = (pthread_t*)calloc((size_t)pipe->workers + 1, sizeof(pthread_t));
+    if (pipe->pool == NULL || pipe->reorder == NULL || pipe->threads == NULL ||
+        lf_queue_init(&pipe->free_queue, pipe->pool_size) != SUCCESS ||
+        lf_queue_init(&pipe->work_queue, pipe->pool_size + (size_t)pipe->workers) != SUCCESS ||
+        lf_queue_init(&pipe->done_queue, pipe->pool_size) != SUCCESS) {
+        free_pool(pipe);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    for (size_t i = 0; i < pipe->pool_size; i++) {
+        PipelineBatch* batch = &pipe->pool[i];
+        batch->results = (uint8_t*)malloc(config->batch_records * config->result_size + 1);
+        if (batch->results == NULL ||
+            record_batch_init(&batch->records, config->batch_records, config->columns,
+                              config->arena_block) != SUCCESS) {
+            free_pool(pipe);
+            return ERR_MEMORY_ALLOC;
+        }
+        lf_queue_push(&pipe->free_queue, batch);
+    }
+
+    // 스레드 생성에 실패하면 만든 만큼만 사용하고, 하나도 없으면 인라인 실행
+    int started = 0;
+    for (; started < pipe->workers; started++) {
+        if (pthread_create(&pipe->threads[started], NULL, worker_main, pipe) != 0) break;
+    }
+    if (started > 0 && pthread_create(&pipe->writer, NULL, writer_main, pipe) != 0) {
+        for (int i = 0; i < started; i++) {
+            lf_queue_push(&pipe->work_queue, NULL);
+        }
+        for (int i = 0; i < started; i++) {
+            pthread_join(pipe->threads[i], NULL);
+        }
+        started = 0;
+    }
+    pipe->workers = started;
+    return SUCCESS;
+}
+
+PipelineBatch* pipeline_acquire(Pipeline* pipe) {
+    PipelineBatch* batch = (PipelineBatch*)lf_queue_pop(&pipe->free_queue);
+    record_batch_reset(&batch->records);
+    return batch;
+}
+
+void pipeline_submit(Pipeline* pipe, PipelineBatch* batch) {
+    batch->seq = pipe->submitted;
+
+    // 인라인 실행
+    if (pipe->workers == 0) {
+        if (!pipeline_failed(pipe) && batch->records.count > 0) {
+            set_status(pipe, pipe->config.compute(pipe->config.user, &batch->records, batch->results));
+        }
+        if (!pipeline_failed(pipe) && batch->records.count > 0) {
+            set_status(pipe, pipe->config.emit(pipe->config.user, &batch->records, batch->results));
+        }
+        pipe->submitted++;
+        lf_queue_push(&pipe->free_queue, batch);
+        return;
+    }
+
+    __atomic_store_n(&pipe->submitted, pipe->submitted + 1, __ATOMIC_RELEASE);
+    lf_queue_push(&pipe->work_queue, batch);
+}
+
+int pipeline_finish(Pipeline* pipe) {
+    if (pipe->workers > 0) {
+        __atomic_store_n(&pipe->closed, true, __ATOMIC_RELEASE);
+        for (int i = 0; i < pipe->workers; i++) {
+            lf_queue_push(&pipe->work_queue, NULL);
+        }
+        for (int i = 0; i < pipe->workers; i++) {
+            pthread_join(pipe->threads[i], NULL);
+        }
+        pthread_join(pipe->writer, NULL);
+    }
+
+    int status = pipe->status;
+    free_pool(pipe);
+    return status;
+}
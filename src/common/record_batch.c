@@ -0,0 +1,108 @@
+#include "../../include/common/record_batch.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+int record_batch_init(RecordBatch* batch, size_t capacity, size_t columns, size_t arena_block) {
+    memset(batch, 0, sizeof(*batch));
+    if (capacity == 0 || columns == 0 || columns > RECORD_BATCH_MAX_COLUMNS) {
+        return ERR_INVALID_INPUT;
+    }
+
+    size_t per_column = sizeof(long long) + sizeof(StrView) + sizeof(const uint8_t*) + sizeof(size_t);
+    uint8_t* storage = (uint8_t*)calloc(columns, per_column * capacity);
+    if (storage == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    // 열 배열을 한 블록 안에 순서대로 배치 (모두 8바이트 정렬)
+    uint8_t* p = storage;
+    for (size_t c = 0; c < columns; c++) {
+        batch->num[c] = (long long*)p;
+        p += sizeof(long long) * capacity;
+        batch->text[c] = (StrView*)p;
+        p += sizeof(StrView) * capacity;
+        batch->data[c] = (const uint8_t**)p;
+        p += sizeof(const uint8_t*) * capacity;
+        batch->len[c] = (size_t*)p;
+        p += sizeof(size_t) * capacity;
+    }
+
+    batch->storage = storage;
+    batch->capacity = capacity;
+    batch->columns = columns;
+    arena_init(&batch->arena, arena_block);
+    return SUCCESS;
+}
+
+void record_batch_free(RecordBatch* batch) {
+    arena_free(&batch->arena);
+    free(batch->storage);
+    memset(batch, 0, sizeof(*batch));
+}
+
+void record_batch_reset(RecordBatch* batch) {
+    batch->count = 0;
+    arena_reset(&batch->arena);
+}
+
+size_t record_batch_push(RecordBatch* batch) {
+    if (batch->count >= batch->capacity) {
+        return batch->capacity;
+    }
+
+    size_t i = batch->count++;
+    for (size_t c = 0; c < batch->columns; c++) {
+        batch->num[c][i] = 0;
+        batch->text[c][i].ptr = NULL;
+        batch->text[c][i].len = 0;
+        batch->data[c][i] = NULL;
+        batch->len[c][i] = 0;
+    }
+    return i;
+}
+
+int record_batch_set_hex(RecordBatch* batch, size_t index, size_t column, StrView hex, size_t out_cap) {
+    uint8_t* out = (uint8_t*)arena_alloc(&batch->arena, out_cap);
+    if (out == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    size_t out_len = 0;
+    PHASE_START(hex_mark);
+    int ret = hex_decode(hex.ptr, hex.len, out, out_cap, &out_len);
+    PHASE_STOP(hex_mark, PHASE_HEX);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    batch->text[column][index] = hex;
+    batch->data[column][index] = out;
+    batch->len[column][index] = out_len;
+    return SUCCESS;
+}
+
+// 빈 값이 가리킬 자리 (data가 NULL이면 스트리밍 레코드로 취급하므로)
+static const uint8_t EMPTY_VALUE[1] = { 0 };
+
+int record_batch_set_hex_exact(RecordBatch* batch, size_t index, size_t column, StrView hex, size_t len) {
+    if (len == 0) {
+        if (hex.len != 0 && !strview_eq(hex, "00")) {
+            return ERR_INVALID_FORMAT;
+        }
+        batch->text[column][index] = hex;
+        batch->data[column][index] = EMPTY_VALUE;
+        batch->len[column][index] = 0;
+        return SUCCESS;
+    }
+    if (hex.len / 2 != len) {
+        return ERR_INVALID_FORMAT;
+    }
+
+    int ret = record_batch_set_hex(batch, index, column, hex, len);
+    if (ret == SUCCESS && batch->len[column][index] != len) {
+        ret = ERR_INVALID_FORMAT;
+    }
+    return ret;
+}
@@ -0,0 +1,247 @@
+#include "../../include/common/record_index.h"
+#include "../../include/common/vector_cache.h"
+#include "../../include/common/response_writer.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+// 앞뒤 공백을 뺀 [start, end) 복사 (버퍼를 넘으면 false)
+static bool copy_trimmed(char* dst, size_t size, const char* start, const char* end) {
+    while (start < end && isspace((unsigned char)*start)) start++;
+    while (end > start && isspace((unsigned char)end[-1])) end--;
+
+    size_t len = (size_t)(end - start);
+    if (len == 0 || len >= size) {
+        return false;
+    }
+    memcpy(dst, start, len);
+    dst[len] = '\0';
+    return true;
+}
+
+static bool parse_index(const char* start, const char* end, size_t* value) {
+    StrView view = { start, (size_t)(end - start) };
+    bool ok = false;
+    long long n = strview_to_ll(view, &ok);
+    if (!ok || n <= 0) {
+        return false;
+    }
+    *value = (size_t)n;
+    return true;
+}
+
+int record_selector_parse(const char* spec, RecordSelector* selector) {
+    memset(selector, 0, sizeof(*selector));
+    if (spec == NULL || *spec == '\0') {
+        return ERR_INVALID_INPUT;
+    }
+
+    const char* term = spec;
+    while (*term != '\0') {
+        const char* end = strchr(term, ',');
+        if (end == NULL) end = term + strlen(term);
+
+        const char* eq = memchr(term, '=', (size_t)(end - term));
+        if (eq != NULL) {
+            if (selector->condition_count == RECORD_SELECTOR_MAX_TERMS) return ERR_INVALID_INPUT;
+
+            RecordCondition* cond = &selector->conditions[selector->condition_count++];
+            if (!copy_trimmed(cond->key, sizeof(cond->key), term, eq) ||
+                !copy_trimmed(cond->value, sizeof(cond->value), eq + 1, end)) {
+                return ERR_INVALID_INPUT;
+            }
+        } else {
+            if (selector->range_count == RECORD_SELECTOR_MAX_TERMS) return ERR_INVALID_INPUT;
+
+            RecordRange* range = &selector->ranges[selector->range_count++];
+            const char* dash = memchr(term, '-', (size_t)(end - term));
+            if (!parse_index(term, dash ? dash : end, &range->first)) return ERR_INVALID_INPUT;
+
+            range->last = range->first;
+            if (dash != NULL && (!parse_index(dash + 1, end, &range->last) || range->last < range->first)) {
+                return ERR_INVALID_INPUT;
+            }
+        }
+
+        term = *end ? end + 1 : end;
+    }
+    return SUCCESS;
+}
+
+// 조건 값과 필드 값 비교 (16진수는 디코딩해서, 대소문자 무관)
+static bool condition_match(const RecordCondition* cond, const DecodedVectors* decoded, size_t record) {
+    int field = vector_schema_field(decoded->schema, cond->key);
+    if (field < 0) {
+        return false;
+    }
+
+    const SchemaValue* value = decoded_value(decoded, record, field);
+    if (!value->present) {
+        return false;
+    }
+
+    const SchemaField* def = &decoded->schema->fields[field];
+    const uint8_t* bytes = decoded_bytes(decoded, value);
+    size_t cond_len = strlen(cond->value);
+
+    if (def->kind == SCHEMA_INT) {
+        StrView view = { cond->value, cond_len };
+        bool ok = false;
+        long long n = strview_to_ll(view, &ok);
+        return ok && n == value->num;
+    }
+    if (def->kind == SCHEMA_TEXT) {
+        return value->len == cond_len && memcmp(bytes, cond->value, cond_len) == 0;
+    }
+
+    // 원문만 기록한 큰 값은 조건 값 최대 길이보다 길어 일치할 수 없음
+    if (decoded_text_only(value)) {
+        return false;
+    }
+
+    uint8_t expected[RECORD_SELECTOR_MAX_VALUE / 2];
+    size_t expected_len = 0;
+    return hex_decode(cond->value, cond_len, expected, sizeof(expected), &expected_len) == SUCCESS &&
+           expected_len == value->len && memcmp(bytes, expected, expected_len) == 0;
+}
+
+bool record_selector_match(const RecordSelector* selector, const DecodedVectors* decoded, size_t record) {
+    if (selector->range_count > 0) {
+        bool in_range = false;
+        for (size_t i = 0; i < selector->range_count && !in_range; i++) {
+            in_range = record + 1 >= selector->ranges[i].first && record + 1 <= selector->ranges[i].last;
+        }
+        if (!in_range) return false;
+    }
+
+    for (size_t i = 0; i < selector->condition_count; i++) {
+        if (!condition_match(&selector->conditions[i], decoded, record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 선택한 레코드 앞에 다시 써야 하는 섹션/이어지는 값 줄
+typedef struct {
+    StrView* lines;
+    size_t count;
+    size_t capacity;
+} ContextLines;
+
+static int context_push(ContextLines* context, StrView line) {
+    if (context->count == context->capacity) {
+        size_t cap = context->capacity ? context->capacity * 2 : 16;
+        StrView* grown = (StrView*)realloc(context->lines, cap * sizeof(StrView));
+        if (grown == NULL) {
+            return ERR_MEMORY_ALLOC;
+        }
+        context->lines = grown;
+        context->capacity = cap;
+    }
+    context->lines[context->count++] = line;
+    return SUCCESS;
+}
+
+static bool is_sticky_field(const VectorSchema* schema, const VecToken* token) {
+    for (size_t f = 0; f < schema->field_count; f++) {
+        if ((schema->fields[f].flags & SCHEMA_FLAG_STICKY) && strview_eq(token->key, schema->fields[f].key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 레코드 사이 텍스트에서 섹션/이어지는 값 줄을 모음
+ * 섹션 줄이 있으면 새 섹션 묶음이므로 이전에 모은 줄은 버림 (디코더의 섹션 처리와 같은 규칙)
+ * echo가 있으면 주석/빈 줄 등 나머지 줄은 바로 기록 (헤더용)
+ */
+static int collect_context(const VectorSchema* schema, const char* text, size_t len,
+                           ContextLines* context, ResponseWriter* echo) {
+    VectorReader gap;
+    VecToken token;
+    bool reset = false;
+    int ret = SUCCESS;
+
+    vector_reader_init_buffer(&gap, text, len);
+    while (ret == SUCCESS && vector_reader_next(&gap, &token)) {
+        if (token.type == VEC_TOKEN_SECTION) {
+            if (!reset) {
+                context->count = 0;
+                reset = true;
+            }
+            ret = context_push(context, token.line);
+        } else if (token.type == VEC_TOKEN_FIELD && is_sticky_field(schema, &token)) {
+            ret = context_push(context, token.line);
+        } else if (echo != NULL) {
+            rw_write(echo, token.line.ptr, token.line.len);
+            rw_putc(echo, '\n');
+        }
+    }
+    return ret;
+}
+
+int record_index_extract(const char* input_path, const char* output_path, const RecordSelector* selector,
+                         size_t* selected, size_t* total) {
+    if (selected != NULL) *selected = 0;
+    if (total != NULL) *total = 0;
+
+    const VectorSchema* schema = vector_schema_for_file(input_path);
+    if (schema == NULL) {
+        return ERR_INVALID_FORMAT;
+    }
+
+    VectorCache cache;
+    int ret = vector_cache_open(&cache, schema, input_path);
+    if (ret != SUCCESS) {
+        return ret == ERR_FILE_OPEN || ret == ERR_FILE_READ ? ERR_FILE_OPEN : ERR_INVALID_FORMAT;
+    }
+
+    ResponseWriter out;
+    if (response_writer_open(&out, output_path) != SUCCESS) {
+        vector_cache_close(&cache);
+        return ERR_FILE_CREATE;
+    }
+
+    const DecodedVectors* decoded = &cache.vectors;
+    const char* source = cache.source.data;
+    ContextLines context = { NULL, 0, 0 };
+    size_t count = 0;
+
+    // 헤더: 주석은 바로 기록하고 섹션 줄은 첫 선택 레코드 앞에 기록
+    ret = collect_context(schema, source, (size_t)decoded->header_len, &context, &out);
+    uint64_t gap_start = decoded->header_len;
+
+    for (size_t r = 0; r < decoded->count && ret == SUCCESS; r++) {
+        const SchemaSpan* span = &decoded->spans[r];
+        if (r > 0) {
+            ret = collect_context(schema, source + gap_start, (size_t)(span->start - gap_start), &context, NULL);
+        }
+        gap_start = span->end;
+
+        if (ret != SUCCESS || !record_selector_match(selector, decoded, r)) continue;
+
+        for (size_t i = 0; i < context.count; i++) {
+            rw_write(&out, context.lines[i].ptr, context.lines[i].len);
+            rw_puts(&out, "\n\n");
+        }
+        context.count = 0;
+
+        size_t len = (size_t)(span->end - span->start);
+        rw_write(&out, source + span->start, len);
+        rw_puts(&out, len > 0 && source[span->start + len - 1] == '\n' ? "\n" : "\n\n");
+        count++;
+    }
+
+    size_t record_count = decoded->count;
+    free(context.lines);
+    vector_cache_close(&cache);
+    if (response_writer_close(&out) != SUCCESS && ret == SUCCESS) {
+        ret = ERR_FILE_WRITE;
+    }
+
+    if (selected != NULL) *selected = count;
+    if (total != NULL) *total = record_count;
+    return ret;
+}
@@ -0,0 +1,236 @@
+#include "../../include/common/response_writer.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define rw_sys_open(path) _open((path), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644)
+#define rw_sys_write(fd, p, n) _write((fd), (p), (unsigned int)(n))
+#define rw_sys_close(fd) _close(fd)
+#else
+#include <unistd.h>
+#define rw_sys_open(path) open((path), O_WRONLY | O_CREAT | O_TRUNC, 0644)
+#define rw_sys_write(fd, p, n) write((fd), (p), (n))
+#define rw_sys_close(fd) close(fd)
+#endif
+
+// 한 번의 write 호출 최대 크기
+#define RW_MAX_WRITE (1u << 30)
+
+// 파일에 그대로 기록
+static void write_raw(ResponseWriter* writer, const char* data, size_t len) {
+    while (len > 0 && writer->error == SUCCESS) {
+        size_t chunk = len < RW_MAX_WRITE ? len : RW_MAX_WRITE;
+        long written = (long)rw_sys_write(writer->fd, data, chunk);
+
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            writer->error = ERR_FILE_WRITE;
+            return;
+        }
+        data += written;
+        len -= (size_t)written;
+    }
+}
+
+// 압축기 출력 콜백
+static int emit_compressed(void* ctx, const uint8_t* data, size_t len) {
+    ResponseWriter* writer = (ResponseWriter*)ctx;
+    write_raw(writer, (const char*)data, len);
+    return writer->error;
+}
+
+// 버퍼를 거치지 않고 전부 기록 (압축 출력이면 압축기를 거침)
+static void write_all(ResponseWriter* writer, const char* data, size_t len) {
+    PHASE_START(io_mark);
+    if (writer->sink == NULL) {
+        write_raw(writer, data, len);
+    } else if (writer->error == SUCCESS) {
+        int ret = compress_sink_write((CompressSink*)writer->sink, data, len, false, emit_compressed, writer);
+        if (ret != SUCCESS && writer->error == SUCCESS) {
+            writer->error = ret;
+        }
+    }
+    PHASE_STOP(io_mark, PHASE_IO);
+}
+
+// 압축 스트림 마무리
+static void finish_sink(ResponseWriter* writer) {
+    CompressSink* sink = (CompressSink*)writer->sink;
+    if (sink == NULL) {
+        return;
+    }
+
+    if (writer->error == SUCCESS) {
+        int ret = compress_sink_write(sink, NULL, 0, true, emit_compressed, writer);
+        if (ret != SUCCESS && writer->error == SUCCESS) {
+            writer->error = ret;
+        }
+    }
+    compress_sink_free(sink);
+    free(sink);
+    writer->sink = NULL;
+}
+
+static int open_writer(ResponseWriter* writer, const char* path, CompressionKind kind) {
+    memset(writer, 0, sizeof(*writer));
+    writer->fd = -1;
+
+    writer->buf = (char*)malloc(RESPONSE_WRITER_BUFFER_SIZE);
+    if (writer->buf == NULL) {
+        return ERR_MEMORY_ALLOC;
+    }
+
+    if (kind != COMPRESSION_NONE) {
+        CompressSink* sink = (CompressSink*)malloc(sizeof(CompressSink));
+        int ret = sink ? compress_sink_init(sink, kind) : ERR_MEMORY_ALLOC;
+        if (ret != SUCCESS) {
+            free(sink);
+            free(writer->buf);
+            writer->buf = NULL;
+            return ret;
+        }
+        writer->sink = sink;
+    }
+
+    writer->fd = rw_sys_open(path);
+    if (writer->fd < 0) {
+        if (writer->sink) {
+            compress_sink_free((CompressSink*)writer->sink);
+            free(writer->sink);
+            writer->sink = NULL;
+        }
+        free(writer->buf);
+        writer->buf = NULL;
+        return ERR_FILE_CREATE;
+    }
+
+    writer->cap = RESPONSE_WRITER_BUFFER_SIZE;
+    writer->error = SUCCESS;
+    return SUCCESS;
+}
+
+int response_writer_open(ResponseWriter* writer, const char* path) {
+    return open_writer(writer, path, compression_kind_for_path(path));
+}
+
+int response_writer_open_raw(ResponseWriter* writer, const char* path) {
+    return open_writer(writer, path, COMPRESSION_NONE);
+}
+
+int response_writer_flush(ResponseWriter* writer) {
+    if (writer->len > 0) {
+        write_all(writer, writer->buf, writer->len);
+        writer->len = 0;
+    }
+    return writer->error;
+}
+
+int response_writer_close(ResponseWriter* writer) {
+    if (writer->fd < 0) {
+        return writer->error;
+    }
+
+    response_writer_flush(writer);
+    finish_sink(writer);
+    if (rw_sys_close(writer->fd) != 0 && writer->error == SUCCESS) {
+        writer->error = ERR_FILE_WRITE;
+    }
+
+    int ret = writer->error;
+    free(writer->buf);
+    memset(writer, 0, sizeof(*writer));
+    writer->fd = -1;
+    return ret;
+}
+
+// 버퍼에 최소 n바이트 공간 확보 (n은 버퍼 크기 이하)
+static inline char* reserve(ResponseWriter* writer, size_t n) {
+    if (writer->cap - writer->len < n) {
+        response_writer_flush(writer);
+    }
+    return writer->buf + writer->len;
+}
+
+/**
+ * 원시 데이터 기록
+ * 버퍼보다 큰 데이터는 버퍼를 비운 뒤 직접 기록
+ */
+void rw_write(ResponseWriter* writer, const char* data, size_t len) {
+    if (len >= writer->cap) {
+        response_writer_flush(writer);
+        write_all(writer, data, len);
+        return;
+    }
+
+    memcpy(reserve(writer, len), data, len);
+    writer->len += len;
+}
+
+void rw_puts(ResponseWriter* writer, const char* str) {
+    rw_write(writer, str, strlen(str));
+}
+
+void rw_putc(ResponseWriter* writer, char ch) {
+    *reserve(writer, 1) = ch;
+    writer->len++;
+}
+
+/**
+ * 16진수 인코딩 결과를 버퍼에 직접 기록 (중간 문자열 없음)
+ */
+void rw_hex(ResponseWriter* writer, const uint8_t* bytes, size_t len) {
+    size_t max_bytes = writer->cap / 2;
+
+    while (len > 0) {
+        size_t n = len < max_bytes ? len : max_bytes;
+        hex_encode(bytes, n, reserve(writer, n * 2));
+        writer->len += n * 2;
+        bytes += n;
+        len -= n;
+    }
+}
+
+void rw_int(ResponseWriter* writer, long long value) {
+    char tmp[24];
+    size_t pos = sizeof(tmp);
+    unsigned long long v = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+
+    do {
+        tmp[--pos] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    if (value < 0) {
+        tmp[--pos] = '-';
+    }
+
+    rw_write(writer, tmp + pos, sizeof(tmp) - pos);
+}
+
+// "key = " 기록
+static void write_key(ResponseWriter* writer, const char* key) {
+    rw_puts(writer, key);
+    rw_write(writer, " = ", 3);
+}
+
+void rw_field_hex(ResponseWriter* writer, const char* key, const uint8_t* bytes, size_t len) {
+    write_key(writer, key);
+    rw_hex(writer, bytes, len);
+    rw_putc(writer, '\n');
+}
+
+void rw_field_int(ResponseWriter* writer, const char* key, long long value) {
+    write_key(writer, key);
+    rw_int(writer, value);
+    rw_putc(writer, '\n');
+}
+
+void rw_field_str(ResponseWriter* writer, const char* key, const char* value, size_t value_len) {
+    write_key(writer, key);
+    rw_write(writer, value, value_len);
+    rw_putc(writer, '\n');
+}
@@ -0,0 +1,137 @@
+#include "../../include/common/result_cache.h"
+#include "../../include/common/vector_cache.h"
+#include "../../include/common/vector_reader.h"
+#include "../../include/common/response_writer.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <openssl/opensslv.h>
+
+#ifdef _WIN32
+#include <process.h>
+#define get_pid _getpid
+#else
+#include <unistd.h>
+#define get_pid getpid
+#endif
+
+// 임시 파일 이름 구분용
+static unsigned g_temp_counter = 0;
+
+const char* result_cache_build_id(void) {
+#ifdef __VERSION__
+    return __DATE__ " " __TIME__ " " __VERSION__ " " OPENSSL_VERSION_TEXT;
+#else
+    return __DATE__ " " __TIME__ " " OPENSSL_VERSION_TEXT;
+#endif
+}
+
+// 파일 내용 해시 (파일이 없으면 false, 압축 파일은 압축된 바이트 그대로)
+static bool hash_file(const char* path, uint8_t hash[32]) {
+    VectorReader reader;
+    if (path == NULL || vector_reader_open_raw(&reader, path) != SUCCESS) {
+        return false;
+    }
+
+    int ret = vector_cache_content_hash(reader.data, reader.size, hash);
+    vector_reader_close(&reader);
+    return ret == SUCCESS;
+}
+
+int result_cache_key(const char* request_path, const char* expected_path, const char* backend_id,
+                     ResultCacheKey* key) {
+    // 요청 해시 | 정답 해시 | 백엔드 \0 빌드 지문
+    uint8_t material[64 + 2 * MAX_LINE_LENGTH];
+    memset(material, 0, 64);
+
+    if (!hash_file(request_path, material)) {
+        return ERR_FILE_OPEN;
+    }
+    hash_file(expected_path, material + 32);
+
+    const char* build_id = result_cache_build_id();
+    size_t backend_len = strlen(backend_id);
+    size_t build_len = strlen(build_id);
+    if (backend_len >= MAX_LINE_LENGTH || build_len >= MAX_LINE_LENGTH) {
+        return ERR_INVALID_INPUT;
+    }
+
+    memcpy(material + 64, backend_id, backend_len + 1);
+    memcpy(material + 64 + backend_len + 1, build_id, build_len);
+    return vector_cache_content_hash(material, 64 + backend_len + 1 + build_len, key->digest);
+}
+
+/**
+ * <캐시 디렉토리>/results/<키>.<pass|gen>.rsp[.gz|.zst]
+ * 항목은 응답 파일과 같은 형식으로 보관해 압축을 다시 풀거나 하지 않고 그대로 복사
+ */
+static bool entry_path(char* path, size_t size, const ResultCacheKey* key, ResultCacheVerdict verdict,
+                       const char* output_path) {
+    const char* dir = vector_cache_dir();
+    if (dir == NULL) {
+        return false;
+    }
+
+    char key_hex[sizeof(key->digest) * 2 + 1];
+    hex_encode(key->digest, sizeof(key->digest), key_hex);
+    key_hex[sizeof(key_hex) - 1] = '\0';
+
+    int n = snprintf(path, size, "%s/%s/%s.%s.rsp%s", dir, RESULT_CACHE_SUBDIR, key_hex,
+                     verdict == RESULT_CACHE_PASSED ? "pass" : "gen",
+                     compression_suffix(compression_kind_for_path(output_path)));
+    return n > 0 && (size_t)n < size;
+}
+
+static int copy_file(const char* src, const char* dst) {
+    VectorReader reader;
+    if (vector_reader_open_raw(&reader, src) != SUCCESS) {
+        return ERR_FILE_OPEN;
+    }
+
+    ResponseWriter out;
+    if (response_writer_open_raw(&out, dst) != SUCCESS) {
+        vector_reader_close(&reader);
+        return ERR_FILE_CREATE;
+    }
+
+    rw_write(&out, reader.data, reader.size);
+    vector_reader_close(&reader);
+    return response_writer_close(&out);
+}
+
+ResultCacheVerdict result_cache_lookup(const ResultCacheKey* key, const char* output_path) {
+    static const ResultCacheVerdict verdicts[] = { RESULT_CACHE_PASSED, RESULT_CACHE_GENERATED };
+    char path[MAX_PATH_LENGTH * 2];
+
+    for (size_t i = 0; i < sizeof(verdicts) / sizeof(verdicts[0]); i++) {
+        if (entry_path(path, sizeof(path), key, verdicts[i], output_path) && file_exists(path) &&
+            copy_file(path, output_path) == SUCCESS) {
+            return verdicts[i];
+        }
+    }
+    return RESULT_CACHE_MISS;
+}
+
+/**
+ * 응답 파일을 캐시에 복사
+ * 임시 파일에 쓴 뒤 이름을 바꾸므로 다른 작업이 반쯤 쓴 항목을 읽지 않음
+ */
+void result_cache_store(const ResultCacheKey* key, const char* output_path, ResultCacheVerdict verdict) {
+    char path[MAX_PATH_LENGTH * 2], dir[MAX_PATH_LENGTH * 2], temp_path[MAX_PATH_LENGTH * 2 + 32];
+    if (verdict == RESULT_CACHE_MISS || !entry_path(path, sizeof(path), key, verdict, output_path)) {
+        return;
+    }
+
+    int n = snprintf(dir, sizeof(dir), "%s/%s", vector_cache_dir(), RESULT_CACHE_SUBDIR);
+    if (n <= 0 || (size_t)n >= sizeof(dir) || create_directory(dir) != SUCCESS) {
+        return;
+    }
+
+    unsigned id = __atomic_fetch_add(&g_temp_counter, 1, __ATOMIC_RELAXED);
+    snprintf(temp_path, sizeof(temp_path), "%s.%d.%u.tmp", path, (int)get_pid(), id);
+
+    if (copy_file(output_path, temp_path) != SUCCESS || rename(temp_path, path) != 0) {
+        remove(temp_path);
+    }
+}
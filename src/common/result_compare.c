@@ -0,0 +1,414 @@
+#include "../../include/common/result_compare.h"
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/vector_cache.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <stdarg.h>
+
+// 키 -> 값 해시 테이블 (값 0은 빈 칸)
+typedef struct {
+    uint64_t* keys;
+    size_t* values;
+    size_t mask;
+} KeyMap;
+
+static int key_map_init(KeyMap* map, size_t count) {
+    size_t cap = 16;
+    while (cap < count * 2) cap *= 2;
+
+    map->keys = (uint64_t*)malloc(cap * sizeof(uint64_t));
+    map->values = (size_t*)calloc(cap, sizeof(size_t));
+    map->mask = cap - 1;
+    if (map->keys == NULL || map->values == NULL) {
+        free(map->keys);
+        free(map->values);
+        return ERR_MEMORY_ALLOC;
+    }
+    return SUCCESS;
+}
+
+static void key_map_free(KeyMap* map) {
+    free(map->keys);
+    free(map->values);
+}
+
+// 키의 칸 (없으면 값이 0인 빈 칸)
+static size_t* key_map_slot(KeyMap* map, uint64_t key) {
+    size_t i = (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 17) & map->mask;
+    while (map->values[i] != 0 && map->keys[i] != key) {
+        i = (i + 1) & map->mask;
+    }
+    map->keys[i] = key;
+    return &map->values[i];
+}
+
+static uint64_t fnv_mix(uint64_t hash, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static uint64_t mix_value(uint64_t hash, const DecodedVectors* d, int field, const SchemaValue* value) {
+    hash = fnv_mix(hash, &field, sizeof(field));
+    hash = fnv_mix(hash, &value->present, sizeof(value->present));
+    if (d->schema->fields[field].kind == SCHEMA_INT) {
+        return fnv_mix(hash, &value->num, sizeof(value->num));
+    }
+    if (!decoded_text_only(value)) {
+        return fnv_mix(hash, decoded_bytes(d, value), value->len);
+    }
+
+    // 원문만 기록한 큰 값은 청크 단위로 디코딩하며 누적
+    uint8_t chunk[4096];
+    for (size_t pos = 0; pos < value->len; pos += sizeof(chunk)) {
+        size_t n = value->len - pos < sizeof(chunk) ? value->len - pos : sizeof(chunk);
+        const uint8_t* bytes = decoded_bytes_chunk(d, value, pos, n, chunk);
+        if (bytes == NULL) {
+            break;
+        }
+        hash = fnv_mix(hash, bytes, n);
+    }
+    return hash;
+}
+
+static bool is_key_param(const SchemaField* field) {
+    return (field->flags & (SCHEMA_FLAG_SECTION | SCHEMA_FLAG_SECTION_NAME | SCHEMA_FLAG_STICKY)) != 0;
+}
+
+// 레코드의 기준 필드 (처음으로 값이 있는 시작 필드, 없으면 -1)
+static int record_key_field(const DecodedVectors* d, size_t record) {
+    for (size_t f = 0; f < d->field_count; f++) {
+        if ((d->schema->fields[f].flags & SCHEMA_FLAG_START) && decoded_value(d, record, (int)f)->present) {
+            return (int)f;
+        }
+    }
+    return -1;
+}
+
+// 키 값 하나 비교 (둘 다 없으면 같음)
+static bool key_value_equal(const SchemaField* def, const DecodedVectors* a, const SchemaValue* va,
+                            const DecodedVectors* b, const SchemaValue* vb) {
+    if (va->present != vb->present) {
+        return false;
+    }
+    if (!va->present) {
+        return true;
+    }
+    if (def->kind == SCHEMA_INT) {
+        return va->num == vb->num;
+    }
+    return decoded_bytes_equal(a, va, b, vb);
+}
+
+// 두 레코드의 섹션/이어지는 값과 기준 필드 값이 모두 같은지 (해시가 같을 때 확인용)
+static bool record_keys_equal(const DecodedVectors* a, size_t ra, const DecodedVectors* b, size_t rb) {
+    for (size_t f = 0; f < a->field_count; f++) {
+        const SchemaField* def = &a->schema->fields[f];
+        if (is_key_param(def) &&
+            !key_value_equal(def, a, decoded_value(a, ra, (int)f), b, decoded_value(b, rb, (int)f))) {
+            return false;
+        }
+    }
+
+    int key_a = record_key_field(a, ra);
+    int key_b = record_key_field(b, rb);
+    if (key_a != key_b) {
+        return false;
+    }
+    return key_a < 0 || key_value_equal(&a->schema->fields[key_a], a, decoded_value(a, ra, key_a),
+                                        b, decoded_value(b, rb, key_a));
+}
+
+/**
+ * 레코드 정렬 키 계산
+ * 섹션/이어지는 값과 기준 필드 값의 해시에, 같은 키가 앞에서 몇 번 나왔는지(순번)를 섞음
+ * 순번은 해시가 같은 앞 레코드 중 키 값까지 같은 레코드로 셈 (해시 충돌이 순번을 밀지 않도록)
+ */
+static int compute_keys(const DecodedVectors* d, uint64_t* keys) {
+    KeyMap seen;
+    size_t* prev = (size_t*)malloc((d->count + 1) * sizeof(size_t));          // 해시가 같은 앞 레코드 + 1
+    size_t* occurrence = (size_t*)malloc((d->count + 1) * sizeof(size_t));
+    if (prev == NULL || occurrence == NULL || key_map_init(&seen, d->count) != SUCCESS) {
+        free(prev);
+        free(occurrence);
+        return ERR_MEMORY_ALLOC;
+    }
+
+    for (size_t r = 0; r < d->count; r++) {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        for (size_t f = 0; f < d->field_count; f++) {
+            if (is_key_param(&d->schema->fields[f])) {
+                hash = mix_value(hash, d, (int)f, decoded_value(d, r, (int)f));
+            }
+        }
+
+        int key_field = record_key_field(d, r);
+        if (key_field >= 0) {
+            hash = mix_value(hash, d, key_field, decoded_value(d, r, key_field));
+        }
+
+        size_t* last = key_map_slot(&seen, hash);
+        size_t same = *last;
+        while (same != 0 && !record_keys_equal(d, same - 1, d, r)) {
+            same = prev[same - 1];
+        }
+        occurrence[r] = same != 0 ? occurrence[same - 1] + 1 : 1;
+        prev[r] = *last;
+        *last = r + 1;
+        keys[r] = fnv_mix(hash, &occurrence[r], sizeof(occurrence[r]));
+    }
+
+    key_map_free(&seen);
+    free(prev);
+    free(occurrence);
+    return SUCCESS;
+}
+
+// 보고서에 서식 문자열 추가
+static void report_printf(CompareReport* report, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+    if (n <= 0) return;
+
+    size_t need = report->diff_len + (size_t)n + 1;
+    if (need > report->diff_cap) {
+        size_t cap = report->diff_cap ? report->diff_cap : 1024;
+        while (cap < need) cap *= 2;
+        char* grown = (char*)realloc(report->diff, cap);
+        if (grown == NULL) return;
+        report->diff = grown;
+        report->diff_cap = cap;
+    }
+
+    va_start(args, fmt);
+    vsnprintf(report->diff + report->diff_len, report->diff_cap - report->diff_len, fmt, args);
+    va_end(args);
+    report->diff_len += (size_t)n;
+}
+
+// 값 하나를 보고서에 출력 (긴 바이트 값은 앞부분만)
+static void report_value(CompareReport* report, const DecodedVectors* d, int field, const SchemaValue* value) {
+    const SchemaField* def = &d->schema->fields[field];
+
+    if (!value->present) {
+        report_printf(report, "(없음)");
+    } else if (def->kind == SCHEMA_INT) {
+        report_printf(report, "%lld", (long long)value->num);
+    } else if (def->kind == SCHEMA_TEXT) {
+        report_printf(report, "%.*s", (int)value->len, (const char*)decoded_bytes(d, value));
+    } else {
+        char hex[COMPARE_MAX_VALUE_HEX + 1];
+        uint8_t buf[COMPARE_MAX_VALUE_HEX / 2];
+        size_t shown = value->len < COMPARE_MAX_VALUE_HEX / 2 ? value->len : COMPARE_MAX_VALUE_HEX / 2;
+        const uint8_t* bytes = decoded_bytes_chunk(d, value, 0, shown, buf);
+        if (bytes == NULL) {
+            report_printf(report, "(형식 오류)");
+            return;
+        }
+        hex_encode(bytes, shown, hex);
+        hex[shown * 2] = '\0';
+        report_printf(report, shown < value->len ? "%s... (%u바이트)" : "%s", hex, value->len);
+    }
+}
+
+// 레코드 위치 출력: "[섹션 값] 기준 필드 = 값"
+static void report_location(CompareReport* report, const DecodedVectors* d, size_t record) {
+    bool open = false;
+    for (size_t f = 0; f < d->field_count; f++) {
+        const SchemaField* def = &d->schema->fields[f];
+        const SchemaValue* value = decoded_value(d, record, (int)f);
+        if (!(def->flags & (SCHEMA_FLAG_SECTION | SCHEMA_FLAG_SECTION_NAME)) || !value->present) continue;
+
+        report_printf(report, open ? ", " : "[");
+        if (def->flags & SCHEMA_FLAG_SECTION) {
+            report_printf(report, "%s = ", def->key);
+        }
+        report_value(report, d, (int)f, value);
+        open = true;
+    }
+    if (open) {
+        report_printf(report, "] ");
+    }
+
+    int key_field = record_key_field(d, record);
+    if (key_field >= 0) {
+        report_printf(report, "%s = ", d->schema->fields[key_field].key);
+        report_value(report, d, key_field, decoded_value(d, record, key_field));
+    }
+}
+
+// 필드 값 비교 (바이트 값은 디코딩된 바이트로)
+static bool values_equal(const SchemaField* def, const DecodedVectors* out, const SchemaValue* a,
+                         const DecodedVectors* exp, const SchemaValue* b) {
+    if (!a->present) {
+        return false;
+    }
+    if (def->kind == SCHEMA_INT) {
+        return a->num == b->num;
+    }
+    if (def->flags & SCHEMA_FLAG_VERDICT) {
+        return a->len > 0 && b->len > 0 && decoded_bytes(out, a)[0] == decoded_bytes(exp, b)[0];
+    }
+    return decoded_bytes_equal(out, a, exp, b);
+}
+
+/**
+ * 짝지은 두 레코드의 필드 비교
+ * 정답 레코드에 있는 값만 비교하고, 다른 필드는 상세 보고 대상이면 보고서에 기록
+ */
+static bool compare_records(CompareReport* report, bool detail, const DecodedVectors* out, size_t out_rec,
+                            const DecodedVectors* exp, size_t exp_rec) {
+    bool same = true;
+
+    for (size_t f = 0; f < exp->field_count; f++) {
+        const SchemaField* def = &exp->schema->fields[f];
+        const SchemaValue* expected = decoded_value(exp, exp_rec, (int)f);
+        const SchemaValue* actual = decoded_value(out, out_rec, (int)f);
+        if (is_key_param(def) || !expected->present || values_equal(def, out, actual, exp, expected)) continue;
+
+        if (same && detail) {
+            report_printf(report, "  레코드 %zu ", exp_rec + 1);
+            report_location(report, exp, exp_rec);
+            report_printf(report, "\n");
+        }
+        same = false;
+        if (!detail) break;
+
+        report_printf(report, "    %s 불일치\n      결과: ", def->key);
+        report_value(report, out, (int)f, actual);
+        report_printf(report, "\n      정답: ");
+        report_value(report, exp, (int)f, expected);
+        report_printf(report, "\n");
+    }
+    return same;
+}
+
+static int align_and_compare(const DecodedVectors* out, const DecodedVectors* exp, bool allow_extra,
+                             CompareReport* report) {
+    uint64_t* out_keys = (uint64_t*)malloc((out->count + 1) * sizeof(uint64_t));
+    uint64_t* exp_keys = (uint64_t*)malloc((exp->count + 1) * sizeof(uint64_t));
+    size_t* next = (size_t*)malloc((out->count + 1) * sizeof(size_t));
+    bool* used = (bool*)calloc(out->count + 1, sizeof(bool));
+    KeyMap map = { NULL, NULL, 0 };
+    int ret = ERR_MEMORY_ALLOC;
+
+    if (out_keys == NULL || exp_keys == NULL || next == NULL || used == NULL ||
+        compute_keys(out, out_keys) != SUCCESS || compute_keys(exp, exp_keys) != SUCCESS ||
+        key_map_init(&map, out->count) != SUCCESS) {
+        goto done;
+    }
+
+    // 해시가 같은 결과 레코드는 앞에서부터 next로 이어 둠
+    for (size_t r = out->count; r-- > 0;) {
+        size_t* slot = key_map_slot(&map, out_keys[r]);
+        next[r] = *slot;
+        *slot = r + 1;
+    }
+
+    report->records = exp->count;
+
+    // 정답 순서대로 결과 레코드를 찾아 비교
+    for (size_t r = 0; r < exp->count; r++) {
+        // 같은 위치의 키가 같으면 해시 조회 생략 (해시가 같아도 키 값이 다르면 짝짓지 않음)
+        size_t match = 0;
+        if (r < out->count && !used[r] && out_keys[r] == exp_keys[r] && record_keys_equal(out, r, exp, r)) {
+            match = r + 1;
+        } else {
+            match = *key_map_slot(&map, exp_keys[r]);
+            while (match != 0 && (used[match - 1] || !record_keys_equal(out, match - 1, exp, r))) {
+                match = next[match - 1];
+            }
+        }
+        bool detail = compare_report_failures(report) < COMPARE_MAX_DIFFS;
+
+        if (match == 0) {
+            if (detail) {
+                report_printf(report, "  레코드 %zu ", r + 1);
+                report_location(report, exp, r);
+                report_printf(report, ": 결과 없음\n");
+            }
+            report->missing++;
+            continue;
+        }
+
+        used[match - 1] = true;
+        if (!compare_records(report, detail, out, match - 1, exp, r)) {
+            report->mismatched++;
+        }
+    }
+
+    // 정답에 없는 결과 레코드
+    for (size_t r = 0; r < out->count && !allow_extra; r++) {
+        if (used[r]) continue;
+
+        if (compare_report_failures(report) < COMPARE_MAX_DIFFS) {
+            report_printf(report, "  결과 레코드 %zu ", r + 1);
+            report_location(report, out, r);
+            report_printf(report, ": 정답에 없음\n");
+        }
+        report->extra++;
+    }
+
+    if (compare_report_failures(report) > COMPARE_MAX_DIFFS) {
+        report_printf(report, "  ... 외 %zu개 레코드\n", compare_report_failures(report) - COMPARE_MAX_DIFFS);
+    }
+    ret = SUCCESS;
+
+done:
+    key_map_free(&map);
+    free(out_keys);
+    free(exp_keys);
+    free(next);
+    free(used);
+    return ret;
+}
+
+int compare_vector_files(const char* output_file, const char* expected_file, CompareReport* report) {
+    return compare_vector_files_ex(output_file, expected_file, false, report);
+}
+
+int compare_vector_files_ex(const char* output_file, const char* expected_file, bool allow_extra,
+                            CompareReport* report) {
+    memset(report, 0, sizeof(*report));
+
+    const VectorSchema* schema = vector_schema_for_file(expected_file);
+    if (schema == NULL) {
+        return ERR_INVALID_FORMAT;
+    }
+
+    VectorCache expected;
+    int ret = vector_cache_open(&expected, schema, expected_file);
+    if (ret != SUCCESS) {
+        return ret == ERR_FILE_OPEN || ret == ERR_FILE_READ ? ERR_FILE_OPEN : ERR_INVALID_FORMAT;
+    }
+
+    DecodedVectors output;
+    ret = schema_decode_file(schema, output_file, &output);
+    if (ret != SUCCESS) {
+        vector_cache_close(&expected);
+        return ret == ERR_FILE_OPEN || ret == ERR_FILE_READ ? ERR_FILE_OPEN : ERR_INVALID_FORMAT;
+    }
+
+    if (expected.vectors.count == 0) {
+        ret = ERR_INVALID_FORMAT;
+    } else {
+        PHASE_START(compare_mark);
+        ret = align_and_compare(&output, &expected.vectors, allow_extra, report);
+        PHASE_STOP(compare_mark, PHASE_COMPARE);
+    }
+
+    decoded_vectors_free(&output);
+    vector_cache_close(&expected);
+    return ret;
+}
+
+void compare_report_free(CompareReport* report) {
+    free(report->diff);
+    memset(report, 0, sizeof(*report));
+}
@@ -0,0 +1,270 @@
+#include "../../include/common/vector_cache.h"
+#include "../../include/common/response_writer.h"
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/evp_cache.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+#ifdef _WIN32
+#include <process.h>
+#define get_pid _getpid
+#else
+#include <unistd.h>
+#define get_pid getpid
+#endif
+
+static const char* g_cache_dir = VECTOR_CACHE_DEFAULT_DIR;
+
+// 임시 파일 이름 구분용
+static unsigned g_temp_counter = 0;
+
+void vector_cache_set_dir(const char* dir) {
+    g_cache_dir = dir;
+}
+
+const char* vector_cache_dir(void) {
+    const char* env = getenv("CRYPTO_TEST_VBIN_DIR");
+    if (env != NULL && *env != '\0') {
+        return strcmp(env, "off") == 0 ? NULL : env;
+    }
+    return g_cache_dir;
+}
+
+bool vector_cache_enabled_for(const char* path) {
+    return vector_cache_dir() != NULL && compression_kind_for_path(path) == COMPRESSION_NONE;
+}
+
+int vector_cache_content_hash(const void* data, size_t size, uint8_t hash[32]) {
+    const EVP_MD* md = evp_cache_md(EVP_CACHE_MD_SHA256);
+    EVP_MD_CTX* ctx = evp_cache_md_ctx();
+    unsigned int len = 0;
+
+    if (md == NULL || ctx == NULL ||
+        EVP_DigestInit_ex2(ctx, md, NULL) != 1 ||
+        EVP_DigestUpdate(ctx, data, size) != 1 ||
+        EVP_DigestFinal_ex(ctx, hash, &len) != 1) {
+        return ERR_CRYPTO_OPERATION;
+    }
+    return SUCCESS;
+}
+
+// <디렉토리>/<파일명>-<해시 앞 16자>.vbin
+static bool cache_path(char* path, size_t size, const char* dir, const char* source_path, const uint8_t hash[32]) {
+    char hash_hex[17];
+    hex_encode(hash, 8, hash_hex);
+    hash_hex[16] = '\0';
+
+    int n = snprintf(path, size, "%s/%s-%s.vbin", dir, get_filename_from_path(source_path), hash_hex);
+    return n > 0 && (size_t)n < size;
+}
+
+static uint64_t fnv_mix(uint64_t hash, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/**
+ * 스키마 필드 구성의 FNV-1a 해시
+ * 필드 이름/종류/플래그가 바뀌면 스키마 이름과 필드 수가 같아도 값의 뜻이 달라지므로 캐시를 무효화
+ */
+static uint64_t schema_fingerprint(const VectorSchema* schema) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t f = 0; f < schema->field_count; f++) {
+        const SchemaField* field = &schema->fields[f];
+        uint32_t kind_flags[2] = { (uint32_t)field->kind, (uint32_t)field->flags };
+        hash = fnv_mix(hash, field->key, strlen(field->key) + 1);
+        hash = fnv_mix(hash, kind_flags, sizeof(kind_flags));
+    }
+    return hash;
+}
+
+// 범위 [offset, offset + len)이 limit 안에 있는지 (오버플로 포함)
+static bool in_range(uint64_t offset, uint64_t len, uint64_t limit) {
+    return offset <= limit && len <= limit - offset;
+}
+
+/**
+ * 매핑한 .vbin 검증 후 vectors에 연결
+ * 헤더 필드와 모든 값의 범위를 확인해 손상되거나 다른 원본의 캐시는 거부
+ */
+static bool attach_mapping(VectorCache* cache, const VectorSchema* schema, const uint8_t hash[32]) {
+    const VectorReader* map = &cache->mapping;
+    if (map->size < sizeof(VbinHeader)) {
+        return false;
+    }
+
+    VbinHeader header;
+    memcpy(&header, map->data, sizeof(header));
+
+    if (memcmp(header.magic, VBIN_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != VBIN_VERSION || header.endian != VBIN_ENDIAN_MARK ||
+        strncmp(header.schema, schema->name, sizeof(header.schema)) != 0 ||
+        header.schema_hash != schema_fingerprint(schema) ||
+        memcmp(header.source_hash, hash, sizeof(header.source_hash)) != 0 ||
+        header.source_size != cache->source.size ||
+        header.field_count != schema->field_count ||
+        header.header_len > header.source_size) {
+        return false;
+    }
+
+    uint64_t value_count = header.record_count * header.field_count;
+    if (header.field_count != 0 && value_count / header.field_count != header.record_count) {
+        return false;
+    }
+    if (value_count > UINT64_MAX / sizeof(SchemaValue) ||
+        header.record_count > UINT64_MAX / sizeof(SchemaSpan) ||
+        header.values_offset % 8 != 0 || header.spans_offset % 8 != 0 ||
+        !in_range(header.values_offset, value_count * sizeof(SchemaValue), map->size) ||
+        !in_range(header.spans_offset, header.record_count * sizeof(SchemaSpan), map->size) ||
+        !in_range(header.payload_offset, header.payload_len, map->size)) {
+        return false;
+    }
+
+    const SchemaValue* values = (const SchemaValue*)(map->data + header.values_offset);
+    for (uint64_t i = 0; i < value_count; i++) {
+        bool payload_ok = decoded_text_only(&values[i])
+                              ? (uint64_t)values[i].text_len == (uint64_t)values[i].len * 2
+                              : in_range(values[i].offset, values[i].len, header.payload_len);
+        if (!payload_ok || !in_range(values[i].text_offset, values[i].text_len, header.source_size)) {
+            return false;
+        }
+    }
+
+    // 매핑은 읽기 전용이므로 vectors를 통해 수정하지 않음
+    DecodedVectors* out = &cache->vectors;
+    out->schema = schema;
+    out->count = (size_t)header.record_count;
+    out->field_count = (size_t)header.field_count;
+    out->values = (SchemaValue*)values;
+    out->spans = (SchemaSpan*)(map->data + header.spans_offset);
+    out->source = cache->source.data;
+    out->payload = (uint8_t*)(map->data + header.payload_offset);
+    out->payload_len = (size_t)header.payload_len;
+    out->header_len = header.header_len;
+    return true;
+}
+
+/**
+ * 디코딩 결과를 .vbin으로 기록
+ * 임시 파일에 쓴 뒤 이름을 바꾸므로 동시에 같은 파일을 쓰는 작업이 있어도 반쯤 쓴 캐시는 보이지 않음
+ */
+static void write_cache(const char* path, const char* dir, const VectorCache* cache, const uint8_t hash[32]) {
+    const DecodedVectors* vectors = &cache->vectors;
+    if (create_directory(dir) != SUCCESS) {
+        return;
+    }
+
+    char temp_path[MAX_PATH_LENGTH * 2];
+    unsigned id = __atomic_fetch_add(&g_temp_counter, 1, __ATOMIC_RELAXED);
+    int n = snprintf(temp_path, sizeof(temp_path), "%s.%d.%u.tmp", path, (int)get_pid(), id);
+    if (n <= 0 || (size_t)n >= sizeof(temp_path)) {
+        return;
+    }
+
+    size_t values_size = vectors->count * vectors->field_count * sizeof(SchemaValue);
+    size_t spans_size = vectors->count * sizeof(SchemaSpan);
+
+    VbinHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, VBIN_MAGIC, sizeof(header.magic));
+    header.version = VBIN_VERSION;
+    header.endian = VBIN_ENDIAN_MARK;
+    strncpy(header.schema, vectors->schema->name, sizeof(header.schema) - 1);
+    header.schema_hash = schema_fingerprint(vectors->schema);
+    memcpy(header.source_hash, hash, sizeof(header.source_hash));
+    header.source_size = cache->source.size;
+    header.field_count = vectors->field_count;
+    header.record_count = vectors->count;
+    header.header_len = vectors->header_len;
+    header.values_offset = sizeof(header);
+    header.spans_offset = header.values_offset + values_size;
+    header.payload_offset = header.spans_offset + spans_size;
+    header.payload_len = vectors->payload_len;
+
+    ResponseWriter out;
+    if (response_writer_open(&out, temp_path) != SUCCESS) {
+        return;
+    }
+    rw_write(&out, (const char*)&header, sizeof(header));
+    rw_write(&out, (const char*)vectors->values, values_size);
+    rw_write(&out, (const char*)vectors->spans, spans_size);
+    rw_write(&out, (const char*)vectors->payload, vectors->payload_len);
+
+    if (response_writer_close(&out) != SUCCESS || rename(temp_path, path) != 0) {
+        remove(temp_path);
+    }
+}
+
+static int open_cache(VectorCache* cache, const VectorSchema* schema, const char* path) {
+    memset(cache, 0, sizeof(*cache));
+    if (schema == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+
+    // 압축 파일은 해시와 디코딩에 전체 내용이 필요하므로 해제 완료까지 대기
+    int ret = vector_reader_open(&cache->source, path);
+    if (ret == SUCCESS) {
+        ret = vector_reader_wait(&cache->source);
+    }
+    if (ret != SUCCESS) {
+        vector_reader_close(&cache->source);
+        return ret;
+    }
+
+    const char* dir = vector_cache_dir();
+    uint8_t hash[32];
+    char vbin_path[MAX_PATH_LENGTH * 2];
+    bool use_cache = dir != NULL &&
+                     vector_cache_content_hash(cache->source.data, cache->source.size, hash) == SUCCESS &&
+                     cache_path(vbin_path, sizeof(vbin_path), dir, path, hash);
+
+    // 캐시 적중: 매핑만으로 끝
+    if (use_cache && vector_reader_open_raw(&cache->mapping, vbin_path) == SUCCESS) {
+        if (attach_mapping(cache, schema, hash)) {
+            cache->from_cache = true;
+            return SUCCESS;
+        }
+        vector_reader_close(&cache->mapping);
+        memset(&cache->vectors, 0, sizeof(cache->vectors));
+    }
+
+    // 캐시 없음: 원본 디코딩 후 기록
+    VectorReader reader;
+    vector_reader_init_buffer(&reader, cache->source.data, cache->source.size);
+    ret = schema_decode_ex(schema, &reader, VECTOR_CACHE_STREAM_MIN, &cache->vectors);
+    if (ret != SUCCESS) {
+        vector_reader_close(&cache->source);
+        return ret;
+    }
+
+    if (use_cache) {
+        write_cache(vbin_path, dir, cache, hash);
+    }
+    return SUCCESS;
+}
+
+int vector_cache_open(VectorCache* cache, const VectorSchema* schema, const char* path) {
+    PHASE_START(parse_mark);
+    int ret = open_cache(cache, schema, path);
+    PHASE_STOP(parse_mark, PHASE_PARSE);
+    return ret;
+}
+
+void vector_cache_close(VectorCache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    if (cache->from_cache) {
+        vector_reader_close(&cache->mapping);
+    } else {
+        decoded_vectors_free(&cache->vectors);
+    }
+    vector_reader_close(&cache->source);
+    memset(cache, 0, sizeof(*cache));
+}
@@ -0,0 +1,311 @@
+#include "../../include/common/vector_reader.h"
+#include "../../include/common/compressed_io.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+#include <limits.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * 벡터 파일을 읽기 전용으로 매핑
+ * 빈 파일은 매핑 없이 크기 0으로 처리
+ */
+int vector_reader_open_raw(VectorReader* reader, const char* path) {
+    memset(reader, 0, sizeof(*reader));
+    if (path == NULL) {
+        return ERR_INVALID_INPUT;
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return ERR_FILE_OPEN;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return ERR_FILE_READ;
+    }
+
+    reader->file_handle = file;
+    if (size.QuadPart == 0) {
+        reader->data = "";
+        return SUCCESS;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    void* base = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (base == NULL) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        reader->file_handle = NULL;
+        return ERR_FILE_READ;
+    }
+
+    reader->map_handle = mapping;
+    reader->map_base = base;
+    reader->map_size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return ERR_FILE_OPEN;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return ERR_FILE_READ;
+    }
+
+    if (st.st_size == 0) {
+        close(fd);
+        reader->data = "";
+        return SUCCESS;
+    }
+
+    void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return ERR_FILE_READ;
+    }
+    madvise(base, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    reader->map_base = base;
+    reader->map_size = (size_t)st.st_size;
+#endif
+
+    reader->data = (const char*)reader->map_base;
+    reader->size = reader->map_size;
+    return SUCCESS;
+}
+
+/**
+ * 벡터 파일 열기
+ * 압축 파일은 해제 스트림을 시작하고 바로 반환하므로 첫 레코드 처리와 나머지 해제가 겹침
+ */
+int vector_reader_open(VectorReader* reader, const char* path) {
+    CompressionKind kind = compression_kind_for_path(path);
+    if (kind == COMPRESSION_NONE) {
+        return vector_reader_open_raw(reader, path);
+    }
+
+    memset(reader, 0, sizeof(*reader));
+    DecompressStream* stream = NULL;
+    int ret = decompress_stream_start(&stream, path, kind);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    reader->stream = stream;
+    reader->data = decompress_stream_data(stream);
+    return SUCCESS;
+}
+
+int vector_reader_wait(VectorReader* reader) {
+    if (reader->stream == NULL) {
+        return SUCCESS;
+    }
+
+    bool done = false;
+    while (!done) {
+        reader->size = decompress_stream_wait((DecompressStream*)reader->stream, SIZE_MAX, &done);
+    }
+    return decompress_stream_error((DecompressStream*)reader->stream);
+}
+
+void vector_reader_release(const VectorReader* reader, const char* upto) {
+    if (reader == NULL || reader->stream == NULL || upto == NULL || upto < reader->data) {
+        return;
+    }
+    decompress_stream_release((DecompressStream*)reader->stream, (size_t)(upto - reader->data));
+}
+
+int vector_reader_error(const VectorReader* reader) {
+    return reader->stream ? decompress_stream_error((DecompressStream*)reader->stream) : SUCCESS;
+}
+
+void vector_reader_close(VectorReader* reader) {
+    if (reader == NULL) {
+        return;
+    }
+
+    decompress_stream_close((DecompressStream*)reader->stream);
+
+#ifdef _WIN32
+    if (reader->map_base) UnmapViewOfFile(reader->map_base);
+    if (reader->map_handle) CloseHandle((HANDLE)reader->map_handle);
+    if (reader->file_handle) CloseHandle((HANDLE)reader->file_handle);
+#else
+    if (reader->map_base) munmap(reader->map_base, reader->map_size);
+#endif
+
+    memset(reader, 0, sizeof(*reader));
+}
+
+void vector_reader_init_buffer(VectorReader* reader, const char* data, size_t size) {
+    memset(reader, 0, sizeof(*reader));
+    reader->data = data;
+    reader->size = size;
+}
+
+// 앞뒤 공백 제거
+static StrView trim(const char* start, const char* end) {
+    while (start < end && (*start == ' ' || *start == '\t')) start++;
+    while (end > start && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+
+    StrView view = { start, (size_t)(end - start) };
+    return view;
+}
+
+// "key = value" 분리 (등호가 없으면 전체가 key)
+static void split_key_value(const char* start, const char* end, StrView* key, StrView* value) {
+    const char* eq = memchr(start, '=', (size_t)(end - start));
+
+    if (eq == NULL) {
+        *key = trim(start, end);
+        value->ptr = end;
+        value->len = 0;
+        return;
+    }
+
+    *key = trim(start, eq);
+    *value = trim(eq + 1, end);
+}
+
+/**
+ * 압축 파일: 현재 줄이 모두 풀릴 때까지 대기
+ * 이미 확인한 구간은 scan으로 건너뛰어 긴 줄도 한 번만 훑음
+ */
+static void stream_sync(VectorReader* reader) {
+    bool done = false;
+
+    for (;;) {
+        if (reader->scan < reader->pos) {
+            reader->scan = reader->pos;
+        }
+        if (reader->scan < reader->size &&
+            memchr(reader->data + reader->scan, '\n', reader->size - reader->scan) != NULL) {
+            return;
+        }
+        reader->scan = reader->size;
+        if (done) {
+            return;
+        }
+        reader->size = decompress_stream_wait((DecompressStream*)reader->stream, reader->size + 1, &done);
+    }
+}
+
+bool vector_reader_next(VectorReader* reader, VecToken* token) {
+    if (reader->stream != NULL) {
+        stream_sync(reader);
+    }
+    if (reader->pos >= reader->size) {
+        return false;
+    }
+
+    const char* start = reader->data + reader->pos;
+    size_t remaining = reader->size - reader->pos;
+    const char* nl = memchr(start, '\n', remaining);
+    const char* end = nl ? nl : start + remaining;
+
+    token->offset = reader->pos;
+    reader->pos = nl ? (size_t)(nl - reader->data) + 1 : reader->size;
+
+    // 줄 끝의 CR 제거
+    if (end > start && end[-1] == '\r') end--;
+
+    token->line.ptr = start;
+    token->line.len = (size_t)(end - start);
+    token->key.ptr = start;
+    token->key.len = 0;
+    token->value.ptr = end;
+    token->value.len = 0;
+
+    StrView body = trim(start, end);
+
+    if (body.len == 0) {
+        token->type = VEC_TOKEN_BLANK;
+    } else if (body.ptr[0] == '#') {
+        token->type = VEC_TOKEN_COMMENT;
+    } else if (body.ptr[0] == '[') {
+        const char* close = memchr(body.ptr, ']', body.len);
+        const char* inner_end = close ? close : body.ptr + body.len;
+
+        token->type = VEC_TOKEN_SECTION;
+        reader->section = trim(body.ptr + 1, inner_end);
+        split_key_value(body.ptr + 1, inner_end, &token->key, &token->value);
+    } else if (memchr(body.ptr, '=', body.len) != NULL) {
+        token->type = VEC_TOKEN_FIELD;
+        split_key_value(body.ptr, body.ptr + body.len, &token->key, &token->value);
+    } else {
+        token->type = VEC_TOKEN_OTHER;
+        token->key = body;
+    }
+
+    token->section = reader->section;
+    return true;
+}
+
+bool vector_reader_next_field(VectorReader* reader, VecToken* token) {
+    while (vector_reader_next(reader, token)) {
+        if (token->type == VEC_TOKEN_FIELD) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool strview_eq(StrView view, const char* str) {
+    size_t len = strlen(str);
+    return view.len == len && memcmp(view.ptr, str, len) == 0;
+}
+
+bool strview_starts_with(StrView view, const char* prefix) {
+    size_t len = strlen(prefix);
+    return view.len >= len && memcmp(view.ptr, prefix, len) == 0;
+}
+
+/**
+ * 10진수 뷰를 정수로 변환
+ * @param ok 변환 성공 여부 (NULL 가능, 숫자가 아니거나 long long 범위를 넘으면 false)
+ */
+long long strview_to_ll(StrView view, bool* ok) {
+    long long value = 0;
+    size_t i = 0;
+    bool negative = false;
+
+    if (view.len > 0 && (view.ptr[0] == '-' || view.ptr[0] == '+')) {
+        negative = (view.ptr[0] == '-');
+        i = 1;
+    }
+
+    bool valid = i < view.len;
+    for (; i < view.len; i++) {
+        char ch = view.ptr[i];
+        if (ch < '0' || ch > '9') {
+            valid = false;
+            break;
+        }
+        // LLONG_MAX를 넘는 값은 거부 (너무 긴 Len/Count 등)
+        if (value > (LLONG_MAX - (ch - '0')) / 10) {
+            valid = false;
+            value = 0;
+            break;
+        }
+        value = value * 10 + (ch - '0');
+    }
+
+    if (ok != NULL) {
+        *ok = valid;
+    }
+    return negative ? -value : value;
+}
@@ -0,0 +1,219 @@
+#include "../../include/common/vector_runner.h"
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+int vector_runner_run(const VectorRunner* runner, const char* input_file, const char* output_file) {
+    VectorCache cache;
+    VectorReader reader;
+    bool use_cache = vector_cache_enabled_for(input_file);
+    int ret = use_cache ?
+        vector_cache_open(&cache, vector_schema_find(runner->schema), input_file) :
+        vector_reader_open(&reader, input_file);
+    if (ret != SUCCESS) {
+        print_error(ret);
+        return ret;
+    }
+
+    RunnerIo* io = runner->io;
+    Pipeline pipe;
+    io->source = use_cache ? NULL : &reader;
+
+    if (response_writer_open(&io->out, output_file) != SUCCESS) {
+        print_error(ERR_FILE_CREATE);
+        ret = ERR_FILE_CREATE;
+    } else if (pipeline_start(&pipe, &runner->pipe, pipeline_default_workers()) != SUCCESS) {
+        response_writer_close(&io->out);
+        ret = ERR_MEMORY_ALLOC;
+    }
+    if (ret != SUCCESS) {
+        if (use_cache) vector_cache_close(&cache);
+        else vector_reader_close(&reader);
+        return ret;
+    }
+
+    // 읽기 단계 (배치 제출 대기와 16진수 디코딩은 각자의 단계로 빠짐)
+    PipelineBatch* current = pipeline_acquire(&pipe);
+    PHASE_START(parse_mark);
+    ret = use_cache ?
+        runner->feed_cache(&pipe, &current, &cache, &io->out) :
+        runner->feed_reader(&pipe, &current, &reader, &io->out);
+    PHASE_STOP(parse_mark, PHASE_PARSE);
+
+    // 남은 레코드 제출 (오류 시에는 빈 배치로 돌려줌)
+    if (ret != SUCCESS) {
+        print_error(ret);
+        record_batch_reset(&current->records);
+    }
+    pipeline_submit(&pipe, current);
+
+    int pipe_ret = pipeline_finish(&pipe);
+    if (ret == SUCCESS) {
+        ret = pipe_ret;
+    }
+
+    if (use_cache) vector_cache_close(&cache);
+    else vector_reader_close(&reader);
+    io->source = NULL;
+
+    if (response_writer_close(&io->out) != SUCCESS && ret == SUCCESS) {
+        ret = ERR_FILE_WRITE;
+    }
+    return ret;
+}
+
+void vector_runner_echo_line(ResponseWriter* out, const VecToken* token) {
+    rw_write(out, token->line.ptr, token->line.len);
+    rw_putc(out, '\n');
+}
+
+void vector_runner_echo_header(ResponseWriter* out, const VectorCache* cache) {
+    VectorReader header;
+    VecToken token;
+    vector_reader_init_buffer(&header, cache->source.data, (size_t)cache->vectors.header_len);
+    while (vector_reader_next(&header, &token)) {
+        vector_runner_echo_line(out, &token);
+    }
+}
+
+RecordBatch* vector_runner_submit_if_full(Pipeline* pipe, PipelineBatch** current, bool force) {
+    if (force || record_batch_full(&(*current)->records)) {
+        PHASE_START(wait_mark);
+        pipeline_submit(pipe, *current);
+        *current = pipeline_acquire(pipe);
+        PHASE_STOP(wait_mark, PHASE_WAIT);
+    }
+    return &(*current)->records;
+}
+
+int vector_runner_feed_counted(Pipeline* pipe, PipelineBatch** current, VectorReader* reader, ResponseWriter* out,
+                               size_t echo_column, RunnerFieldFn field, RunnerSectionFn section, void* user) {
+    RecordBatch* batch = &(*current)->records;
+    VecToken token;
+    bool in_header = true;
+    size_t idx = 0;
+    StrView* echo = NULL;
+
+    while (vector_reader_next(reader, &token)) {
+        bool is_count = (token.type == VEC_TOKEN_FIELD && strview_eq(token.key, "Count"));
+
+        if (token.type == VEC_TOKEN_SECTION && section != NULL) {
+            int ret = section(user, &token);
+            if (ret != SUCCESS) {
+                return ret;
+            }
+        }
+
+        // 헤더 정복사 (첫 Count 전까지)
+        if (in_header && !is_count) {
+            vector_runner_echo_line(out, &token);
+            continue;
+        }
+        in_header = false;
+
+        if (is_count) {
+            if (echo != NULL) {
+                echo->len = (size_t)(token.line.ptr - echo->ptr);
+            }
+            batch = vector_runner_submit_if_full(pipe, current, false);
+            if (pipeline_failed(pipe)) {
+                echo = NULL;
+                break;
+            }
+            idx = record_batch_push(batch);
+            echo = &batch->text[echo_column][idx];
+            echo->ptr = token.line.ptr;
+        }
+        if (token.type != VEC_TOKEN_FIELD) continue;
+
+        int ret = field(user, batch, idx, &token);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+        batch->num[echo_column][idx] = token.line.ptr + token.line.len - echo->ptr;
+    }
+
+    // 마지막 레코드는 파일 끝까지
+    if (echo != NULL) {
+        echo->len = (size_t)(reader->data + reader->pos - echo->ptr);
+    }
+
+    // 손상된 압축 파일은 풀린 데까지만 토큰이 나오므로 여기서 오류로 처리
+    return vector_reader_error(reader);
+}
+
+void vector_runner_set_echo(RecordBatch* batch, size_t idx, size_t echo_column, const VectorCache* cache,
+                            size_t record) {
+    const DecodedVectors* vectors = &cache->vectors;
+    const char* source = cache->source.data;
+
+    // 원문은 다음 레코드 시작(마지막이면 파일 끝)까지, 필드 부분은 끝 개행을 뺀 레코드 범위
+    const SchemaSpan* span = &vectors->spans[record];
+    uint64_t next = (record + 1 < vectors->count) ? vectors->spans[record + 1].start : (uint64_t)cache->source.size;
+    size_t fields_len = (size_t)(span->end - span->start);
+    while (fields_len > 0 && (source[span->start + fields_len - 1] == '\n' ||
+                              source[span->start + fields_len - 1] == '\r')) {
+        fields_len--;
+    }
+    batch->text[echo_column][idx].ptr = source + span->start;
+    batch->text[echo_column][idx].len = (size_t)(next - span->start);
+    batch->num[echo_column][idx] = (long long)fields_len;
+}
+
+void vector_runner_echo_fields(ResponseWriter* out, const RecordBatch* batch, size_t echo_column, size_t i) {
+    rw_write(out, batch->text[echo_column][i].ptr, (size_t)batch->num[echo_column][i]);
+    rw_putc(out, '\n');
+}
+
+void vector_runner_echo_rest(ResponseWriter* out, const RecordBatch* batch, size_t echo_column, size_t i) {
+    StrView echo = batch->text[echo_column][i];
+    size_t fields_len = (size_t)batch->num[echo_column][i];
+
+    // 마지막 필드 줄의 개행은 vector_runner_echo_fields에서 이미 기록
+    StrView rest = { echo.ptr + fields_len, echo.len - fields_len };
+    if (rest.len > 0 && rest.ptr[0] == '\r') { rest.ptr++; rest.len--; }
+    if (rest.len > 0 && rest.ptr[0] == '\n') { rest.ptr++; rest.len--; }
+    rw_write(out, rest.ptr, rest.len);
+}
+
+void vector_runner_release(const RunnerIo* io, const RecordBatch* batch, size_t text_column) {
+    if (batch->count > 0) {
+        StrView last = batch->text[text_column][batch->count - 1];
+        vector_reader_release(io->source, last.ptr + last.len);
+    }
+}
+
+int vector_runner_auto_test(const char* dir, const char* test_file,
+                            int (*run)(const char* input_file, const char* output_file)) {
+    char input_path[MAX_PATH_LENGTH];
+    char output_path[MAX_PATH_LENGTH];
+    char output_dir[MAX_PATH_LENGTH];
+
+    snprintf(input_path, sizeof(input_path), "test_vectors/request/%s/%s", dir, test_file);
+    const char* output_file = replace_extension(test_file, ".req", ".rsp");
+    snprintf(output_path, sizeof(output_path), "test_vectors/response/%s/%s", dir, output_file);
+    snprintf(output_dir, sizeof(output_dir), "test_vectors/response/%s", dir);
+
+    create_directory(output_dir);
+
+    int result = run(input_path, output_path);
+    if (result == SUCCESS) {
+        printf("\n테스트 완료: 결과 파일이 %s에 저장되었습니다.\n", output_path);
+
+        char expected_path[MAX_PATH_LENGTH];
+        snprintf(expected_path, sizeof(expected_path), "test_vectors/expected/%s/%s", dir, output_file);
+
+        if (file_exists(expected_path)) {
+            printf("\n결과 비교 중...\n");
+            result = compare_test_results(output_path, expected_path);
+            if (result == SUCCESS) {
+                printf("\n✓ 모든 테스트 결과가 예상 결과와 일치합니다.\n");
+            } else {
+                printf("\n✕ 일부 테스트 결과가 예상 결과와 일치하지 않습니다.\n");
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,444 @@
+#include "../../include/common/vector_schema.h"
+#include "../../include/common/hex_codec.h"
+#include "../../include/common/phase_stats.h"
+#include "../../include/common/error.h"
+#include "../../include/common/common.h"
+
+#define SCHEMA(NAME, FIELDS) { NAME, FIELDS, sizeof(FIELDS) / sizeof(FIELDS[0]) }
+
+// SHA-256 ShortMsg/LongMsg
+static const SchemaField SHA_MSG_FIELDS[] = {
+    { "L",   SCHEMA_INT, SCHEMA_FLAG_SECTION },
+    { "Len", SCHEMA_INT, SCHEMA_FLAG_START },
+    { "Msg", SCHEMA_HEX, SCHEMA_FLAG_STREAM },
+    { "MD",  SCHEMA_HEX, 0 },
+};
+
+// SHA-256 Monte (요청: Seed, 응답: COUNT/MD 반복)
+static const SchemaField SHA_MONTE_FIELDS[] = {
+    { "L",     SCHEMA_INT, SCHEMA_FLAG_SECTION },
+    { "Seed",  SCHEMA_HEX, SCHEMA_FLAG_START },
+    { "COUNT", SCHEMA_INT, SCHEMA_FLAG_START },
+    { "MD",    SCHEMA_HEX, 0 },
+};
+
+// CMAC-AES Gen/Ver
+static const SchemaField CMAC_FIELDS[] = {
+    { "Count",  SCHEMA_INT,  SCHEMA_FLAG_START },
+    { "Klen",   SCHEMA_INT,  0 },
+    { "Mlen",   SCHEMA_INT,  0 },
+    { "Tlen",   SCHEMA_INT,  0 },
+    { "Key",    SCHEMA_HEX,  0 },
+    { "Msg",    SCHEMA_HEX,  0 },
+    { "Mac",    SCHEMA_HEX,  0 },
+    { "Result", SCHEMA_TEXT, SCHEMA_FLAG_VERDICT },
+};
+
+// HMAC ([L=32] 섹션 안의 Count/Klen/Tlen/Key/Msg/Mac)
+static const SchemaField HMAC_FIELDS[] = {
+    { "L",     SCHEMA_INT, SCHEMA_FLAG_SECTION },
+    { "Count", SCHEMA_INT, SCHEMA_FLAG_START },
+    { "Klen",  SCHEMA_INT, 0 },
+    { "Tlen",  SCHEMA_INT, 0 },
+    { "Key",   SCHEMA_HEX, 0 },
+    { "Msg",   SCHEMA_HEX, 0 },
+    { "Mac",   SCHEMA_HEX, 0 },
+};
+
+// ECDSA SigGen/SigVer ([P-256,SHA-256] 섹션)
+static const SchemaField ECDSA_SIG_FIELDS[] = {
+    { "",       SCHEMA_TEXT, SCHEMA_FLAG_SECTION_NAME },
+    { "Msg",    SCHEMA_HEX,  SCHEMA_FLAG_START },
+    { "d",      SCHEMA_HEX,  0 },
+    { "Qx",     SCHEMA_HEX,  0 },
+    { "Qy",     SCHEMA_HEX,  0 },
+    { "k",      SCHEMA_HEX,  0 },
+    { "R",      SCHEMA_HEX,  0 },
+    { "S",      SCHEMA_HEX,  0 },
+    { "Result", SCHEMA_TEXT, SCHEMA_FLAG_VERDICT },
+};
+
+// ECDSA KeyPair ([P-256] 뒤 [B.4.2 ...] 섹션과 N)
+static const SchemaField ECDSA_KEYPAIR_FIELDS[] = {
+    { "P-", SCHEMA_TEXT, SCHEMA_FLAG_SECTION_NAME },
+    { "B.", SCHEMA_TEXT, SCHEMA_FLAG_SECTION_NAME },
+    { "N",  SCHEMA_INT,  SCHEMA_FLAG_STICKY },
+    { "d",  SCHEMA_HEX,  SCHEMA_FLAG_START },
+    { "Qx", SCHEMA_HEX,  0 },
+    { "Qy", SCHEMA_HEX,  0 },
+};
+
+// ECDSA PKV
+static const SchemaField ECDSA_PKV_FIELDS[] = {
+    { "",       SCHEMA_TEXT, SCHEMA_FLAG_SECTION_NAME },
+    { "Qx",     SCHEMA_HEX,  SCHEMA_FLAG_START },
+    { "Qy",     SCHEMA_HEX,  0 },
+    { "Result", SCHEMA_TEXT, SCHEMA_FLAG_VERDICT },
+};
+
+// RSA SigGen PKCS#1 v1.5 (n, e는 레코드 앞에 한 번)
+static const SchemaField RSA_SIGGEN_FIELDS[] = {
+    { "mod",    SCHEMA_INT,  SCHEMA_FLAG_SECTION },
+    { "n",      SCHEMA_HEX,  SCHEMA_FLAG_STICKY },
+    { "e",      SCHEMA_HEX,  SCHEMA_FLAG_STICKY },
+    { "SHAAlg", SCHEMA_TEXT, SCHEMA_FLAG_START },
+    { "Msg",    SCHEMA_HEX,  0 },
+    { "S",      SCHEMA_HEX,  0 },
+};
+
+// RSA SigVer PKCS#1 v1.5 (n만 이어지고 e/d는 레코드마다)
+static const SchemaField RSA_SIGVER_FIELDS[] = {
+    { "mod",    SCHEMA_INT,  SCHEMA_FLAG_SECTION },
+    { "n",      SCHEMA_HEX,  SCHEMA_FLAG_STICKY },
+    { "SHAAlg", SCHEMA_TEXT, SCHEMA_FLAG_START },
+    { "e",      SCHEMA_HEX,  0 },
+    { "d",      SCHEMA_HEX,  0 },
+    { "Msg",    SCHEMA_HEX,  0 },
+    { "S",      SCHEMA_HEX,  0 },
+    { "Result", SCHEMA_TEXT, SCHEMA_FLAG_VERDICT },
+};
+
+// RSA KeyGen FIPS 186-3
+static const SchemaField RSA_KEYGEN_FIELDS[] = {
+    { "PrimeMethod",      SCHEMA_TEXT, SCHEMA_FLAG_SECTION },
+    { "mod",              SCHEMA_INT,  SCHEMA_FLAG_SECTION },
+    { "hash",             SCHEMA_TEXT, SCHEMA_FLAG_SECTION },
+    { "Table for M-R Test", SCHEMA_TEXT, SCHEMA_FLAG_SECTION },
+    { "e",       SCHEMA_HEX, SCHEMA_FLAG_START },
+    { "seed",    SCHEMA_HEX, 0 },
+    { "bitlen1", SCHEMA_INT, 0 },
+    { "bitlen2", SCHEMA_INT, 0 },
+    { "bitlen3", SCHEMA_INT, 0 },
+    { "bitlen4", SCHEMA_INT, 0 },
+    { "Xp",      SCHEMA_HEX, 0 },
+    { "Xp1",     SCHEMA_HEX, 0 },
+    { "Xp2",     SCHEMA_HEX, 0 },
+    { "p1",      SCHEMA_HEX, 0 },
+    { "p2",      SCHEMA_HEX, 0 },
+    { "Xq",      SCHEMA_HEX, 0 },
+    { "Xq1",     SCHEMA_HEX, 0 },
+    { "Xq2",     SCHEMA_HEX, 0 },
+    { "q1",      SCHEMA_HEX, 0 },
+    { "q2",      SCHEMA_HEX, 0 },
+    { "p",       SCHEMA_HEX, 0 },
+    { "q",       SCHEMA_HEX, 0 },
+    { "n",       SCHEMA_HEX, 0 },
+    { "d",       SCHEMA_HEX, 0 },
+};
+
+static const VectorSchema SCHEMAS[] = {
+    SCHEMA("SHA-MSG", SHA_MSG_FIELDS),
+    SCHEMA("SHA-MONTE", SHA_MONTE_FIELDS),
+    SCHEMA("CMAC", CMAC_FIELDS),
+    SCHEMA("HMAC", HMAC_FIELDS),
+    SCHEMA("ECDSA-SIG", ECDSA_SIG_FIELDS),
+    SCHEMA("ECDSA-KEYPAIR", ECDSA_KEYPAIR_FIELDS),
+    SCHEMA("ECDSA-PKV", ECDSA_PKV_FIELDS),
+    SCHEMA("RSA-SIGGEN", RSA_SIGGEN_FIELDS),
+    SCHEMA("RSA-SIGVER", RSA_SIGVER_FIELDS),
+    SCHEMA("RSA-KEYGEN", RSA_KEYGEN_FIELDS),
+};
+
+// 파일명 패턴 → 스키마 (위에서부터 먼저 맞는 항목 사용)
+static const struct {
+    const char* pattern;
+    const char* schema;
+} FILE_SCHEMAS[] = {
+    { "Monte",     "SHA-MONTE" },
+    { "SHA256",    "SHA-MSG" },
+    { "CMAC",      "CMAC" },
+    { "HMAC",      "HMAC" },
+    { "SigGen15",  "RSA-SIGGEN" },
+    { "SigVer15",  "RSA-SIGVER" },
+    { "KeyGen",    "RSA-KEYGEN" },
+    { "SigGen",    "ECDSA-SIG" },
+    { "SigVer",    "ECDSA-SIG" },
+    { "KeyPair",   "ECDSA-KEYPAIR" },
+    { "PKV",       "ECDSA-PKV" },
+};
+
+const VectorSchema* vector_schema_find(const char* name) {
+    for (size_t i = 0; i < sizeof(SCHEMAS) / sizeof(SCHEMAS[0]); i++) {
+        if (strcmp(SCHEMAS[i].name, name) == 0) {
+            return &SCHEMAS[i];
+        }
+    }
+    return NULL;
+}
+
+const VectorSchema* vector_schema_for_file(const char* path) {
+    const char* filename = get_filename_from_path(path);
+
+    for (size_t i = 0; i < sizeof(FILE_SCHEMAS) / sizeof(FILE_SCHEMAS[0]); i++) {
+        if (strstr(filename, FILE_SCHEMAS[i].pattern) != NULL) {
+            return vector_schema_find(FILE_SCHEMAS[i].schema);
+        }
+    }
+    return NULL;
+}
+
+int vector_schema_field(const VectorSchema* schema, const char* key) {
+    for (size_t i = 0; i < schema->field_count; i++) {
+        if (strcmp(schema->fields[i].key, key) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static int find_field(const VectorSchema* schema, StrView key, unsigned exclude) {
+    for (size_t i = 0; i < schema->field_count; i++) {
+        if ((schema->fields[i].flags & exclude) == 0 && strview_eq(key, schema->fields[i].key)) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// payload 끝에 n바이트 확보
+static uint8_t* payload_reserve(DecodedVectors* out, size_t n) {
+    if (out->payload_cap - out->payload_len < n) {
+        size_t cap = out->payload_cap ? out->payload_cap : 4096;
+        while (cap - out->payload_len < n) cap *= 2;
+
+        uint8_t* grown = (uint8_t*)realloc(out->payload, cap);
+        if (grown == NULL) {
+            return NULL;
+        }
+        out->payload = grown;
+        out->payload_cap = cap;
+    }
+    return out->payload + out->payload_len;
+}
+
+// 필드 종류에 맞게 값 디코딩 (stream_min보다 큰 스트리밍 필드 값은 원문 위치만 기록)
+static int decode_value(DecodedVectors* out, const char* source, const SchemaField* field, size_t stream_min,
+                        StrView text, SchemaValue* value) {
+    SchemaFieldKind kind = field->kind;
+    memset(value, 0, sizeof(*value));
+    value->text_offset = (uint64_t)(text.ptr - source);
+    value->text_len = (uint32_t)text.len;
+
+    if (kind == SCHEMA_HEX && (field->flags & SCHEMA_FLAG_STREAM) && stream_min > 0 && text.len / 2 > stream_min) {
+        // 16진수 형식은 사용하는 쪽이 청크 단위로 디코딩하며 확인
+        if (text.len % 2 != 0) {
+            return ERR_INVALID_FORMAT;
+        }
+        value->len = (uint32_t)(text.len / 2);
+        value->flags = SCHEMA_VALUE_TEXT_ONLY;
+    } else if (kind == SCHEMA_INT) {
+        bool ok = false;
+        value->num = strview_to_ll(text, &ok);
+        if (!ok) {
+            return ERR_INVALID_FORMAT;
+        }
+    } else {
+        size_t cap = kind == SCHEMA_HEX ? (text.len + 1) / 2 : text.len;
+        uint8_t* dst = payload_reserve(out, cap + 1);
+        if (dst == NULL) {
+            return ERR_MEMORY_ALLOC;
+        }
+
+        size_t len = text.len;
+        if (kind == SCHEMA_HEX) {
+            PHASE_START(hex_mark);
+            int ret = hex_decode(text.ptr, text.len, dst, cap, &len);
+            PHASE_STOP(hex_mark, PHASE_HEX);
+            if (ret != SUCCESS) {
+                return ERR_INVALID_FORMAT;
+            }
+        } else {
+            memcpy(dst, text.ptr, text.len);
+        }
+
+        value->offset = out->payload_len;
+        value->len = (uint32_t)len;
+        out->payload_len += len;
+    }
+
+    value->present = 1;
+    return SUCCESS;
+}
+
+// 이어지는 값을 채운 새 레코드 추가
+static int push_record(DecodedVectors* out, const SchemaValue* carry, uint64_t start) {
+    if (out->count == out->capacity) {
+        size_t cap = out->capacity ? out->capacity * 2 : 64;
+        SchemaValue* values = (SchemaValue*)realloc(out->values, cap * out->field_count * sizeof(SchemaValue));
+        if (values == NULL) {
+            return ERR_MEMORY_ALLOC;
+        }
+        out->values = values;
+
+        SchemaSpan* spans = (SchemaSpan*)realloc(out->spans, cap * sizeof(SchemaSpan));
+        if (spans == NULL) {
+            return ERR_MEMORY_ALLOC;
+        }
+        out->spans = spans;
+        out->capacity = cap;
+    }
+
+    memcpy(&out->values[out->count * out->field_count], carry, out->field_count * sizeof(SchemaValue));
+    out->spans[out->count].start = start;
+    out->spans[out->count].end = start;
+    out->count++;
+    return SUCCESS;
+}
+
+/**
+ * 한 번의 순회로 디코딩
+ * 섹션 파라미터와 이어지는 값은 carry에 두었다가 새 레코드마다 복사하고,
+ * 레코드가 나온 뒤 새 섹션 묶음이 시작되면 carry를 비움
+ */
+int schema_decode(const VectorSchema* schema, VectorReader* reader, DecodedVectors* out) {
+    return schema_decode_ex(schema, reader, 0, out);
+}
+
+int schema_decode_ex(const VectorSchema* schema, VectorReader* reader, size_t stream_min, DecodedVectors* out) {
+    memset(out, 0, sizeof(*out));
+    if (schema == NULL || schema->field_count > SCHEMA_MAX_FIELDS) {
+        return ERR_INVALID_INPUT;
+    }
+    out->schema = schema;
+    out->source = reader->data;
+    out->field_count = schema->field_count;
+    const size_t base = reader->pos;
+
+    SchemaValue carry[SCHEMA_MAX_FIELDS];
+    memset(carry, 0, sizeof(carry));
+
+    const size_t NO_RECORD = (size_t)-1;
+    size_t current = NO_RECORD;
+    bool records_since_section = false;
+    VecToken token;
+    int ret = SUCCESS;
+
+    while (ret == SUCCESS && vector_reader_next(reader, &token)) {
+        if (token.type == VEC_TOKEN_SECTION) {
+            if (records_since_section) {
+                memset(carry, 0, sizeof(carry));
+                records_since_section = false;
+            }
+            current = NO_RECORD;
+
+            bool named = (token.value.len == 0 && memchr(token.key.ptr, '=', token.key.len) == NULL);
+            for (size_t f = 0; f < schema->field_count && ret == SUCCESS; f++) {
+                const SchemaField* field = &schema->fields[f];
+                if ((field->flags & SCHEMA_FLAG_SECTION_NAME) && named &&
+                    strview_starts_with(token.section, field->key)) {
+                    static const SchemaField SECTION_NAME = { "", SCHEMA_TEXT, 0 };
+                    ret = decode_value(out, reader->data, &SECTION_NAME, 0, token.section, &carry[f]);
+                } else if ((field->flags & SCHEMA_FLAG_SECTION) && strview_eq(token.key, field->key)) {
+                    ret = decode_value(out, reader->data, field, 0, token.value, &carry[f]);
+                }
+            }
+            continue;
+        }
+
+        if (token.type != VEC_TOKEN_FIELD) continue;
+
+        int f = find_field(schema, token.key, SCHEMA_FLAG_SECTION | SCHEMA_FLAG_SECTION_NAME);
+        if (f < 0) continue;
+        const SchemaField* field = &schema->fields[f];
+
+        // 이어지는 값: 이후 레코드에 복사되고 현재 레코드는 끝남
+        if (field->flags & SCHEMA_FLAG_STICKY) {
+            ret = decode_value(out, reader->data, field, 0, token.value, &carry[f]);
+            current = NO_RECORD;
+            continue;
+        }
+
+        // 시작 필드이거나 같은 필드가 다시 나오면 새 레코드
+        bool start_new = (current == NO_RECORD) || (field->flags & SCHEMA_FLAG_START) ||
+                         out->values[current * out->field_count + (size_t)f].present;
+        if (start_new) {
+            if (out->count == 0) {
+                out->header_len = token.offset - base;
+            }
+            ret = push_record(out, carry, token.offset);
+            if (ret != SUCCESS) break;
+            current = out->count - 1;
+            records_since_section = true;
+        }
+
+        ret = decode_value(out, reader->data, field, stream_min, token.value,
+                           &out->values[current * out->field_count + (size_t)f]);
+        out->spans[current].end = reader->pos;
+    }
+
+    if (out->count == 0) {
+        out->header_len = reader->size - base;
+    }
+    if (ret != SUCCESS) {
+        decoded_vectors_free(out);
+    }
+    return ret;
+}
+
+int schema_decode_file(const VectorSchema* schema, const char* path, DecodedVectors* out) {
+    VectorReader reader;
+    int ret = vector_reader_open(&reader, path);
+    if (ret != SUCCESS) {
+        memset(out, 0, sizeof(*out));
+        return ret;
+    }
+
+    PHASE_START(parse_mark);
+    ret = schema_decode(schema, &reader, out);
+    PHASE_STOP(parse_mark, PHASE_PARSE);
+    if (ret == SUCCESS && vector_reader_error(&reader) != SUCCESS) {
+        decoded_vectors_free(out);
+        ret = vector_reader_error(&reader);
+    }
+    vector_reader_close(&reader);
+    out->source = NULL;
+    return ret;
+}
+
+const uint8_t* decoded_bytes_chunk(const DecodedVectors* decoded, const SchemaValue* value, size_t pos, size_t n,
+                                   uint8_t* buf) {
+    if (pos > value->len || n > value->len - pos) {
+        return NULL;
+    }
+    if (!decoded_text_only(value)) {
+        return decoded_bytes(decoded, value) + pos;
+    }
+
+    size_t len = 0;
+    if (decoded->source == NULL ||
+        hex_decode(decoded->source + value->text_offset + pos * 2, n * 2, buf, n, &len) != SUCCESS || len != n) {
+        return NULL;
+    }
+    return buf;
+}
+
+// 원문만 기록한 값을 비교할 때 한 번에 디코딩하는 바이트 수
+#define SCHEMA_COMPARE_CHUNK 4096
+
+bool decoded_bytes_equal(const DecodedVectors* a, const SchemaValue* va, const DecodedVectors* b,
+                         const SchemaValue* vb) {
+    if (va->len != vb->len) {
+        return false;
+    }
+    if (!decoded_text_only(va) && !decoded_text_only(vb)) {
+        return va->len == 0 || memcmp(decoded_bytes(a, va), decoded_bytes(b, vb), va->len) == 0;
+    }
+
+    uint8_t buf_a[SCHEMA_COMPARE_CHUNK], buf_b[SCHEMA_COMPARE_CHUNK];
+    for (size_t pos = 0; pos < va->len; pos += SCHEMA_COMPARE_CHUNK) {
+        size_t n = va->len - pos < SCHEMA_COMPARE_CHUNK ? va->len - pos : SCHEMA_COMPARE_CHUNK;
+        const uint8_t* pa = decoded_bytes_chunk(a, va, pos, n, buf_a);
+        const uint8_t* pb = decoded_bytes_chunk(b, vb, pos, n, buf_b);
+        if (pa == NULL || pb == NULL || memcmp(pa, pb, n) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void decoded_vectors_free(DecodedVectors* decoded) {
+    free(decoded->values);
+    free(decoded->spans);
+    free(decoded->payload);
+    memset(decoded, 0, sizeof(*decoded));
+}
@@ -1,11 +1,23 @@
+#ifdef _WIN32
 #include <windows.h>
 #include <direct.h>
 #include <conio.h>
+#define getcwd _getcwd
+#define chdir _chdir
+#else
+#include <unistd.h>
+#endif
 #include "../algorithm/sha256.h"
 #include "../common/error.h"
 #include "../common/common.h"
 #include "../common/algorithm_registry.h"
 #include "../common/dynamic_menu.h"
+#include "../common/evp_cache.h"
+#include "../common/batch_runner.h"
+#include "../common/bench.h"
+#include "../common/phase_stats.h"
+#include "../common/perf_counters.h"
+#include "../common/perf_history.h"
 
 // 상수 정의
 #define MIN_CHOICE 0
@@ -47,7 +59,7 @@ static int set_working_directory(void) {
     char cwd[MAX_PATH_LENGTH];
     
     // 현재 디렉토리 확인
-    if (_getcwd(cwd, sizeof(cwd)) == NULL) {
+    if (getcwd(cwd, sizeof(cwd)) == NULL) {
         if (errno == EACCES) {
             return ERR_SYSTEM_PERMISSION;
         }
@@ -56,8 +68,11 @@ static int set_working_directory(void) {
 
     // bin 디렉토리 확인 및 변경
     char *last_dir = strrchr(cwd, '\\');
-    if (last_dir && strcmp(last_dir, "\\bin") == 0) {
-        if (_chdir("..") != 0) {
+    if (last_dir == NULL) {
+        last_dir = strrchr(cwd, '/');
+    }
+    if (last_dir && strcmp(last_dir + 1, "bin") == 0) {
+        if (chdir("..") != 0) {
             if (errno == EACCES) {
                 return ERR_SYSTEM_PERMISSION;
             }
@@ -65,7 +80,7 @@ static int set_working_directory(void) {
         }
         
         // 변경된 디렉토리 확인
-        if (_getcwd(cwd, sizeof(cwd)) == NULL) {
+        if (getcwd(cwd, sizeof(cwd)) == NULL) {
             return ERR_SYSTEM_DIR;
         }
         printf("작업 디렉토리 변경: %s\n\n", cwd);
@@ -85,19 +100,142 @@ static void print_main_menu(void) {
     printf("└────────────────────────────────────┘\n");
 }
 
-// 진행 상태 표시 함수
-static void print_progress(const char* message) {
-    printf("\n[진행] %s\n", message);
+// 명령행 사용법 출력
+static void print_usage(const char* program) {
+    printf("사용법: %s [--batch [--verify] [-j 스레드 수] [--algo 알고리즘 이름] [--file 이름] [--records 선택자] [--force] [--perf]]\n",
+           program);
+    printf("  인자 없이 실행하면 대화형 메뉴를 띄움\n");
+    printf("  --batch      test_vectors/request 아래 모든 요청 파일을 비대화형으로 실행\n");
+    printf("  --verify     실행하지 않고 기존 응답 파일만 정답과 비교 (--batch 포함)\n");
+    printf("  -j, --jobs   작업 스레드 수 (기본: CPU 코어 수)\n");
+    printf("  --algo       지정한 이름의 알고리즘만 실행\n");
+    printf("  --file       \"디렉토리/파일\"에 이 문자열이 들어간 요청 파일만 실행\n");
+    printf("  --force      결과 캐시를 무시하고 모든 파일을 다시 실행\n");
+    printf("  --records    선택한 레코드만 실행 후 비교 (예: 12, 10-20, Count=3, mod=2048,SHAAlg=SHA256)\n");
+    printf("  --perf       알고리즘 커널 호출의 하드웨어 카운터를 크기 구간별로 요약 (Linux, --batch/--bench와 함께)\n");
+    printf("       %s --bench [--algo 알고리즘 이름] [--sizes 크기 목록] [--json 파일] [--cpu 번호] [--bench-time 초] [--trials 횟수] [--perf]\n",
+           program);
+    printf("  --bench      등록된 알고리즘의 처리량 측정 (ns/op, MB/s, cycles/B)\n");
+    printf("               해시: oneshot/stream/batch, MAC: mac(고정 키)/mac-rotate(키 교체)/verify-many\n");
+    printf("  --sizes      메시지 크기 목록 (예: 64,1K,16M, 기본: 16B부터 16MB까지 4배씩)\n");
+    printf("  --json       측정 결과를 JSON으로도 기록\n");
+    printf("  --cpu        측정 스레드를 고정할 CPU (기본: 시작한 CPU, -2면 고정 안 함)\n");
+    printf("  --bench-time 측정 한 번의 최소 시간 (기본: 0.1초)\n");
+    printf("  --trials     반복 측정 횟수, 중앙값 사용 (기본: 5)\n");
+    printf("       %s --monte 요청 파일... [--monte-out 디렉토리]\n", program);
+    printf("  --monte      SHA-256 몬테 카를로 요청 파일 여러 개(시드 목록)의 체인을 SIMD 레인에서 동시에 실행\n");
+    printf("  --monte-out  응답 디렉토리 (기본: 요청 파일과 같은 디렉토리, 이름은 <이름>.rsp)\n");
+    printf("       %s --compare 기준 파일 [--threshold 퍼센트] | --save-baseline 기준 파일 [--history 기록 파일]\n",
+           program);
+    printf("  --bench/--batch 실행마다 측정값을 성능 기록에 덧붙임 (기본: %s, CRYPTO_TEST_PERF_HISTORY=off면 끔)\n",
+           PERF_HISTORY_DEFAULT_PATH);
+    printf("  --compare    알고리즘별 최근 실행을 기준과 비교해 통계적으로 의미 있는 처리량 저하가 있으면 실패\n");
+    printf("  --threshold  회귀로 보는 처리량 감소율 (기본: 5%%)\n");
+    printf("  --save-baseline 기록 파일에서 최근 실행과 같은 커밋의 실행을 모두 기준 파일로 저장\n");
+    printf("  --history    성능 기록 파일 경로\n");
+}
+
+// 프로파일링과 성능 기록 관련 명령행 옵션
+typedef struct {
+    bool perf;                  // --perf
+    const char* baseline;       // --compare / --save-baseline 파일
+    double threshold;           // --threshold (비율)
+} PerfArgs;
+
+// --monte 옵션 (요청 파일 목록은 argv를 그대로 가리킴)
+typedef struct {
+    const char* const* files;
+    size_t count;
+    const char* output_dir;     // --monte-out
+} MonteArgs;
+
+/**
+ * 명령행 인자 해석
+ * @return 대화형 모드면 0, 배치 모드면 1, 벤치마크 모드면 2, 성능 비교면 3, 기준 저장이면 4,
+ *         몬테 카를로 다중 실행이면 5, 잘못된 인자면 -1
+ */
+static int parse_arguments(int argc, char** argv, BatchOptions* options, BenchOptions* bench, PerfArgs* perf,
+                           MonteArgs* monte) {
+    int batch = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--batch") == 0) {
+            batch = 1;
+        } else if (strcmp(argv[i], "--bench") == 0) {
+            batch = 2;
+        } else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+            bench->sizes = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            bench->json_path = argv[++i];
+        } else if (strcmp(argv[i], "--cpu") == 0 && i + 1 < argc) {
+            bench->cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bench-time") == 0 && i + 1 < argc) {
+            bench->min_time = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--trials") == 0 && i + 1 < argc) {
+            bench->trials = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            batch = 1;
+            options->verify_only = true;
+        } else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) && i + 1 < argc) {
+            options->jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            options->algo_filter = argv[++i];
+            bench->algo_filter = options->algo_filter;
+        } else if (strcmp(argv[i], "--force") == 0) {
+            options->force = true;
+        } else if (strcmp(argv[i], "--perf") == 0) {
+            perf->perf = true;
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            batch = 3;
+            perf->baseline = argv[++i];
+        } else if (strcmp(argv[i], "--save-baseline") == 0 && i + 1 < argc) {
+            batch = 4;
+            perf->baseline = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            perf->threshold = atof(argv[++i]) / 100.0;
+        } else if (strcmp(argv[i], "--history") == 0 && i + 1 < argc) {
+            perf_history_set_path(argv[++i]);
+        } else if (strcmp(argv[i], "--monte") == 0 && i + 1 < argc && argv[i + 1][0] != '-') {
+            // 다음 옵션 전까지의 인자가 모두 요청 파일
+            batch = 5;
+            monte->files = (const char* const*)&argv[i + 1];
+            monte->count = 0;
+            while (i + 1 < argc && argv[i + 1][0] != '-') {
+                monte->count++;
+                i++;
+            }
+        } else if (strcmp(argv[i], "--monte-out") == 0 && i + 1 < argc) {
+            monte->output_dir = argv[++i];
+        } else if (strcmp(argv[i], "--file") == 0 && i + 1 < argc) {
+            options->file_filter = argv[++i];
+        } else if (strcmp(argv[i], "--records") == 0 && i + 1 < argc) {
+            batch = 1;
+            options->records = argv[++i];
+        } else {
+            return -1;
+        }
+    }
+    
+    return batch;
 }
 
 // main 함수
 int main(int argc, char** argv) {
-    // 미사용 매개변수 경고 제거
-    (void)argc;
-    (void)argv;
-    
     int result = SUCCESS;
     
+    BatchOptions batch_options;
+    BenchOptions bench_options;
+    batch_options_init(&batch_options);
+    bench_options_init(&bench_options);
+    PerfArgs perf = { false, NULL, PERF_HISTORY_DEFAULT_THRESHOLD };
+    MonteArgs monte = { NULL, 0, NULL };
+    int mode = parse_arguments(argc, argv, &batch_options, &bench_options, &perf, &monte);
+    if (mode < 0) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    
+#ifdef _WIN32
     // 한글 입출력을 위한 콘솔 설정 - 입출력 모두 설정
     SetConsoleCP(65001);      // 입력 코드 페이지 설정 (추가)
     SetConsoleOutputCP(65001);  // 출력 코드 페이지 설정 (기존)
@@ -107,6 +245,7 @@ int main(int argc, char** argv) {
     cfi.cbSize = sizeof(cfi);
     GetCurrentConsoleFontEx(GetStdHandle(STD_OUTPUT_HANDLE), FALSE, &cfi);
     printf("현재 콘솔 폰트: %ls\n", cfi.FaceName);
+#endif
     
     // 작업 디렉토리 설정
     result = set_working_directory();
@@ -117,6 +256,54 @@ int main(int argc, char** argv) {
     
     // 모든 알고리즘 등록
     register_all_algorithms();
+
+    // 하드웨어 카운터 프로파일링 (캐시된 결과는 실행하지 않으므로 배치에서는 --force와 같이 동작)
+    if (perf.perf) {
+        result = perf_profile_enable();
+        if (result != SUCCESS) {
+            printf("경고: 하드웨어 카운터를 열 수 없어 --perf 없이 실행합니다 (%s, perf_event_paranoid 확인)\n",
+                   get_error_message(result));
+        }
+        batch_options.force = true;
+    }
+    
+    // 배치 모드: 전체 요청 파일 실행 후 종료 (모두 통과하면 0)
+    if (mode == 1) {
+        result = run_batch(&batch_options);
+        PHASE_REPORT();
+        perf_profile_report();
+        evp_cache_cleanup();
+        return result == SUCCESS ? 0 : 1;
+    }
+
+    // 벤치마크 모드: 처리량 측정 후 종료
+    if (mode == 2) {
+        result = run_bench(&bench_options);
+        evp_cache_cleanup();
+        return result == SUCCESS ? 0 : 1;
+    }
+
+    // 몬테 카를로 다중 실행: 요청 파일마다 체인 하나씩, 응답도 파일마다 따로 기록
+    if (mode == 5) {
+        result = run_monte_files(monte.files, monte.count, monte.output_dir);
+        if (result != SUCCESS) {
+            print_error(result);
+        }
+        PHASE_REPORT();
+        perf_profile_report();
+        evp_cache_cleanup();
+        return result == SUCCESS ? 0 : 1;
+    }
+
+    // 성능 기록: 최근 실행을 기준과 비교 (회귀가 있으면 1) 또는 최근 실행을 기준으로 저장
+    if (mode == 3 || mode == 4) {
+        result = (mode == 3) ? run_perf_compare(perf.baseline, perf.threshold)
+                             : perf_history_save_baseline(perf.baseline);
+        if (result != SUCCESS && result != ERR_TEST_FAILED) {
+            print_error(result);
+        }
+        return result == SUCCESS ? 0 : 1;
+    }
     
     while (1) {
         print_main_menu();
@@ -166,5 +353,9 @@ int main(int argc, char** argv) {
         }
     }
     
+    // 캐시된 OpenSSL 객체 해제
+    PHASE_REPORT();
+    perf_profile_report();
+    evp_cache_cleanup();
     return 0;
 }
\ No newline at end of file
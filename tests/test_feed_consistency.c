@@ -0,0 +1,108 @@
+/**
+ * 캐시 경로와 토크나이저 경로의 입력 검사 일치 테스트
+ * 같은 요청 파일을 .vbin 캐시를 끄고, 켜고(처음 만들 때와 다시 읽을 때) 실행해 반환값이 같은지 확인
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "../include/algorithm/sha256.h"
+#include "../include/algorithm/cmac_128.h"
+#include "../include/common/vector_cache.h"
+#include "../include/common/error.h"
+
+typedef struct {
+    const char* name;
+    int (*run)(const char* input_file, const char* output_file);
+    const char* body;           // 요청 파일 내용 (%s 자리에 Msg 16진수)
+    size_t len;                 // Len/Mlen 바이트
+    size_t hex_bytes;           // Msg 16진수가 나타내는 바이트 수
+    int expected;
+} FeedCase;
+
+#define SHA_BODY  "[L = 32]\n\nLen = %zu\nMsg = %s\n\n"
+#define CMAC_BODY "Count = 0\nKlen = 16\nMlen = %zu\nTlen = 4\nKey = e4b7645b2f7d63b4674cd01970c9d1ec\nMsg = %s\n\n"
+
+static const FeedCase CASES[] = {
+    { "sha-exact",        sha256_test,  SHA_BODY,  100,   100,   SUCCESS },
+    { "sha-short",        sha256_test,  SHA_BODY,  100,   50,    ERR_INVALID_FORMAT },
+    { "sha-long",         sha256_test,  SHA_BODY,  100,   150,   ERR_INVALID_FORMAT },
+    { "sha-stream-exact", sha256_test,  SHA_BODY,  80000, 80000, SUCCESS },
+    { "sha-stream-short", sha256_test,  SHA_BODY,  80000, 70000, ERR_INVALID_FORMAT },
+    { "sha-stream-long",  sha256_test,  SHA_BODY,  80000, 90000, ERR_INVALID_FORMAT },
+    { "cmac-exact",       cmac128_test, CMAC_BODY, 16,    16,    SUCCESS },
+    { "cmac-short",       cmac128_test, CMAC_BODY, 16,    8,     ERR_INVALID_FORMAT },
+    { "cmac-long",        cmac128_test, CMAC_BODY, 16,    24,    ERR_INVALID_FORMAT },
+};
+
+// 요청 파일 작성 (Len은 SHA는 비트, CMAC은 바이트)
+static int write_case(const FeedCase* c, const char* path) {
+    char* hex = (char*)malloc(c->hex_bytes * 2 + 1);
+    FILE* fp = fopen(path, "w");
+    if (hex == NULL || fp == NULL) {
+        free(hex);
+        if (fp != NULL) fclose(fp);
+        return ERR_FILE_CREATE;
+    }
+    for (size_t i = 0; i < c->hex_bytes; i++) {
+        memcpy(hex + 2 * i, "ab", 2);
+    }
+    hex[c->hex_bytes * 2] = '\0';
+
+    size_t len_field = (c->run == sha256_test) ? c->len * 8 : c->len;
+    fprintf(fp, c->body, len_field, hex);
+    fclose(fp);
+    free(hex);
+    return SUCCESS;
+}
+
+int main(void) {
+    char dir[] = "/tmp/crypto_test_feedXXXXXX";
+    char cache_dir[sizeof(dir) + 8];
+    int failed = 0;
+
+    if (mkdtemp(dir) == NULL) {
+        perror("mkdtemp");
+        return 1;
+    }
+    snprintf(cache_dir, sizeof(cache_dir), "%s/vbin", dir);
+    vector_cache_set_dir(cache_dir);
+
+    for (size_t i = 0; i < sizeof(CASES) / sizeof(CASES[0]); i++) {
+        const FeedCase* c = &CASES[i];
+        char input[256];
+        char output[256];
+        snprintf(input, sizeof(input), "%s/%s.req", dir, c->name);
+        snprintf(output, sizeof(output), "%s/%s.rsp", dir, c->name);
+        if (write_case(c, input) != SUCCESS) {
+            printf("✕ %s: 요청 파일을 만들 수 없음\n", c->name);
+            failed++;
+            continue;
+        }
+
+        // 캐시 끔, 캐시 생성, 캐시 재사용 순서로 실행
+        setenv("CRYPTO_TEST_VBIN_DIR", "off", 1);
+        int off = c->run(input, output);
+        unsetenv("CRYPTO_TEST_VBIN_DIR");
+        int cold = c->run(input, output);
+        int warm = c->run(input, output);
+
+        bool ok = (off == c->expected && cold == c->expected && warm == c->expected);
+        printf("%s %s: 캐시 끔 %d, 캐시 생성 %d, 캐시 재사용 %d (기대 %d)\n",
+               ok ? "✓" : "✕", c->name, off, cold, warm, c->expected);
+        failed += ok ? 0 : 1;
+        remove(input);
+        remove(output);
+    }
+
+    // 임시 디렉토리 정리
+    char command[512];
+    snprintf(command, sizeof(command), "rm -rf '%s'", dir);
+    if (system(command) != 0) {
+        printf("경고: %s를 지울 수 없음\n", dir);
+    }
+
+    printf("\n%s: 실패 %d개\n", failed == 0 ? "통과" : "실패", failed);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+/**
+ * 여러 체인 몬테 카를로 엔진 테스트
+ * 같은 시드를 SIMD 레인 엔진(sha256_monte_engine_run_many)과 단일 체인 엔진(sha256_monte_engine_run)으로
+ * 실행해 모든 체크포인트가 같은지 확인 (레인 폭은 CRYPTO_TEST_SHA256_MB_LANES로 바꿔 볼 수 있음)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "../include/algorithm/sha256.h"
+#include "../include/algorithm/sha256_mb.h"
+#include "../include/algorithm/sha256_monte.h"
+#include "../include/common/error.h"
+
+// 레인 묶음 경계(4/8/16)에 걸리지 않는 체인 수
+#define CHAIN_COUNT 19
+
+// 체인 하나의 체크포인트 기록
+typedef struct {
+    uint8_t md[SHA256_MONTE_CHECKPOINTS][SHA256_DIGEST_LENGTH];
+    int next;       // 다음에 올 체크포인트 번호
+    bool ordered;   // 체크포인트가 0부터 차례대로 왔는지
+} ChainLog;
+
+static int record_checkpoint(void* user, int count, const uint8_t md[SHA256_DIGEST_LENGTH]) {
+    ChainLog* log = (ChainLog*)user;
+    if (count != log->next || count < 0 || count >= SHA256_MONTE_CHECKPOINTS) {
+        log->ordered = false;
+        return SUCCESS;
+    }
+    memcpy(log->md[count], md, SHA256_DIGEST_LENGTH);
+    log->next++;
+    return SUCCESS;
+}
+
+static void log_init(ChainLog* log) {
+    memset(log, 0, sizeof(*log));
+    log->ordered = true;
+}
+
+int main(void) {
+    static uint8_t seeds[CHAIN_COUNT][SHA256_DIGEST_LENGTH];
+    static ChainLog many[CHAIN_COUNT];
+    static ChainLog single;
+    void* users[CHAIN_COUNT];
+    int failed = 0;
+
+    // 체인마다 다른 시드 (첫 체인은 모두 0인 시드)
+    for (size_t c = 0; c < CHAIN_COUNT; c++) {
+        for (size_t i = 0; i < SHA256_DIGEST_LENGTH; i++) {
+            seeds[c][i] = (uint8_t)(c * 37 + i * c * 11);
+        }
+        log_init(&many[c]);
+        users[c] = &many[c];
+    }
+
+    Sha256MonteStats stats = { 0 };
+    int ret = sha256_monte_engine_run_many((const uint8_t (*)[SHA256_DIGEST_LENGTH])seeds, CHAIN_COUNT,
+                                           record_checkpoint, users, &stats);
+    printf("%s 레인 %zu, 체인 %d개: 반환값 %d, %llu회 반복\n", sha256_mb_impl_name(), sha256_mb_lanes(),
+           CHAIN_COUNT, ret, (unsigned long long)stats.iterations);
+    if (ret != SUCCESS ||
+        stats.iterations != (uint64_t)CHAIN_COUNT * SHA256_MONTE_CHECKPOINTS * SHA256_MONTE_ITERATIONS) {
+        printf("✕ 여러 체인 실행 실패\n");
+        failed++;
+    }
+
+    // 체인마다 네이티브/EVP 단일 체인 엔진과 비교
+    for (size_t c = 0; c < CHAIN_COUNT && ret == SUCCESS; c++) {
+        for (int native = 1; native >= 0; native--) {
+            log_init(&single);
+            int single_ret = sha256_monte_engine_run(seeds[c], native != 0, record_checkpoint, &single, NULL);
+
+            bool ok = single_ret == SUCCESS && single.ordered && many[c].ordered &&
+                      single.next == SHA256_MONTE_CHECKPOINTS && many[c].next == SHA256_MONTE_CHECKPOINTS &&
+                      memcmp(single.md, many[c].md, sizeof(single.md)) == 0;
+            printf("%s 체인 %zu (%s): 체크포인트 %d/%d개\n", ok ? "✓" : "✕", c,
+                   native ? "네이티브" : "EVP", many[c].next, single.next);
+            failed += ok ? 0 : 1;
+        }
+    }
+
+    // 체인 0개는 할당 없이 성공
+    if (sha256_monte_engine_run_many(NULL, 0, record_checkpoint, NULL, NULL) != SUCCESS ||
+        sha256_monte_multi(NULL, NULL, 0) != SUCCESS) {
+        printf("✕ 빈 시드 목록 실패\n");
+        failed++;
+    }
+
+    printf("\n%s: 실패 %d개\n", failed == 0 ? "통과" : "실패", failed);
+    return failed == 0 ? 0 : 1;
+}